@@ -0,0 +1,114 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "name-interner.hpp"
+#include "city-hash.hpp"
+
+#include <unordered_map>
+
+namespace nfd {
+
+namespace {
+
+struct NameRefHash
+{
+  size_t
+  operator()(const Name* name) const
+  {
+    const Block& wire = name->wireEncode();
+    return static_cast<size_t>(CityHash64(reinterpret_cast<const char*>(wire.wire()),
+                                          wire.size()));
+  }
+};
+
+struct NameRefEqual
+{
+  bool
+  operator()(const Name* a, const Name* b) const
+  {
+    return *a == *b;
+  }
+};
+
+/** \brief interned Names, keyed by the interned instance itself
+ *
+ *  An interned Name removes itself from the pool when its last reference is released.
+ */
+typedef std::unordered_map<const Name*, weak_ptr<const Name>,
+                           NameRefHash, NameRefEqual> NamePool;
+
+} // namespace
+
+static bool g_isNameInterningEnabled = true;
+
+static NamePool&
+getNamePool()
+{
+  // never destroyed: interned Names may be released by tables destroyed after main() returns
+  static NamePool* pool = new NamePool();
+  return *pool;
+}
+
+shared_ptr<const Name>
+internName(const Name& name)
+{
+  if (!g_isNameInterningEnabled) {
+    return make_shared<Name>(name);
+  }
+
+  NamePool& pool = getNamePool();
+  auto it = pool.find(&name);
+  if (it != pool.end()) {
+    return it->second.lock();
+  }
+
+  Name* interned = new Name(name);
+  shared_ptr<const Name> result(interned, [] (const Name* released) {
+      getNamePool().erase(released);
+      delete released;
+    });
+  pool.insert({interned, result});
+  return result;
+}
+
+void
+setNameInterning(bool isEnabled)
+{
+  g_isNameInterningEnabled = isEnabled;
+}
+
+bool
+isNameInterningEnabled()
+{
+  return g_isNameInterningEnabled;
+}
+
+size_t
+getNInternedNames()
+{
+  return getNamePool().size();
+}
+
+} // namespace nfd
@@ -0,0 +1,64 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_NAME_INTERNER_HPP
+#define NFD_CORE_NAME_INTERNER_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+
+/** \brief returns an immutable instance of name
+ *
+ *  When name interning is enabled, equal Names obtained from this function share one
+ *  instance, which is released together with the last reference.  ndnSIM simulates many
+ *  forwarders in one process, and their FIB and StrategyChoice tables and the global routing
+ *  helper keep the same configured prefixes; these store their prefixes through this function,
+ *  so each distinct prefix is stored once per process.  Name tree, PIT and Measurements
+ *  entries, which are created per packet, keep plain Names and do not pay for interning.
+ *
+ *  When name interning is disabled, a private copy of name is returned.
+ */
+shared_ptr<const Name>
+internName(const Name& name);
+
+/** \brief enables or disables name interning
+ *
+ *  Names interned before disabling remain shared.  Enabled by default.
+ */
+void
+setNameInterning(bool isEnabled);
+
+bool
+isNameInterningEnabled();
+
+/** \return number of distinct Names currently interned
+ */
+size_t
+getNInternedNames();
+
+} // namespace nfd
+
+#endif // NFD_CORE_NAME_INTERNER_HPP
@@ -25,44 +25,126 @@
 
 #include "scheduler.hpp"
 
-namespace ns3 {
+namespace nfd {
+namespace scheduler {
+namespace detail {
+
+/** \brief free list of event records, grown in chunks
+ *
+ *  Records are never returned to the system allocator, so that steady-state scheduling
+ *  performs no heap allocation for event bookkeeping.
+ */
+class EventPool : noncopyable
+{
+public:
+  EventRecord*
+  allocate()
+  {
+    if (m_freeList == nullptr) {
+      this->grow();
+    }
+    EventRecord* record = m_freeList;
+    m_freeList = record->nextFree;
+    record->nextFree = nullptr;
+    return record;
+  }
 
-/// @cond include_hidden
+  void
+  release(EventRecord* record)
+  {
+    BOOST_ASSERT(record->nRefs == 0);
+    record->callback = nullptr;
+    record->isPending = false;
+    record->nextFree = m_freeList;
+    m_freeList = record;
+  }
 
-template<>
-struct EventMemberImplObjTraits<std::function<void()>> {
-  typedef std::function<void()> T;
-  static T&
-  GetReference(T& p)
+private:
+  void
+  grow()
   {
-    return p;
+    m_chunks.emplace_back(new EventRecord[CHUNK_SIZE]);
+    EventRecord* chunk = m_chunks.back().get();
+    for (size_t i = 0; i < CHUNK_SIZE; ++i) {
+      chunk[i].nextFree = m_freeList;
+      m_freeList = &chunk[i];
+    }
   }
+
+private:
+  static const size_t CHUNK_SIZE = 256;
+
+  std::vector<std::unique_ptr<EventRecord[]>> m_chunks;
+  EventRecord* m_freeList = nullptr;
 };
 
-/// @endcond
+static EventPool&
+getEventPool()
+{
+  // intentionally leaked: EventIds held by static objects may be released after main() returns
+  static EventPool* pool = new EventPool;
+  return *pool;
+}
+
+EventRecord*
+allocateEventRecord()
+{
+  return getEventPool().allocate();
+}
+
+void
+releaseEventRecord(EventRecord* record)
+{
+  getEventPool().release(record);
+}
+
+void
+invokeEvent(EventId eventId)
+{
+  EventRecord* record = eventId.m_record;
+  if (!record->isPending) {
+    // cancelled
+    return;
+  }
 
-} // namespace ns3
+  record->isPending = false;
+  // the callback may cancel or reschedule events, including this one
+  std::function<void()> callback = std::move(record->callback);
+  record->callback = nullptr;
+  callback();
+}
 
-namespace nfd {
-namespace scheduler {
+} // namespace detail
 
 EventId
-schedule(const time::nanoseconds& after, const std::function<void()>& event)
+schedule(const time::nanoseconds& after, std::function<void()> event)
 {
-  ns3::EventId id = ns3::Simulator::Schedule(ns3::NanoSeconds(after.count()),
-                                             &std::function<void()>::operator(), event);
-  return std::make_shared<ns3::EventId>(id);
+  detail::EventRecord* record = detail::allocateEventRecord();
+  record->callback = std::move(event);
+  record->isPending = true;
+
+  EventId eventId(record);
+  ns3::Simulator::Schedule(ns3::NanoSeconds(after.count()), &detail::invokeEvent, eventId);
+  return eventId;
 }
 
 void
 cancel(const EventId& eventId)
 {
-  if (eventId != nullptr) {
-    ns3::Simulator::Remove(*eventId);
+  detail::EventRecord* record = eventId.m_record;
+  if (record != nullptr) {
+    record->isPending = false;
+    record->callback = nullptr;
     const_cast<EventId&>(eventId).reset();
   }
 }
 
+std::ostream&
+operator<<(std::ostream& os, const EventId& eventId)
+{
+  return os << static_cast<const void*>(eventId.m_record);
+}
+
 ScopedEventId::ScopedEventId()
 {
 }
@@ -33,17 +33,174 @@
 namespace nfd {
 namespace scheduler {
 
-/** \class EventId
- *  \brief Opaque type (shared_ptr) representing ID of a scheduled event
+class EventId;
+
+namespace detail {
+
+/** \brief pooled, intrusively reference-counted record of a scheduled event
+ *
+ *  One reference is held by the pending ns-3 event and one by each EventId copy.
+ *  Cancellation is lazy: the callback is dropped and the record is marked, and the ns-3 event
+ *  becomes a no-op when it fires.  The record returns to the pool when the last reference goes.
+ */
+class EventRecord : noncopyable
+{
+public:
+  std::function<void()> callback;
+  uint32_t nRefs = 0;
+  bool isPending = false;
+  EventRecord* nextFree = nullptr;
+};
+
+/** \brief body of the ns-3 event that carries a scheduled callback
+ *  \param eventId the reference to the event record held by the pending ns-3 event
+ */
+void
+invokeEvent(EventId eventId);
+
+/** \brief obtains a record from the event pool
+ */
+EventRecord*
+allocateEventRecord();
+
+/** \brief returns a record to the event pool
+ */
+void
+releaseEventRecord(EventRecord* record);
+
+} // namespace detail
+
+/** \brief identifies a scheduled event
+ *
+ *  EventId is a lightweight handle to a pooled event record.  Copies refer to the same event.
+ *  A default-constructed EventId refers to no event and evaluates to false.
  */
-typedef std::shared_ptr<ns3::EventId> EventId;
+class EventId
+{
+public:
+  EventId() noexcept
+    : m_record(nullptr)
+  {
+  }
+
+  EventId(const EventId& other) noexcept
+    : m_record(other.m_record)
+  {
+    if (m_record != nullptr) {
+      ++m_record->nRefs;
+    }
+  }
+
+  EventId(EventId&& other) noexcept
+    : m_record(other.m_record)
+  {
+    other.m_record = nullptr;
+  }
+
+  EventId&
+  operator=(const EventId& other) noexcept
+  {
+    EventId(other).swap(*this);
+    return *this;
+  }
+
+  EventId&
+  operator=(EventId&& other) noexcept
+  {
+    EventId(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  ~EventId()
+  {
+    this->reset();
+  }
+
+  /** \brief drops this reference without cancelling the event
+   */
+  void
+  reset() noexcept
+  {
+    if (m_record != nullptr && --m_record->nRefs == 0) {
+      detail::releaseEventRecord(m_record);
+    }
+    m_record = nullptr;
+  }
+
+  void
+  swap(EventId& other) noexcept
+  {
+    std::swap(m_record, other.m_record);
+  }
+
+  /** \retval true this EventId refers to an event (which may have already fired)
+   */
+  explicit
+  operator bool() const noexcept
+  {
+    return m_record != nullptr;
+  }
+
+  /** \retval true the event is scheduled and has neither fired nor been cancelled
+   */
+  bool
+  isPending() const noexcept
+  {
+    return m_record != nullptr && m_record->isPending;
+  }
+
+  bool
+  operator==(const EventId& other) const noexcept
+  {
+    return m_record == other.m_record;
+  }
+
+  bool
+  operator!=(const EventId& other) const noexcept
+  {
+    return m_record != other.m_record;
+  }
+
+private:
+  explicit
+  EventId(detail::EventRecord* record) noexcept
+    : m_record(record)
+  {
+    ++m_record->nRefs;
+  }
+
+  friend EventId
+  schedule(const time::nanoseconds& after, std::function<void()> event);
+
+  friend void
+  cancel(const EventId& eventId);
+
+  friend void
+  detail::invokeEvent(EventId eventId);
+
+  friend std::ostream&
+  operator<<(std::ostream& os, const EventId& eventId);
+
+private:
+  detail::EventRecord* m_record;
+};
+
+std::ostream&
+operator<<(std::ostream& os, const EventId& eventId);
 
 /** \brief schedule an event
+ *
+ *  The callback is moved into a pooled event record, so passing a temporary
+ *  (e.g., the result of bind) does not copy it.
  */
 EventId
-schedule(const time::nanoseconds& after, const std::function<void()>& event);
+schedule(const time::nanoseconds& after, std::function<void()> event);
 
 /** \brief cancel a scheduled event
+ *
+ *  Cancellation is O(1): the event is marked as cancelled and its callback is released
+ *  immediately; the underlying ns-3 event stays in the queue and is discarded when due.
+ *  \p eventId is reset, as if it were assigned a default-constructed EventId.
  */
 void
 cancel(const EventId& eventId);
@@ -75,7 +75,7 @@ AccessStrategy::afterReceiveNewInterest(const Face& inFace,
                                         shared_ptr<pit::Entry> pitEntry)
 {
   Name miName;
-  shared_ptr<MtInfo> mi;
+  MtInfo* mi;
   std::tie(miName, mi) = this->findPrefixMeasurements(*pitEntry);
 
   // has measurements for Interest Name?
@@ -143,7 +143,7 @@ AccessStrategy::sendToLastNexthop(const Face& inFace, shared_ptr<pit::Entry> pit
   this->sendInterest(pitEntry, face);
 
   // schedule RTO timeout
-  shared_ptr<PitInfo> pi = pitEntry->getOrCreateStrategyInfo<PitInfo>();
+  PitInfo* pi = pitEntry->getOrCreateStrategyInfo<PitInfo>();
   pi->rtoTimer = scheduler::schedule(rto,
       bind(&AccessStrategy::afterRtoTimeout, this, weak_ptr<pit::Entry>(pitEntry),
            weak_ptr<fib::Entry>(fibEntry), inFace.getId(), mi.lastNexthop));
@@ -189,7 +189,7 @@ void
 AccessStrategy::beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry,
                                       const Face& inFace, const Data& data)
 {
-  shared_ptr<PitInfo> pi = pitEntry->getStrategyInfo<PitInfo>();
+  PitInfo* pi = pitEntry->getStrategyInfo<PitInfo>();
   if (pi != nullptr) {
     pi->rtoTimer.cancel();
   }
@@ -220,7 +220,7 @@ AccessStrategy::updateMeasurements(const Face& inFace, const Data& data,
   FaceInfo& fi = m_fit[inFace.getId()];
   fi.rtt.addMeasurement(rtt);
 
-  shared_ptr<MtInfo> mi = this->addPrefixMeasurements(data);
+  MtInfo* mi = this->addPrefixMeasurements(data);
   if (mi->lastNexthop != inFace.getId()) {
     mi->lastNexthop = inFace.getId();
     mi->rtt = fi.rtt;
@@ -236,7 +236,7 @@ AccessStrategy::MtInfo::MtInfo()
 {
 }
 
-std::tuple<Name, shared_ptr<AccessStrategy::MtInfo>>
+std::tuple<Name, AccessStrategy::MtInfo*>
 AccessStrategy::findPrefixMeasurements(const pit::Entry& pitEntry)
 {
   shared_ptr<measurements::Entry> me = this->getMeasurements().findLongestPrefixMatch(pitEntry);
@@ -244,14 +244,14 @@ AccessStrategy::findPrefixMeasurements(const pit::Entry& pitEntry)
     return std::forward_as_tuple(Name(), nullptr);
   }
 
-  shared_ptr<MtInfo> mi = me->getStrategyInfo<MtInfo>();
+  MtInfo* mi = m_mtArena.find(*me);
   BOOST_ASSERT(mi != nullptr);
   // XXX after runtime strategy change, it's possible that me exists but mi doesn't exist;
   // this case needs another longest prefix match until mi is found
   return std::forward_as_tuple(me->getName(), mi);
 }
 
-shared_ptr<AccessStrategy::MtInfo>
+AccessStrategy::MtInfo*
 AccessStrategy::addPrefixMeasurements(const Data& data)
 {
   shared_ptr<measurements::Entry> me;
@@ -267,7 +267,7 @@ AccessStrategy::addPrefixMeasurements(const Data& data)
   static const time::nanoseconds ME_LIFETIME = time::seconds(8);
   this->getMeasurements().extendLifetime(*me, ME_LIFETIME);
 
-  return me->getOrCreateStrategyInfo<MtInfo>();
+  return m_mtArena.insert(*me).first;
 }
 
 AccessStrategy::FaceInfo::FaceInfo()
@@ -29,6 +29,7 @@
 #include "strategy.hpp"
 #include "rtt-estimator.hpp"
 #include "retx-suppression-fixed.hpp"
+#include "table/measurements-arena.hpp"
 #include <unordered_set>
 #include <unordered_map>
 
@@ -81,17 +82,11 @@ private: // StrategyInfo
     scheduler::ScopedEventId rtoTimer;
   };
 
-  /** \brief StrategyInfo in measurements table
+  /** \brief per-prefix measurements, kept in m_mtArena
    */
-  class MtInfo : public StrategyInfo
+  class MtInfo
   {
   public:
-    static constexpr int
-    getTypeId()
-    {
-      return 1011;
-    }
-
     MtInfo();
 
   public:
@@ -101,13 +96,13 @@ private: // StrategyInfo
 
   /** \brief find per-prefix measurements for Interest
    */
-  std::tuple<Name, shared_ptr<MtInfo>>
+  std::tuple<Name, MtInfo*>
   findPrefixMeasurements(const pit::Entry& pitEntry);
 
   /** \brief get or create pre-prefix measurements for incoming Data
    *  \note This function creates MtInfo but doesn't update it.
    */
-  shared_ptr<MtInfo>
+  MtInfo*
   addPrefixMeasurements(const Data& data);
 
   /** \brief global per-face StrategyInfo
@@ -166,6 +161,7 @@ public:
   static const Name STRATEGY_NAME;
 
 private:
+  MeasurementsArena<MtInfo> m_mtArena;
   FaceInfoTable m_fit;
   RetxSuppressionFixed m_retxSuppression;
   signal::ScopedConnection m_removeFaceInfoConn;
@@ -44,6 +44,26 @@ public:
   {
     this->NetworkLayerCounters::copyTo(recipient);
   }
+
+  /** \brief Dead Nonce List lookups and insertions keyed by the name hash cached on
+   *         the name tree entry, each of which saved one Name encoding and hashing
+   *
+   *  This counter is not part of ndn::nfd::ForwarderStatus, so copyTo does not export it.
+   */
+  const PacketCounter&
+  getNDeadNonceListHashReuses() const
+  {
+    return m_nDeadNonceListHashReuses;
+  }
+
+  PacketCounter&
+  getNDeadNonceListHashReuses()
+  {
+    return m_nDeadNonceListHashReuses;
+  }
+
+private:
+  PacketCounter m_nDeadNonceListHashReuses;
 };
 
 } // namespace nfd
@@ -109,7 +109,7 @@ Forwarder::Forwarder()
   , m_csFace(make_shared<NullFace>(FaceUri("contentstore://")))
   ,m_opFace(make_shared<NullFace>(FaceUri("objectprocessor://")))
 {
-  fw::installStrategies(*this);
+  m_strategyChoice.enableLazyInstall(*this);
   getFaceTable().addReserved(m_csFace, FACEID_CONTENT_STORE);
   getFaceTable().addReserved(m_opFace,FACEID_OBJECT_PROCESSOR);
 }
@@ -143,8 +143,13 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
 
   // detect duplicate Nonce
   int dnw = pitEntry->findNonce(interest.getNonce(), inFace);
-  bool hasDuplicateNonce = (dnw != pit::DUPLICATE_NONCE_NONE) ||
-                           m_deadNonceList.has(interest.getName(), interest.getNonce());
+  bool hasDuplicateNonce = dnw != pit::DUPLICATE_NONCE_NONE;
+  if (!hasDuplicateNonce) {
+    // the Interest name has just been hashed by PIT insert
+    hasDuplicateNonce = m_deadNonceList.has(m_nameTree.get(*pitEntry)->getOrderedHash(),
+                                            interest.getNonce());
+    ++m_counters.getNDeadNonceListHashReuses();
+  }
   if (hasDuplicateNonce) {
     // goto Interest loop pipeline
     this->onInterestLoop(inFace, interest, pitEntry);
@@ -686,13 +691,6 @@ Forwarder::cancelUnsatisfyAndStragglerTimer(shared_ptr<pit::Entry> pitEntry)
   scheduler::cancel(pitEntry->m_stragglerTimer);
 }
 
-static inline void
-insertNonceToDnl(DeadNonceList& dnl, const pit::Entry& pitEntry,
-                 const pit::OutRecord& outRecord)
-{
-  dnl.add(pitEntry.getName(), outRecord.getLastNonce());
-}
-
 void
 Forwarder::insertDeadNonceList(pit::Entry& pitEntry, bool isSatisfied,
                                const time::milliseconds& dataFreshnessPeriod,
@@ -714,18 +712,29 @@ Forwarder::insertDeadNonceList(pit::Entry& pitEntry, bool isSatisfied,
     return;
   }
 
+  // the name hash is cached on the name tree entry, which is still attached to the PIT entry
+  shared_ptr<name_tree::Entry> nameTreeEntry = m_nameTree.get(pitEntry);
+  size_t nameHash = nameTreeEntry != nullptr ? nameTreeEntry->getOrderedHash() :
+                                               name_tree::computeOrderedHash(pitEntry.getName());
+
   // Dead Nonce List insert
   if (upstream == 0) {
     // insert all outgoing Nonces
-    const pit::OutRecordCollection& outRecords = pitEntry.getOutRecords();
-    std::for_each(outRecords.begin(), outRecords.end(),
-                  bind(&insertNonceToDnl, ref(m_deadNonceList), cref(pitEntry), _1));
+    for (const pit::OutRecord& outRecord : pitEntry.getOutRecords()) {
+      m_deadNonceList.add(nameHash, outRecord.getLastNonce());
+      if (nameTreeEntry != nullptr) {
+        ++m_counters.getNDeadNonceListHashReuses();
+      }
+    }
   }
   else {
     // insert outgoing Nonce of a specific face
     pit::OutRecordCollection::const_iterator outRecord = pitEntry.getOutRecord(*upstream);
     if (outRecord != pitEntry.getOutRecords().end()) {
-      m_deadNonceList.add(pitEntry.getName(), outRecord->getLastNonce());
+      m_deadNonceList.add(nameHash, outRecord->getLastNonce());
+      if (nameTreeEntry != nullptr) {
+        ++m_counters.getNDeadNonceListHashReuses();
+      }
     }
   }
 }
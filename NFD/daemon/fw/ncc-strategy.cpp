@@ -58,14 +58,14 @@ NccStrategy::afterReceiveInterest(const Face& inFace,
     return;
   }
 
-  shared_ptr<PitEntryInfo> pitEntryInfo =
+  PitEntryInfo* pitEntryInfo =
     pitEntry->getOrCreateStrategyInfo<PitEntryInfo>();
   bool isNewPitEntry = !pitEntry->hasUnexpiredOutRecords();
   if (!isNewPitEntry) {
     return;
   }
 
-  shared_ptr<MeasurementsEntryInfo> measurementsEntryInfo =
+  MeasurementsEntryInfo* measurementsEntryInfo =
     this->getMeasurementsEntryInfo(pitEntry);
 
   time::microseconds deferFirst = DEFER_FIRST_WITHOUT_BEST_FACE;
@@ -128,12 +128,12 @@ NccStrategy::doPropagate(weak_ptr<pit::Entry> pitEntryWeak, weak_ptr<fib::Entry>
     return;
   }
 
-  shared_ptr<PitEntryInfo> pitEntryInfo = pitEntry->getStrategyInfo<PitEntryInfo>();
+  PitEntryInfo* pitEntryInfo = pitEntry->getStrategyInfo<PitEntryInfo>();
   // pitEntryInfo is guaranteed to exist here, because doPropagate is triggered
   // from a timer set by NccStrategy.
   BOOST_ASSERT(static_cast<bool>(pitEntryInfo));
 
-  shared_ptr<MeasurementsEntryInfo> measurementsEntryInfo =
+  MeasurementsEntryInfo* measurementsEntryInfo =
     this->getMeasurementsEntryInfo(pitEntry);
 
   shared_ptr<Face> previousFace = measurementsEntryInfo->previousFace.lock();
@@ -179,7 +179,7 @@ NccStrategy::timeoutOnBestFace(weak_ptr<pit::Entry> pitEntryWeak)
     }
     this->getMeasurements().extendLifetime(*measurementsEntry, MEASUREMENTS_LIFETIME);
 
-    shared_ptr<MeasurementsEntryInfo> measurementsEntryInfo =
+    MeasurementsEntryInfo* measurementsEntryInfo =
       this->getMeasurementsEntryInfo(measurementsEntry);
     measurementsEntryInfo->adjustPredictUp();
 
@@ -206,40 +206,39 @@ NccStrategy::beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry,
     }
     this->getMeasurements().extendLifetime(*measurementsEntry, MEASUREMENTS_LIFETIME);
 
-    shared_ptr<MeasurementsEntryInfo> measurementsEntryInfo =
+    MeasurementsEntryInfo* measurementsEntryInfo =
       this->getMeasurementsEntryInfo(measurementsEntry);
     measurementsEntryInfo->updateBestFace(inFace);
 
     measurementsEntry = this->getMeasurements().getParent(*measurementsEntry);
   }
 
-  shared_ptr<PitEntryInfo> pitEntryInfo = pitEntry->getStrategyInfo<PitEntryInfo>();
+  PitEntryInfo* pitEntryInfo = pitEntry->getStrategyInfo<PitEntryInfo>();
   if (static_cast<bool>(pitEntryInfo)) {
     scheduler::cancel(pitEntryInfo->propagateTimer);
   }
 }
 
-shared_ptr<NccStrategy::MeasurementsEntryInfo>
+NccStrategy::MeasurementsEntryInfo*
 NccStrategy::getMeasurementsEntryInfo(shared_ptr<pit::Entry> entry)
 {
   shared_ptr<measurements::Entry> measurementsEntry = this->getMeasurements().get(*entry);
   return this->getMeasurementsEntryInfo(measurementsEntry);
 }
 
-shared_ptr<NccStrategy::MeasurementsEntryInfo>
+NccStrategy::MeasurementsEntryInfo*
 NccStrategy::getMeasurementsEntryInfo(shared_ptr<measurements::Entry> entry)
 {
-  shared_ptr<MeasurementsEntryInfo> info = entry->getStrategyInfo<MeasurementsEntryInfo>();
-  if (static_cast<bool>(info)) {
+  MeasurementsEntryInfo* info = nullptr;
+  bool isNew = false;
+  std::tie(info, isNew) = m_measurementsArena.insert(*entry);
+  if (!isNew) {
     return info;
   }
 
-  info = make_shared<MeasurementsEntryInfo>();
-  entry->setStrategyInfo(info);
-
   shared_ptr<measurements::Entry> parentEntry = this->getMeasurements().getParent(*entry);
   if (static_cast<bool>(parentEntry)) {
-    shared_ptr<MeasurementsEntryInfo> parentInfo = this->getMeasurementsEntryInfo(parentEntry);
+    MeasurementsEntryInfo* parentInfo = this->getMeasurementsEntryInfo(parentEntry);
     BOOST_ASSERT(static_cast<bool>(parentInfo));
     info->inheritFrom(*parentInfo);
   }
@@ -27,6 +27,7 @@
 #define NFD_DAEMON_FW_NCC_STRATEGY_HPP
 
 #include "strategy.hpp"
+#include "table/measurements-arena.hpp"
 
 namespace nfd {
 namespace fw {
@@ -52,16 +53,10 @@ public:
                         const Face& inFace, const Data& data) DECL_OVERRIDE;
 
 protected:
-  /// StrategyInfo on measurements::Entry
-  class MeasurementsEntryInfo : public StrategyInfo
+  /// per-prefix measurements, kept in m_measurementsArena
+  class MeasurementsEntryInfo
   {
   public:
-    static constexpr int
-    getTypeId()
-    {
-      return 1000;
-    }
-
     MeasurementsEntryInfo();
 
     void
@@ -118,10 +113,10 @@ protected:
   };
 
 protected:
-  shared_ptr<MeasurementsEntryInfo>
+  MeasurementsEntryInfo*
   getMeasurementsEntryInfo(shared_ptr<measurements::Entry> entry);
 
-  shared_ptr<MeasurementsEntryInfo>
+  MeasurementsEntryInfo*
   getMeasurementsEntryInfo(shared_ptr<pit::Entry> entry);
 
   /// propagate to another upstream
@@ -140,6 +135,9 @@ protected:
   static const time::microseconds DEFER_RANGE_WITHOUT_BEST_FACE;
   static const int UPDATE_MEASUREMENTS_N_LEVELS = 2;
   static const time::nanoseconds MEASUREMENTS_LIFETIME;
+
+private:
+  MeasurementsArena<MeasurementsEntryInfo> m_measurementsArena;
 };
 
 } // namespace fw
@@ -35,6 +35,8 @@ NFD_REGISTER_STRATEGY(OONRouteStrategy);
 
 OONRouteStrategy::OONRouteStrategy(Forwarder& forwarder, const Name& name)
   : Strategy(forwarder, name)
+  , m_objectCostJudge(10000000)
+  , m_lastTimeCost(m_objectCostJudge)
 {
 }
 
@@ -42,22 +44,22 @@ OONRouteStrategy::~OONRouteStrategy()
 {
 }
 
-static inline bool
-predicate_PitEntry_canForwardTo_NextHop(shared_ptr<pit::Entry> pitEntry,
-                                        const fib::NextHop& nexthop)
+bool
+OONRouteStrategy::canForwardToNextHop(shared_ptr<pit::Entry> pitEntry,
+                                       const fib::NextHop& nexthop)
 {
-  last_time_cost = 1.2*OBJECT_COST_JUDGE;
-  OBJECT_COST_JUDGE = nexthop.getCost(); //current cost
-  return  pitEntry->canForwardTo(*nexthop.getFace()) && OBJECT_COST_JUDGE<last_time_cost;
+  m_lastTimeCost = 1.2 * m_objectCostJudge;
+  m_objectCostJudge = nexthop.getCost(); //current cost
+  return pitEntry->canForwardTo(*nexthop.getFace()) && m_objectCostJudge < m_lastTimeCost;
 }
 
-static inline bool
-predicate_PitEntry_canForwardTo_ObjectProcessor(shared_ptr<pit::Entry> pitEntry,
-                                        const fib::NextHop& nexthop)
-{ 
-  last_time_cost = 1.2*OBJECT_COST_JUDGE; //1.2 is a parameter
-  OBJECT_COST_JUDGE = nexthop.getCost();//current cost
-  return pitEntry->canForwardTo(*nexthop.getFace()) && OBJECT_COST_JUDGE>=last_time_cost;
+bool
+OONRouteStrategy::canForwardToObjectProcessor(shared_ptr<pit::Entry> pitEntry,
+                                               const fib::NextHop& nexthop)
+{
+  m_lastTimeCost = 1.2 * m_objectCostJudge; //1.2 is a parameter
+  m_objectCostJudge = nexthop.getCost(); //current cost
+  return pitEntry->canForwardTo(*nexthop.getFace()) && m_objectCostJudge >= m_lastTimeCost;
 }
 
 void
@@ -73,13 +75,13 @@ OONRouteStrategy::afterReceiveInterest(const Face& inFace,
 
   const fib::NextHopList& nexthops = fibEntry->getNextHops();
   fib::NextHopList::const_iterator it = std::find_if(nexthops.begin(), nexthops.end(),
-    bind(&predicate_PitEntry_canForwardTo_NextHop, pitEntry, _1));
+    bind(&OONRouteStrategy::canForwardToNextHop, this, pitEntry, _1));
 
   if (it == nexthops.end()){
     //OON
     //std::cout<<"op";
     fib::NextHopList::const_iterator it_op = std::find_if(nexthops.begin(), nexthops.end(),
-    bind(&predicate_PitEntry_canForwardTo_ObjectProcessor, pitEntry, _1));
+    bind(&OONRouteStrategy::canForwardToObjectProcessor, this, pitEntry, _1));
      if(it_op == nexthops.end()){
       this->rejectPendingInterest(pitEntry);
      }
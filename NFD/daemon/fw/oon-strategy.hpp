@@ -35,9 +35,6 @@ namespace fw {
  *
  *  this strategy enables Object Processor based on simple link cost judegement
  */
-uint64_t OBJECT_COST_JUDGE=10000000;
-uint64_t last_time_cost = OBJECT_COST_JUDGE;
-
 class OONRouteStrategy : public Strategy
 {
 public:
@@ -52,8 +49,21 @@ public:
                        shared_ptr<fib::Entry> fibEntry,
                        shared_ptr<pit::Entry> pitEntry) DECL_OVERRIDE;
 
+private:
+  bool
+  canForwardToNextHop(shared_ptr<pit::Entry> pitEntry, const fib::NextHop& nexthop);
+
+  bool
+  canForwardToObjectProcessor(shared_ptr<pit::Entry> pitEntry, const fib::NextHop& nexthop);
+
 public:
   static const Name STRATEGY_NAME;
+
+private:
+  /** \brief cost of the nexthop judged last, kept per strategy instance (i.e., per node)
+   */
+  uint64_t m_objectCostJudge;
+  uint64_t m_lastTimeCost;
 };
 
 } // namespace fw
@@ -43,6 +43,14 @@ public:
     return 1020;
   }
 
+  /** \brief placed apart from the strategy's own StrategyInfo on the same PIT entry
+   */
+  static constexpr size_t
+  getSlotId()
+  {
+    return 1;
+  }
+
   explicit
   PitInfo(const Duration& initialInterval)
     : suppressionInterval(initialInterval)
@@ -81,7 +89,7 @@ RetxSuppressionExponential::decide(const Face& inFace, const Interest& interest,
   time::steady_clock::TimePoint now = time::steady_clock::now();
   time::steady_clock::Duration sinceLastOutgoing = now - lastOutgoing;
 
-  shared_ptr<PitInfo> pi = pitEntry.getOrCreateStrategyInfo<PitInfo>(m_initialInterval);
+  PitInfo* pi = pitEntry.getOrCreateStrategyInfo<PitInfo>(m_initialInterval);
   bool shouldSuppress = sinceLastOutgoing < pi->suppressionInterval;
 
   if (shouldSuppress) {
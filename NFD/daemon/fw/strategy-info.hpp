@@ -46,6 +46,23 @@ public:
   //   return <type-identifier>;
   // }
 
+  /** \brief number of slots in a StrategyInfoHost
+   */
+  static constexpr size_t N_SLOTS = 2;
+
+  /** \return index of the StrategyInfoHost slot this StrategyInfo type occupies
+   *
+   *  Only one StrategyInfo can be stored per slot on a table entry.  A forwarding strategy
+   *  uses slot 0 for its own items; helpers that attach their own StrategyInfo onto the same
+   *  entries as the strategy (e.g. RetxSuppressionExponential) shall override this to pick
+   *  another slot.
+   */
+  static constexpr size_t
+  getSlotId()
+  {
+    return 0;
+  }
+
   virtual
   ~StrategyInfo();
 };
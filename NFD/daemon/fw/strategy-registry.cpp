@@ -53,11 +53,55 @@ installStrategies(Forwarder& forwarder)
 {
   StrategyChoice& sc = forwarder.getStrategyChoice();
   for (const auto& pair : getStrategyFactories()) {
-    if (!sc.hasStrategy(pair.first, true)) {
+    if (!sc.isInstalled(pair.first)) {
       sc.install(pair.second(forwarder));
     }
   }
 }
 
+std::pair<bool, Name>
+findRegisteredStrategy(const Name& strategyName, bool isExact)
+{
+  const std::map<Name, StrategyCreateFunc>& factories = getStrategyFactories();
+  if (isExact) {
+    return { factories.count(strategyName) > 0, strategyName };
+  }
+
+  // same rules as StrategyChoice::getStrategy: exact match, or the last (latest) version
+  std::pair<bool, Name> candidate(false, Name());
+  for (auto it = factories.lower_bound(strategyName);
+       it != factories.end() && strategyName.isPrefixOf(it->first); ++it) {
+    switch (it->first.size() - strategyName.size()) {
+    case 0: // exact match
+      return { true, it->first };
+    case 1: // unversioned strategyName matches versioned strategy
+      candidate = { true, it->first };
+      break;
+    }
+  }
+  return candidate;
+}
+
+shared_ptr<Strategy>
+makeRegisteredStrategy(const Name& strategyName, Forwarder& forwarder)
+{
+  const std::map<Name, StrategyCreateFunc>& factories = getStrategyFactories();
+  auto it = factories.find(strategyName);
+  if (it == factories.end()) {
+    return nullptr;
+  }
+  return it->second(forwarder);
+}
+
+std::vector<Name>
+listRegisteredStrategies()
+{
+  std::vector<Name> names;
+  for (const auto& pair : getStrategyFactories()) {
+    names.push_back(pair.first);
+  }
+  return names;
+}
+
 } // namespace fw
 } // namespace nfd
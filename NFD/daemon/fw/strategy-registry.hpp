@@ -39,9 +39,35 @@ class Strategy;
 shared_ptr<Strategy>
 makeDefaultStrategy(Forwarder& forwarder);
 
+/** \brief installs all registered strategies on forwarder
+ *
+ *  Forwarder enables on-demand installation instead (StrategyChoice::enableLazyInstall),
+ *  so only strategies that are actually selected get instantiated.
+ */
 void
 installStrategies(Forwarder& forwarder);
 
+/** \brief finds a registered strategy
+ *  \param strategyName a versioned or unversioned strategyName
+ *  \param isExact true to require exact match, false to permit unversioned strategyName
+ *  \return true and the versioned name of the registered strategy (the latest version
+ *          for unversioned strategyName), or false if none is registered
+ */
+std::pair<bool, Name>
+findRegisteredStrategy(const Name& strategyName, bool isExact = false);
+
+/** \brief creates an instance of a registered strategy
+ *  \param strategyName exact name of a registered strategy
+ *  \return the instance, or nullptr if strategyName is not registered
+ */
+shared_ptr<Strategy>
+makeRegisteredStrategy(const Name& strategyName, Forwarder& forwarder);
+
+/** \return names of all registered strategies
+ */
+std::vector<Name>
+listRegisteredStrategies();
+
 
 typedef std::function<shared_ptr<Strategy>(Forwarder&)> StrategyCreateFunc;
 
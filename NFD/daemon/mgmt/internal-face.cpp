@@ -50,6 +50,14 @@ InternalFace::sendInterest(const Interest& interest)
 void
 InternalFace::processInterest(const shared_ptr<const Interest>& interest)
 {
+  if (static_cast<bool>(m_filterInitializer))
+    {
+      function<void()> initializer;
+      initializer.swap(m_filterInitializer);
+      NFD_LOG_DEBUG("initializing Interest filters");
+      initializer();
+    }
+
   if (m_interestFilters.size() == 0)
     {
       NFD_LOG_DEBUG("no Interest filters to match against");
@@ -139,6 +147,12 @@ InternalFace::setInterestFilter(const Name& filter,
   m_interestFilters[filter] = onInterest;
 }
 
+void
+InternalFace::setFilterInitializer(const function<void()>& initializer)
+{
+  m_filterInitializer = initializer;
+}
+
 void
 InternalFace::put(const Data& data)
 {
@@ -77,12 +77,21 @@ public:
   virtual void
   put(const Data& data);
 
+  /** \brief set a function to be invoked once, before the first Interest is processed
+   *
+   *  Allows management modules to be created (and Interest filters to be registered)
+   *  only when the first management Interest arrives.
+   */
+  void
+  setFilterInitializer(const function<void()>& initializer);
+
 private:
   void
   processInterest(const shared_ptr<const Interest>& interest);
 
 private:
   std::map<Name, OnInterest> m_interestFilters;
+  function<void()> m_filterInitializer;
   CommandValidator m_validator;
 };
 
@@ -75,6 +75,14 @@ LruPolicy::evictEntries()
   }
 }
 
+void
+LruPolicy::doForEachInEvictionOrder(const function<void(const Entry&)>& visitor) const
+{
+  for (const iterator& i : m_queue) {
+    visitor(*i);
+  }
+}
+
 void
 LruPolicy::insertToQueue(iterator i, bool isNewEntry)
 {
@@ -86,6 +86,9 @@ private:
   virtual void
   evictEntries() DECL_OVERRIDE;
 
+  virtual void
+  doForEachInEvictionOrder(const function<void(const Entry&)>& visitor) const DECL_OVERRIDE;
+
 private:
   /** \brief moves an entry to the end of queue
    */
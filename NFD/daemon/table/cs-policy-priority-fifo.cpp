@@ -74,6 +74,16 @@ PriorityFifoPolicy::evictEntries()
   }
 }
 
+void
+PriorityFifoPolicy::doForEachInEvictionOrder(const function<void(const Entry&)>& visitor) const
+{
+  for (const Queue& queue : m_queues) {
+    for (const iterator& i : queue) {
+      visitor(*i);
+    }
+  }
+}
+
 void
 PriorityFifoPolicy::evictOne()
 {
@@ -112,7 +122,9 @@ PriorityFifoPolicy::attachQueue(iterator i)
     entryInfo->queueType = QUEUE_FIFO;
 
     if (i->canStale()) {
-      entryInfo->moveStaleEventId = scheduler::schedule(i->getData().getFreshnessPeriod(),
+      // stale time differs from FreshnessPeriod if the entry was restored from a saved CS
+      time::nanoseconds freshness = i->getStaleTime() - time::steady_clock::now();
+      entryInfo->moveStaleEventId = scheduler::schedule(freshness,
                                               bind(&PriorityFifoPolicy::moveToStaleQueue, this, i));
     }
   }
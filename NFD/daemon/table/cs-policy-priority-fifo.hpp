@@ -94,6 +94,9 @@ private:
   virtual void
   evictEntries() DECL_OVERRIDE;
 
+  virtual void
+  doForEachInEvictionOrder(const function<void(const Entry&)>& visitor) const DECL_OVERRIDE;
+
 private:
   /** \brief evicts one entry
    *  \pre CS is not empty
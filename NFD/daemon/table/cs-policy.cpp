@@ -75,5 +75,20 @@ Policy::beforeUse(iterator i)
   this->doBeforeUse(i);
 }
 
+void
+Policy::forEachInEvictionOrder(const function<void(const Entry&)>& visitor) const
+{
+  BOOST_ASSERT(m_cs != nullptr);
+  this->doForEachInEvictionOrder(visitor);
+}
+
+void
+Policy::doForEachInEvictionOrder(const function<void(const Entry&)>& visitor) const
+{
+  for (const Entry& entry : *m_cs) {
+    visitor(entry);
+  }
+}
+
 } // namespace cs
 } // namespace nfd
@@ -109,6 +109,14 @@ public:
   void
   beforeUse(iterator i);
 
+  /** \brief invokes \p visitor for every entry, in the order the policy would evict them
+   *
+   *  Inserting the Data packets into an empty CS with the same policy in this order
+   *  recreates the eviction order.  This is used to save and restore the ContentStore.
+   */
+  void
+  forEachInEvictionOrder(const function<void(const Entry&)>& visitor) const;
+
 protected:
   /** \brief invoked after a new entry is created in CS
    *
@@ -152,6 +160,14 @@ protected:
   virtual void
   evictEntries() = 0;
 
+  /** \brief enumerates entries in eviction order
+   *
+   *  The default implementation enumerates entries in Name order.
+   *  A policy implementation should override it to expose its cleanup index.
+   */
+  virtual void
+  doForEachInEvictionOrder(const function<void(const Entry&)>& visitor) const;
+
 protected:
   DECLARE_SIGNAL_EMIT(beforeEvict)
 
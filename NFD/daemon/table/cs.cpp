@@ -80,6 +80,18 @@ Cs::setPolicy(unique_ptr<Policy> policy)
 
 bool
 Cs::insert(const Data& data, bool isUnsolicited)
+{
+  return this->insertImpl(data, isUnsolicited, nullptr);
+}
+
+bool
+Cs::insert(const Data& data, bool isUnsolicited, const time::steady_clock::TimePoint& staleTime)
+{
+  return this->insertImpl(data, isUnsolicited, &staleTime);
+}
+
+bool
+Cs::insertImpl(const Data& data, bool isUnsolicited, const time::steady_clock::TimePoint* staleTime)
 {
   NFD_LOG_DEBUG("insert " << data.getName());
 
@@ -99,7 +111,12 @@ Cs::insert(const Data& data, bool isUnsolicited)
   std::tie(it, isNewEntry) = m_table.insert(EntryImpl(data.shared_from_this(), isUnsolicited));
   EntryImpl& entry = const_cast<EntryImpl&>(*it);
 
-  entry.updateStaleTime();
+  if (staleTime != nullptr) {
+    entry.setStaleTime(*staleTime);
+  }
+  else {
+    entry.updateStaleTime();
+  }
 
   if (!isNewEntry) { // existing entry
     // XXX This doesn't forbid unsolicited Data from refreshing a solicited entry.
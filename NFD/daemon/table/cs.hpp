@@ -74,6 +74,15 @@ public:
   bool
   insert(const Data& data, bool isUnsolicited = false);
 
+  /** \brief inserts a Data packet that becomes stale at \p staleTime
+   *
+   *  Unlike insert(data, isUnsolicited), stale time is not computed from the FreshnessPeriod.
+   *  This is used to restore a saved ContentStore.
+   *  \return true
+   */
+  bool
+  insert(const Data& data, bool isUnsolicited, const time::steady_clock::TimePoint& staleTime);
+
   typedef std::function<void(const Interest&, const Data& data)> HitCallback;
   typedef std::function<void(const Interest&)> MissCallback;
 
@@ -178,6 +187,11 @@ private: // find
   iterator
   findRightmostAmongExact(const Interest& interest, iterator first, iterator last) const;
 
+  /** \param staleTime stale time of the entry, or nullptr to compute it from FreshnessPeriod
+   */
+  bool
+  insertImpl(const Data& data, bool isUnsolicited, const time::steady_clock::TimePoint* staleTime);
+
   void
   setPolicyImpl(unique_ptr<Policy>& policy);
 
@@ -24,6 +24,7 @@
  */
 
 #include "dead-nonce-list.hpp"
+#include "name-tree.hpp"
 #include "core/city-hash.hpp"
 #include "core/logger.hpp"
 
@@ -44,33 +45,32 @@ const size_t DeadNonceList::EVICT_LIMIT = (1 << 6);
 
 DeadNonceList::DeadNonceList(const time::nanoseconds& lifetime)
   : m_lifetime(lifetime)
-  , m_queue(m_index.get<0>())
-  , m_ht(m_index.get<1>())
+  , m_queue(INITIAL_CAPACITY * 2, MARK)
+  , m_queueHead(0)
+  , m_queueSize(0)
+  , m_table(INITIAL_CAPACITY * 2, MARK)
+  , m_nMarks(0)
   , m_capacity(INITIAL_CAPACITY)
   , m_markInterval(m_lifetime / EXPECTED_MARK_COUNT)
-  , m_adjustCapacityInterval(m_lifetime)
 {
   if (m_lifetime < MIN_LIFETIME) {
     BOOST_THROW_EXCEPTION(std::invalid_argument("lifetime is less than MIN_LIFETIME"));
   }
 
   for (size_t i = 0; i < EXPECTED_MARK_COUNT; ++i) {
-    m_queue.push_back(MARK);
+    this->pushBack(MARK);
   }
 
-  m_markEvent = scheduler::schedule(m_markInterval, bind(&DeadNonceList::mark, this));
-  m_adjustCapacityEvent = scheduler::schedule(m_adjustCapacityInterval,
-                                              bind(&DeadNonceList::adjustCapacity, this));
+  m_lastMarkPeriod = time::steady_clock::now().time_since_epoch() / m_markInterval;
 }
 
 DeadNonceList::~DeadNonceList()
 {
-  scheduler::cancel(m_markEvent);
-  scheduler::cancel(m_adjustCapacityEvent);
-
   BOOST_ASSERT_MSG(DEFAULT_LIFETIME >= MIN_LIFETIME, "DEFAULT_LIFETIME is too small");
   static_assert(INITIAL_CAPACITY >= MIN_CAPACITY, "INITIAL_CAPACITY is too small");
   static_assert(INITIAL_CAPACITY <= MAX_CAPACITY, "INITIAL_CAPACITY is too large");
+  static_assert((INITIAL_CAPACITY & (INITIAL_CAPACITY - 1)) == 0,
+                "INITIAL_CAPACITY must be a power of two");
   BOOST_ASSERT_MSG(static_cast<size_t>(MIN_CAPACITY * CAPACITY_UP) > MIN_CAPACITY,
                    "CAPACITY_UP must be able to increase from MIN_CAPACITY");
   BOOST_ASSERT_MSG(static_cast<size_t>(MAX_CAPACITY * CAPACITY_DOWN) < MAX_CAPACITY,
@@ -83,54 +83,191 @@ DeadNonceList::~DeadNonceList()
 size_t
 DeadNonceList::size() const
 {
-  return m_queue.size() - this->countMarks();
+  return m_queueSize - this->countMarks();
 }
 
 bool
 DeadNonceList::has(const Name& name, uint32_t nonce) const
 {
-  Entry entry = DeadNonceList::makeEntry(name, nonce);
-  return m_ht.find(entry) != m_ht.end();
+  return this->has(name_tree::computeOrderedHash(name), nonce);
+}
+
+bool
+DeadNonceList::has(size_t nameHash, uint32_t nonce) const
+{
+  Entry entry = DeadNonceList::makeEntry(nameHash, nonce);
+  return this->findInTable(entry);
 }
 
 void
 DeadNonceList::add(const Name& name, uint32_t nonce)
 {
-  Entry entry = DeadNonceList::makeEntry(name, nonce);
-  m_queue.push_back(entry);
+  this->add(name_tree::computeOrderedHash(name), nonce);
+}
+
+void
+DeadNonceList::add(size_t nameHash, uint32_t nonce)
+{
+  this->advanceClock();
+
+  Entry entry = DeadNonceList::makeEntry(nameHash, nonce);
+  this->pushBack(entry);
 
   this->evictEntries();
 }
 
 DeadNonceList::Entry
-DeadNonceList::makeEntry(const Name& name, uint32_t nonce)
+DeadNonceList::makeEntry(size_t nameHash, uint32_t nonce)
 {
-  Block nameWire = name.wireEncode();
-  return CityHash64WithSeed(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size(),
-                            static_cast<uint64_t>(nonce));
+  Entry entry = Hash128to64(uint128(static_cast<uint64_t>(nameHash),
+                                    static_cast<uint64_t>(nonce)));
+  // MARK also denotes an empty hash table slot
+  return entry == MARK ? ~MARK : entry;
+}
+
+void
+DeadNonceList::pushBack(Entry entry)
+{
+  if (m_queueSize == m_queue.size()) {
+    this->growQueue();
+  }
+  m_queue[(m_queueHead + m_queueSize) & (m_queue.size() - 1)] = entry;
+  ++m_queueSize;
+
+  if (entry == MARK) {
+    ++m_nMarks;
+    return;
+  }
+
+  if ((m_queueSize - m_nMarks) * 2 > m_table.size()) {
+    this->rehashTable(m_table.size() * 2);
+  }
+  this->insertToTable(entry);
+}
+
+void
+DeadNonceList::popFront()
+{
+  BOOST_ASSERT(m_queueSize > 0);
+  Entry entry = m_queue[m_queueHead];
+  m_queueHead = (m_queueHead + 1) & (m_queue.size() - 1);
+  --m_queueSize;
+
+  if (entry == MARK) {
+    --m_nMarks;
+  }
+  else {
+    this->eraseFromTable(entry);
+  }
+}
+
+void
+DeadNonceList::growQueue()
+{
+  std::vector<Entry> queue(m_queue.size() * 2, MARK);
+  for (size_t i = 0; i < m_queueSize; ++i) {
+    queue[i] = m_queue[(m_queueHead + i) & (m_queue.size() - 1)];
+  }
+  m_queue.swap(queue);
+  m_queueHead = 0;
+}
+
+bool
+DeadNonceList::findInTable(Entry entry) const
+{
+  size_t mask = m_table.size() - 1;
+  for (size_t i = entry & mask; m_table[i] != MARK; i = (i + 1) & mask) {
+    if (m_table[i] == entry) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void
+DeadNonceList::insertToTable(Entry entry)
+{
+  size_t mask = m_table.size() - 1;
+  size_t i = entry & mask;
+  while (m_table[i] != MARK) {
+    i = (i + 1) & mask;
+  }
+  m_table[i] = entry;
+}
+
+void
+DeadNonceList::eraseFromTable(Entry entry)
+{
+  size_t mask = m_table.size() - 1;
+  size_t i = entry & mask;
+  while (m_table[i] != entry) {
+    BOOST_ASSERT(m_table[i] != MARK);
+    i = (i + 1) & mask;
+  }
+
+  // backward-shift deletion: move up later entries of the probe sequence into the hole
+  for (size_t j = (i + 1) & mask; m_table[j] != MARK; j = (j + 1) & mask) {
+    size_t home = m_table[j] & mask;
+    bool isHomeInHoleToJ = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+    if (!isHomeInHoleToJ) {
+      m_table[i] = m_table[j];
+      i = j;
+    }
+  }
+  m_table[i] = MARK;
+}
+
+void
+DeadNonceList::rehashTable(size_t nSlots)
+{
+  NFD_LOG_TRACE("rehashTable nSlots=" << nSlots);
+
+  m_table.assign(nSlots, MARK);
+  for (size_t i = 0; i < m_queueSize; ++i) {
+    Entry entry = m_queue[(m_queueHead + i) & (m_queue.size() - 1)];
+    if (entry != MARK) {
+      this->insertToTable(entry);
+    }
+  }
 }
 
 size_t
 DeadNonceList::countMarks() const
 {
-  return m_ht.count(MARK);
+  return m_nMarks;
+}
+
+void
+DeadNonceList::advanceClock()
+{
+  int64_t period = time::steady_clock::now().time_since_epoch() / m_markInterval;
+  while (m_lastMarkPeriod < period) {
+    ++m_lastMarkPeriod;
+    if (m_lastMarkPeriod % static_cast<int64_t>(EXPECTED_MARK_COUNT) == 0) {
+      this->adjustCapacity();
+    }
+    this->mark();
+  }
 }
 
 void
 DeadNonceList::mark()
 {
-  m_queue.push_back(MARK);
+  this->pushBack(MARK);
   size_t nMarks = this->countMarks();
   m_actualMarkCounts.insert(nMarks);
 
   NFD_LOG_TRACE("mark nMarks=" << nMarks);
-
-  scheduler::schedule(m_markInterval, bind(&DeadNonceList::mark, this));
 }
 
 void
 DeadNonceList::adjustCapacity()
 {
+  if (m_actualMarkCounts.empty()) {
+    // first adjustment on the shared clock happens before any MARK of this instance
+    return;
+  }
+
   std::pair<std::multiset<size_t>::iterator, std::multiset<size_t>::iterator> equalRange =
     m_actualMarkCounts.equal_range(EXPECTED_MARK_COUNT);
 
@@ -151,21 +288,24 @@ DeadNonceList::adjustCapacity()
 
   this->evictEntries();
 
-  m_adjustCapacityEvent = scheduler::schedule(m_adjustCapacityInterval,
-                                              bind(&DeadNonceList::adjustCapacity, this));
+  // give back memory if the table has become much larger than needed
+  size_t nEntries = m_queueSize - m_nMarks;
+  if (m_table.size() > INITIAL_CAPACITY * 2 && nEntries * 8 < m_table.size()) {
+    this->rehashTable(m_table.size() / 2);
+  }
 }
 
 void
 DeadNonceList::evictEntries()
 {
-  ssize_t nOverCapacity = m_queue.size() - m_capacity;
+  ssize_t nOverCapacity = m_queueSize - m_capacity;
   if (nOverCapacity <= 0) // not over capacity
     return;
 
   for (ssize_t nEvict = std::min<ssize_t>(nOverCapacity, EVICT_LIMIT); nEvict > 0; --nEvict) {
-    m_queue.erase(m_queue.begin());
+    this->popFront();
   }
-  BOOST_ASSERT(m_queue.size() >= m_capacity);
+  BOOST_ASSERT(m_queueSize >= m_capacity);
 }
 
 } // namespace nfd
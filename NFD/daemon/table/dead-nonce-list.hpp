@@ -27,10 +27,6 @@
 #define NFD_DAEMON_TABLE_DEAD_NONCE_LIST_HPP
 
 #include "common.hpp"
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/sequenced_index.hpp>
-#include <boost/multi_index/hashed_index.hpp>
-#include "core/scheduler.hpp"
 
 namespace nfd {
 
@@ -45,11 +41,23 @@ namespace nfd {
  *  but the probability is small, and the error is recoverable when consumer retransmits
  *  with a different Nonce.
  *
+ *  The hash is derived from the order-sensitive NameTree hash of the Interest Name
+ *  (name_tree::computeOrderedHash), so that the forwarding pipelines can pass the hash
+ *  cached on the name tree entry instead of having the name encoded and hashed again.
+ *
  *  To reduce memory usage, entries do not have associated timestamps. Instead,
  *  lifetime of entries is controlled by dynamically adjusting the capacity of the container.
  *  At fixed intervals, the MARK, an entry with a special value, is inserted into the container.
  *  The number of MARKs stored in the container reflects the lifetime of entries,
  *  because MARKs are inserted at fixed intervals.
+ *
+ *  Entries are kept in insertion order in a ring buffer, and non-MARK entries are additionally
+ *  stored in an open-addressed hash table, so that each entry costs two 64-bit words plus
+ *  table slack and no heap node.
+ *
+ *  MARKs are not driven by scheduled events.  The intervals are aligned to the simulation clock,
+ *  which is shared by all Dead Nonce Lists, and MARKs and capacity adjustments that are due are
+ *  applied lazily when an entry is added.
  */
 class DeadNonceList : noncopyable
 {
@@ -72,11 +80,24 @@ public:
   bool
   has(const Name& name, uint32_t nonce) const;
 
+  /** \brief determines if name+nonce exists
+   *  \param nameHash hash of the name, as computed by name_tree::computeOrderedHash
+   *  \return true if name+nonce exists
+   */
+  bool
+  has(size_t nameHash, uint32_t nonce) const;
+
   /** \brief records name+nonce
    */
   void
   add(const Name& name, uint32_t nonce);
 
+  /** \brief records name+nonce
+   *  \param nameHash hash of the name, as computed by name_tree::computeOrderedHash
+   */
+  void
+  add(size_t nameHash, uint32_t nonce);
+
   /** \return number of stored Nonces
    *  \note The return value does not contain non-Nonce entries in the index, if any.
    */
@@ -92,20 +113,42 @@ private: // Entry and Index
   typedef uint64_t Entry;
 
   static Entry
-  makeEntry(const Name& name, uint32_t nonce);
+  makeEntry(size_t nameHash, uint32_t nonce);
 
-  typedef boost::multi_index_container<
-    Entry,
-    boost::multi_index::indexed_by<
-      boost::multi_index::sequenced<>,
-      boost::multi_index::hashed_non_unique<
-        boost::multi_index::identity<Entry>
-      >
-    >
-  > Index;
+  /** \brief appends an entry or a MARK to the queue
+   */
+  void
+  pushBack(Entry entry);
 
-  typedef Index::nth_index<0>::type Queue;
-  typedef Index::nth_index<1>::type Hashtable;
+  /** \brief removes the oldest entry or MARK from the queue
+   */
+  void
+  popFront();
+
+  /** \brief doubles the ring buffer, keeping queue order
+   */
+  void
+  growQueue();
+
+  /** \return whether \p entry is in the hash table
+   */
+  bool
+  findInTable(Entry entry) const;
+
+  /** \brief inserts \p entry into the hash table; duplicates occupy separate slots
+   */
+  void
+  insertToTable(Entry entry);
+
+  /** \brief erases one occurrence of \p entry from the hash table
+   */
+  void
+  eraseFromTable(Entry entry);
+
+  /** \brief resizes the hash table to \p nSlots and reinserts the queued entries
+   */
+  void
+  rehashTable(size_t nSlots);
 
 private: // actual lifetime estimation and capacity control
   /** \return number of MARKs in the index
@@ -113,6 +156,11 @@ private: // actual lifetime estimation and capacity control
   size_t
   countMarks() const;
 
+  /** \brief applies MARKs and capacity adjustments that are due at current time
+   */
+  void
+  advanceClock();
+
   /** \brief add a MARK, then record number of MARKs in m_actualMarkCounts
    */
   void
@@ -140,9 +188,22 @@ public:
 
 private:
   time::nanoseconds m_lifetime;
-  Index m_index;
-  Queue& m_queue;
-  Hashtable& m_ht;
+
+  /** \brief ring buffer of entries and MARKs in insertion order
+   *
+   *  The size of the buffer is a power of two.
+   */
+  std::vector<Entry> m_queue;
+  size_t m_queueHead;
+  size_t m_queueSize;
+
+  /** \brief open-addressed hash table with linear probing
+   *
+   *  The size of the table is a power of two; empty slots contain MARK.
+   */
+  std::vector<Entry> m_table;
+
+  size_t m_nMarks;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE: // actual lifetime estimation and capacity control
 
@@ -194,7 +255,12 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // actual lifetime estimation and capacity contr
 
   time::nanoseconds m_markInterval;
 
-  scheduler::EventId m_markEvent;
+  /** \brief number of the last mark interval that has been applied
+   *
+   *  Mark intervals are numbered from the start of the simulation clock.
+   *  Capacity is adjusted every EXPECTED_MARK_COUNT intervals, i.e. once per lifetime.
+   */
+  int64_t m_lastMarkPeriod;
 
   // ---- capacity adjustments
 
@@ -202,10 +268,6 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // actual lifetime estimation and capacity contr
 
   static const double CAPACITY_DOWN;
 
-  time::nanoseconds m_adjustCapacityInterval;
-
-  scheduler::EventId m_adjustCapacityEvent;
-
   /** \brief maximum number of entries to evict at each operation if index is over capacity
    */
   static const size_t EVICT_LIMIT;
@@ -24,12 +24,13 @@
  */
 
 #include "fib-entry.hpp"
+#include "core/name-interner.hpp"
 
 namespace nfd {
 namespace fib {
 
 Entry::Entry(const Name& prefix)
-  : m_prefix(prefix)
+  : m_prefix(internName(prefix))
 {
 }
 
@@ -102,7 +102,7 @@ private:
   sortNextHops();
 
 private:
-  Name m_prefix;
+  shared_ptr<const Name> m_prefix; // interned, see internName
   NextHopList m_nextHops;
 
   shared_ptr<name_tree::Entry> m_nameTreeEntry;
@@ -114,7 +114,7 @@ private:
 inline const Name&
 Entry::getPrefix() const
 {
-  return m_prefix;
+  return *m_prefix;
 }
 
 inline const NextHopList&
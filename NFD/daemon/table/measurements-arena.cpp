@@ -0,0 +1,77 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "measurements-arena.hpp"
+
+namespace nfd {
+
+MeasurementsArenaBase::MeasurementsArenaBase()
+{
+}
+
+MeasurementsArenaBase::~MeasurementsArenaBase()
+{
+  for (measurements::Entry* entry : m_entries) {
+    if (entry != nullptr) {
+      entry->m_arena = nullptr;
+      entry->m_prefixId = 0;
+    }
+  }
+}
+
+size_t
+MeasurementsArenaBase::attach(measurements::Entry& entry)
+{
+  BOOST_ASSERT(!this->isAttached(entry));
+  entry.releasePrefixId();
+
+  size_t prefixId = 0;
+  if (m_freeIds.empty()) {
+    prefixId = m_entries.size();
+    m_entries.push_back(&entry);
+  }
+  else {
+    prefixId = m_freeIds.back();
+    m_freeIds.pop_back();
+    m_entries[prefixId] = &entry;
+  }
+
+  entry.m_arena = this;
+  entry.m_prefixId = prefixId;
+  return prefixId;
+}
+
+void
+MeasurementsArenaBase::release(measurements::Entry& entry)
+{
+  BOOST_ASSERT(this->isAttached(entry));
+  BOOST_ASSERT(m_entries[entry.m_prefixId] == &entry);
+
+  m_entries[entry.m_prefixId] = nullptr;
+  m_freeIds.push_back(entry.m_prefixId);
+}
+
+} // namespace nfd
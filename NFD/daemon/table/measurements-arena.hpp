@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_MEASUREMENTS_ARENA_HPP
+#define NFD_DAEMON_TABLE_MEASUREMENTS_ARENA_HPP
+
+#include "measurements-entry.hpp"
+
+namespace nfd {
+
+/** \brief allocates dense prefix ids to Measurements entries
+ *
+ *  The prefix id is stored inline in measurements::Entry, together with a pointer to the
+ *  arena that assigned it.  The entry returns the id when it is destroyed or its StrategyInfo
+ *  is cleared.  An arena that is destroyed first (strategies may go away before the
+ *  Measurements table) detaches the entries it still knows about.
+ */
+class MeasurementsArenaBase : noncopyable
+{
+public:
+  /** \return number of prefix ids in use
+   */
+  size_t
+  size() const
+  {
+    return m_entries.size() - m_freeIds.size();
+  }
+
+protected:
+  MeasurementsArenaBase();
+
+  ~MeasurementsArenaBase();
+
+  /** \return whether \p entry holds a prefix id from this arena
+   */
+  bool
+  isAttached(const measurements::Entry& entry) const
+  {
+    return entry.m_arena == this;
+  }
+
+  /** \brief assign a prefix id to \p entry, taking it away from any other arena
+   *  \pre !isAttached(entry)
+   *  \return the prefix id
+   */
+  size_t
+  attach(measurements::Entry& entry);
+
+private:
+  /** \brief take back the prefix id of \p entry
+   */
+  void
+  release(measurements::Entry& entry);
+
+private:
+  std::vector<measurements::Entry*> m_entries; // indexed by prefix id, nullptr if unused
+  std::vector<size_t> m_freeIds;
+
+  friend class measurements::Entry;
+};
+
+/** \brief contiguous storage for per-prefix strategy measurements
+ *  \tparam T type of per-prefix measurements, must be default-constructible and assignable
+ *
+ *  Measurements of all prefixes of a strategy are stored together in fixed-size chunks
+ *  indexed by the prefix id of the Measurements entry, so that a strategy touching several
+ *  prefixes per packet stays within a few cache lines, and references remain valid as the
+ *  arena grows.
+ */
+template<typename T>
+class MeasurementsArena : public MeasurementsArenaBase
+{
+public:
+  /** \brief get measurements attached to \p entry
+   *  \retval nullptr no measurements are attached
+   */
+  T*
+  find(const measurements::Entry& entry)
+  {
+    if (!this->isAttached(entry)) {
+      return nullptr;
+    }
+    return &this->at(entry.getPrefixId());
+  }
+
+  /** \brief attach default-constructed measurements to \p entry, if none is attached
+   *  \return the measurements attached to \p entry, and whether they were newly attached
+   */
+  std::pair<T*, bool>
+  insert(measurements::Entry& entry)
+  {
+    T* item = this->find(entry);
+    if (item != nullptr) {
+      return {item, false};
+    }
+
+    // ids are handed out sequentially, so at most one more chunk is needed
+    size_t prefixId = this->attach(entry);
+    if ((prefixId >> CHUNK_SHIFT) >= m_chunks.size()) {
+      m_chunks.emplace_back(new T[CHUNK_SIZE]);
+    }
+
+    T& measurements = this->at(prefixId);
+    measurements = T();
+    return {&measurements, true};
+  }
+
+  /** \return measurements by prefix id
+   */
+  T&
+  at(size_t prefixId)
+  {
+    BOOST_ASSERT((prefixId >> CHUNK_SHIFT) < m_chunks.size());
+    return m_chunks[prefixId >> CHUNK_SHIFT][prefixId & CHUNK_MASK];
+  }
+
+private:
+  static const size_t CHUNK_SHIFT = 6;
+  static const size_t CHUNK_SIZE = 1 << CHUNK_SHIFT;
+  static const size_t CHUNK_MASK = CHUNK_SIZE - 1;
+
+  std::vector<unique_ptr<T[]>> m_chunks;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_MEASUREMENTS_ARENA_HPP
@@ -23,15 +23,42 @@
  **/
 
 #include "measurements-entry.hpp"
+#include "measurements-arena.hpp"
 
 namespace nfd {
 namespace measurements {
 
 Entry::Entry(const Name& name)
   : m_name(name)
+  , m_arena(nullptr)
+  , m_prefixId(0)
   , m_expiry(time::steady_clock::TimePoint::min())
 {
 }
 
+Entry::~Entry()
+{
+  this->releasePrefixId();
+}
+
+void
+Entry::clearStrategyInfo()
+{
+  this->releasePrefixId();
+  this->StrategyInfoHost::clearStrategyInfo();
+}
+
+void
+Entry::releasePrefixId()
+{
+  if (m_arena == nullptr) {
+    return;
+  }
+
+  m_arena->release(*this);
+  m_arena = nullptr;
+  m_prefixId = 0;
+}
+
 } // namespace measurements
 } // namespace nfd
@@ -39,6 +39,7 @@ class Entry;
 }
 
 class Measurements;
+class MeasurementsArenaBase;
 
 namespace measurements {
 
@@ -51,11 +52,33 @@ public:
   explicit
   Entry(const Name& name);
 
+  virtual
+  ~Entry();
+
   const Name&
   getName() const;
 
+  /** \brief clear all StrategyInfo items, and detach from the strategy's MeasurementsArena
+   */
+  virtual void
+  clearStrategyInfo() DECL_OVERRIDE;
+
+  /** \return dense id assigned by the MeasurementsArena of the strategy measuring this entry
+   *  \pre the entry is attached to a MeasurementsArena
+   */
+  size_t
+  getPrefixId() const;
+
+private:
+  /** \brief return the prefix id to the MeasurementsArena, if attached to one
+   */
+  void
+  releasePrefixId();
+
 private:
   Name m_name;
+  MeasurementsArenaBase* m_arena;
+  size_t m_prefixId;
 
 private: // lifetime
   time::steady_clock::TimePoint m_expiry;
@@ -65,6 +88,7 @@ private: // lifetime
   friend class nfd::NameTree;
   friend class nfd::name_tree::Entry;
   friend class nfd::Measurements;
+  friend class nfd::MeasurementsArenaBase;
 };
 
 inline const Name&
@@ -73,6 +97,13 @@ Entry::getName() const
   return m_name;
 }
 
+inline size_t
+Entry::getPrefixId() const
+{
+  BOOST_ASSERT(m_arena != nullptr);
+  return m_prefixId;
+}
+
 } // namespace measurements
 } // namespace nfd
 
@@ -46,7 +46,10 @@ Node::~Node()
 
 Entry::Entry(const Name& name)
   : m_hash(0)
+  , m_orderedHash(0)
   , m_prefix(name)
+  , m_effectiveStrategy(nullptr)
+  , m_effectiveStrategyGeneration(0)
 {
 }
 
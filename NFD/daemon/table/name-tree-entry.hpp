@@ -79,6 +79,14 @@ public:
   size_t
   getHash() const;
 
+  /** \brief order-sensitive hash of the prefix, as computed by name_tree::computeOrderedHash
+   *
+   *  Unlike getHash, this value distinguishes /a/b from /b/a and /x/x/y from /y,
+   *  so it can key tables that must not confuse different names, such as the Dead Nonce List.
+   */
+  size_t
+  getOrderedHash() const;
+
   void
   setParent(shared_ptr<Entry> parent);
 
@@ -125,11 +133,24 @@ public: // attached table entries
   shared_ptr<strategy_choice::Entry>
   getStrategyChoiceEntry() const;
 
+public: // effective strategy cache
+  /** \brief memoizes the effective strategy of this entry
+   *  \param generation StrategyChoice generation at which \p strategy was determined
+   */
+  void
+  setEffectiveStrategy(fw::Strategy* strategy, uint64_t generation);
+
+  /** \return memoized effective strategy, or nullptr if it was not determined at \p generation
+   */
+  fw::Strategy*
+  getEffectiveStrategy(uint64_t generation) const;
+
 private:
   // Benefits of storing m_hash
   // 1. m_hash is compared before m_prefix is compared
   // 2. fast hash table resize support
   size_t m_hash;
+  size_t m_orderedHash; // chained from the parent's, set by NameTree::lookup
   Name m_prefix;
   shared_ptr<Entry> m_parent;     // Pointing to the parent entry.
   std::vector<shared_ptr<Entry> > m_children; // Children pointers.
@@ -137,6 +158,8 @@ private:
   std::vector<shared_ptr<pit::Entry> > m_pitEntries;
   shared_ptr<measurements::Entry> m_measurementsEntry;
   shared_ptr<strategy_choice::Entry> m_strategyChoiceEntry;
+  fw::Strategy* m_effectiveStrategy;
+  uint64_t m_effectiveStrategyGeneration;
 
   // get the Name Tree Node that is associated with this Name Tree Entry
   Node* m_node;
@@ -163,6 +186,12 @@ Entry::setHash(size_t hash)
   m_hash = hash;
 }
 
+inline size_t
+Entry::getOrderedHash() const
+{
+  return m_orderedHash;
+}
+
 inline shared_ptr<Entry>
 Entry::getParent() const
 {
@@ -217,6 +246,19 @@ Entry::getStrategyChoiceEntry() const
   return m_strategyChoiceEntry;
 }
 
+inline void
+Entry::setEffectiveStrategy(fw::Strategy* strategy, uint64_t generation)
+{
+  m_effectiveStrategy = strategy;
+  m_effectiveStrategyGeneration = generation;
+}
+
+inline fw::Strategy*
+Entry::getEffectiveStrategy(uint64_t generation) const
+{
+  return m_effectiveStrategyGeneration == generation ? m_effectiveStrategy : nullptr;
+}
+
 } // namespace name_tree
 } // namespace nfd
 
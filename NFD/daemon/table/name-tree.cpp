@@ -111,6 +111,26 @@ computeHashSet(const Name& prefix)
   return hashValueSet;
 }
 
+size_t
+computeOrderedHash(size_t parentHash, const name::Component& component)
+{
+  const char* wireFormat = reinterpret_cast<const char*>(component.wire());
+  uint128 pair(parentHash, CityHash::compute(wireFormat, component.size()));
+  return static_cast<size_t>(Hash128to64(pair));
+}
+
+size_t
+computeOrderedHash(const Name& prefix)
+{
+  prefix.wireEncode();  // guarantees prefix's wire buffer is not empty
+
+  size_t hashValue = 0;
+  for (const name::Component& component : prefix) {
+    hashValue = computeOrderedHash(hashValue, component);
+  }
+  return hashValue;
+}
+
 } // namespace name_tree
 
 NameTree::NameTree(size_t nBuckets)
@@ -167,7 +187,7 @@ NameTree::insert(const Name& prefix)
     {
       if (static_cast<bool>(node->m_entry))
         {
-          if (prefix == node->m_entry->m_prefix)
+          if (prefix == node->m_entry->getPrefix())
             {
               return std::make_pair(node->m_entry, false); // false: old entry
             }
@@ -221,6 +241,12 @@ NameTree::lookup(const Name& prefix)
         {
           m_nItems++; // Increase the counter
           entry->m_parent = parent;
+          if (static_cast<bool>(parent))
+            {
+              // temp has been encoded by insert()
+              entry->m_orderedHash = name_tree::computeOrderedHash(parent->m_orderedHash,
+                                                                   temp.get(-1));
+            }
 
           if (static_cast<bool>(parent))
             {
@@ -550,12 +576,12 @@ NameTree::dump(std::ostream& output) const
           // if the Entry exist, dump its information
           if (static_cast<bool>(entry))
             {
-              output << "Bucket" << i << "\t" << entry->m_prefix.toUri() << endl;
+              output << "Bucket" << i << "\t" << entry->getPrefix().toUri() << endl;
               output << "\t\tHash " << entry->m_hash << endl;
 
               if (static_cast<bool>(entry->m_parent))
                 {
-                  output << "\t\tparent->" << entry->m_parent->m_prefix.toUri();
+                  output << "\t\tparent->" << entry->m_parent->getPrefix().toUri();
                 }
               else
                 {
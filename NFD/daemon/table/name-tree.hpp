@@ -45,6 +45,23 @@ computeHash(const Name& prefix);
 std::vector<size_t>
 computeHashSet(const Name& prefix);
 
+/**
+ * \brief Extend the order-sensitive hash of a prefix by one more component
+ * \param parentHash order-sensitive hash of the prefix without \p component; 0 for the root
+ * \param component last component of the prefix; its wire encoding must be available
+ */
+size_t
+computeOrderedHash(size_t parentHash, const name::Component& component);
+
+/**
+ * \brief Compute the order-sensitive hash value of the given name prefix
+ *
+ * computeHash combines components with XOR, so permuted names and names differing by
+ * a pair of identical components collide. This hash chains the components instead.
+ */
+size_t
+computeOrderedHash(const Name& prefix);
+
 /// a predicate to accept or reject an Entry in find operations
 typedef function<bool (const Entry& entry)> EntrySelector;
 
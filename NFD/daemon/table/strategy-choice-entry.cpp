@@ -25,13 +25,14 @@
 
 #include "strategy-choice-entry.hpp"
 #include "core/logger.hpp"
+#include "core/name-interner.hpp"
 #include "fw/strategy.hpp"
 
 namespace nfd {
 namespace strategy_choice {
 
 Entry::Entry(const Name& prefix)
-  : m_prefix(prefix)
+  : m_prefix(internName(prefix))
   , m_strategy(nullptr)
 {
 }
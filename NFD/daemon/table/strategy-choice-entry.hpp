@@ -60,7 +60,7 @@ public:
   setStrategy(fw::Strategy& strategy);
 
 private:
-  Name m_prefix;
+  shared_ptr<const Name> m_prefix; // interned, see internName
   fw::Strategy* m_strategy;
 
   shared_ptr<name_tree::Entry> m_nameTreeEntry;
@@ -72,7 +72,7 @@ private:
 inline const Name&
 Entry::getPrefix() const
 {
-  return m_prefix;
+  return *m_prefix;
 }
 
 inline fw::Strategy&
@@ -26,6 +26,7 @@
 #include "strategy-choice.hpp"
 #include "core/logger.hpp"
 #include "fw/strategy.hpp"
+#include "fw/strategy-registry.hpp"
 #include "pit-entry.hpp"
 #include "measurements-entry.hpp"
 
@@ -39,6 +40,8 @@ NFD_LOG_INIT("StrategyChoice");
 StrategyChoice::StrategyChoice(NameTree& nameTree, shared_ptr<Strategy> defaultStrategy)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_lazyInstallForwarder(nullptr)
+  , m_generation(1)
 {
   this->setDefaultStrategy(defaultStrategy);
 }
@@ -46,12 +49,12 @@ StrategyChoice::StrategyChoice(NameTree& nameTree, shared_ptr<Strategy> defaultS
 bool
 StrategyChoice::hasStrategy(const Name& strategyName, bool isExact) const
 {
-  if (isExact) {
-    return m_strategyInstances.count(strategyName) > 0;
-  }
-  else {
-    return static_cast<bool>(this->getStrategy(strategyName));
+  bool hasInstance = isExact ? this->isInstalled(strategyName) :
+                                static_cast<bool>(this->getStrategy(strategyName));
+  if (hasInstance || m_lazyInstallForwarder == nullptr) {
+    return hasInstance;
   }
+  return fw::findRegisteredStrategy(strategyName, isExact).first;
 }
 
 bool
@@ -60,7 +63,7 @@ StrategyChoice::install(shared_ptr<Strategy> strategy)
   BOOST_ASSERT(static_cast<bool>(strategy));
   const Name& strategyName = strategy->getName();
 
-  if (this->hasStrategy(strategyName, true)) {
+  if (this->isInstalled(strategyName)) {
     NFD_LOG_ERROR("install(" << strategyName << ") duplicate strategyName");
     return false;
   }
@@ -69,6 +72,24 @@ StrategyChoice::install(shared_ptr<Strategy> strategy)
   return true;
 }
 
+void
+StrategyChoice::enableLazyInstall(Forwarder& forwarder)
+{
+  m_lazyInstallForwarder = &forwarder;
+}
+
+void
+StrategyChoice::installRegisteredStrategy(const Name& strategyName)
+{
+  std::pair<bool, Name> registered = fw::findRegisteredStrategy(strategyName);
+  if (!registered.first || this->isInstalled(registered.second)) {
+    return;
+  }
+
+  NFD_LOG_DEBUG("install(" << registered.second << ") on first use");
+  this->install(fw::makeRegisteredStrategy(registered.second, *m_lazyInstallForwarder));
+}
+
 fw::Strategy*
 StrategyChoice::getStrategy(const Name& strategyName) const
 {
@@ -89,6 +110,10 @@ StrategyChoice::getStrategy(const Name& strategyName) const
 bool
 StrategyChoice::insert(const Name& prefix, const Name& strategyName)
 {
+  if (m_lazyInstallForwarder != nullptr) {
+    this->installRegisteredStrategy(strategyName);
+  }
+
   Strategy* strategy = this->getStrategy(strategyName);
   if (strategy == nullptr) {
     NFD_LOG_ERROR("insert(" << prefix << "," << strategyName << ") strategy not installed");
@@ -118,6 +143,7 @@ StrategyChoice::insert(const Name& prefix, const Name& strategyName)
 
   this->changeStrategy(*entry, *oldStrategy, *strategy);
   entry->setStrategy(*strategy);
+  ++m_generation;
   return true;
 }
 
@@ -144,6 +170,7 @@ StrategyChoice::erase(const Name& prefix)
   nte->setStrategyChoiceEntry(shared_ptr<Entry>());
   m_nameTree.eraseEntryIfEmpty(nte);
   --m_nItems;
+  ++m_generation;
 }
 
 std::pair<bool, Name>
@@ -177,17 +204,33 @@ StrategyChoice::findEffectiveStrategy(const Name& prefix) const
 Strategy&
 StrategyChoice::findEffectiveStrategy(shared_ptr<name_tree::Entry> nte) const
 {
-  shared_ptr<strategy_choice::Entry> entry = nte->getStrategyChoiceEntry();
-  if (static_cast<bool>(entry))
-    return entry->getStrategy();
+  Strategy* strategy = nte->getEffectiveStrategy(m_generation);
+  if (strategy != nullptr)
+    return *strategy;
 
-  nte = m_nameTree.findLongestPrefixMatch(nte,
-    [] (const name_tree::Entry& entry) {
-      return static_cast<bool>(entry.getStrategyChoiceEntry());
-    });
+  shared_ptr<strategy_choice::Entry> entry = nte->getStrategyChoiceEntry();
+  if (static_cast<bool>(entry)) {
+    strategy = &entry->getStrategy();
+  }
+  else {
+    // stop at the nearest ancestor that either has a StrategyChoice entry,
+    // or has its effective strategy memoized at current generation
+    uint64_t generation = m_generation;
+    shared_ptr<name_tree::Entry> ancestor = m_nameTree.findLongestPrefixMatch(nte,
+      [generation] (const name_tree::Entry& entry) {
+        return static_cast<bool>(entry.getStrategyChoiceEntry()) ||
+               entry.getEffectiveStrategy(generation) != nullptr;
+      });
+
+    BOOST_ASSERT(static_cast<bool>(ancestor));
+    strategy = ancestor->getEffectiveStrategy(generation);
+    if (strategy == nullptr) {
+      strategy = &ancestor->getStrategyChoiceEntry()->getStrategy();
+    }
+  }
 
-  BOOST_ASSERT(static_cast<bool>(nte));
-  return nte->getStrategyChoiceEntry()->getStrategy();
+  nte->setEffectiveStrategy(strategy, m_generation);
+  return *strategy;
 }
 
 Strategy&
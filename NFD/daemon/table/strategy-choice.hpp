@@ -31,6 +31,8 @@
 
 namespace nfd {
 
+class Forwarder;
+
 /** \brief represents the Strategy Choice table
  *
  *  The Strategy Choice table maintains available Strategy types,
@@ -48,13 +50,19 @@ public:
   StrategyChoice(NameTree& nameTree, shared_ptr<fw::Strategy> defaultStrategy);
 
 public: // available Strategy types
-  /** \brief determines if a strategy is installed
+  /** \brief determines if a strategy is installed, or can be installed on demand
    *  \param isExact true to require exact match, false to permit unversioned strategyName
-   *  \return true if strategy is installed
+   *  \return true if strategy is installed, or registered and lazy install is enabled
    */
   bool
   hasStrategy(const Name& strategyName, bool isExact = false) const;
 
+  /** \brief determines if a strategy is instantiated
+   *  \param strategyName exact strategyName
+   */
+  bool
+  isInstalled(const Name& strategyName) const;
+
   /** \brief install a strategy
    *  \return true if installed; false if not installed due to duplicate strategyName
    *  \note shared_ptr is passed by value because StrategyChoice takes ownership of strategy
@@ -62,6 +70,15 @@ public: // available Strategy types
   bool
   install(shared_ptr<fw::Strategy> strategy);
 
+  /** \brief install registered strategies on demand
+   *
+   *  Strategies registered with NFD_REGISTER_STRATEGY are instantiated for \p forwarder
+   *  by the first insert that selects them, rather than all at once.  A strategy that is
+   *  never selected costs nothing.
+   */
+  void
+  enableLazyInstall(Forwarder& forwarder);
+
 public: // Strategy Choice table
   /** \brief set strategy of prefix to be strategyName
    *  \param strategyName the strategy to be used
@@ -150,6 +167,11 @@ private:
   fw::Strategy*
   getStrategy(const Name& strategyName) const;
 
+  /** \brief install registered strategy that strategyName refers to, unless installed
+   */
+  void
+  installRegisteredStrategy(const Name& strategyName);
+
   void
   setDefaultStrategy(shared_ptr<fw::Strategy> strategy);
 
@@ -167,8 +189,24 @@ private:
 
   typedef std::map<Name, shared_ptr<fw::Strategy> > StrategyInstanceTable;
   StrategyInstanceTable m_strategyInstances;
+
+  /// forwarder for strategies installed on demand, nullptr if lazy install is disabled
+  Forwarder* m_lazyInstallForwarder;
+
+  /** \brief version of the Strategy Choice table
+   *
+   *  Incremented whenever an entry is inserted, changed, or erased.  Effective strategies
+   *  memoized on name tree entries are valid only if recorded at the current generation.
+   */
+  uint64_t m_generation;
 };
 
+inline bool
+StrategyChoice::isInstalled(const Name& strategyName) const
+{
+  return m_strategyInstances.count(strategyName) > 0;
+}
+
 inline size_t
 StrategyChoice::size() const
 {
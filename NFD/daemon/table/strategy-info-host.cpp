@@ -27,10 +27,54 @@
 
 namespace nfd {
 
+StrategyInfoHost::StrategyInfoHost()
+{
+  for (Slot& slot : m_slots) {
+    slot = {0, nullptr};
+  }
+}
+
+StrategyInfoHost::StrategyInfoHost(StrategyInfoHost&& other)
+{
+  for (size_t i = 0; i < fw::StrategyInfo::N_SLOTS; ++i) {
+    m_slots[i] = other.m_slots[i];
+    other.m_slots[i] = {0, nullptr};
+  }
+}
+
+StrategyInfoHost&
+StrategyInfoHost::operator=(StrategyInfoHost&& other)
+{
+  if (this != &other) {
+    for (size_t i = 0; i < fw::StrategyInfo::N_SLOTS; ++i) {
+      this->resetSlot(m_slots[i]);
+      m_slots[i] = other.m_slots[i];
+      other.m_slots[i] = {0, nullptr};
+    }
+  }
+  return *this;
+}
+
+StrategyInfoHost::~StrategyInfoHost()
+{
+  this->clearStrategyInfo();
+}
+
+void
+StrategyInfoHost::resetSlot(Slot& slot)
+{
+  // detach before deleting, so that the destructor of an item cannot observe itself
+  fw::StrategyInfo* item = slot.item;
+  slot = {0, nullptr};
+  delete item;
+}
+
 void
 StrategyInfoHost::clearStrategyInfo()
 {
-  m_items.clear();
+  for (Slot& slot : m_slots) {
+    this->resetSlot(slot);
+  }
 }
 
 } // namespace nfd
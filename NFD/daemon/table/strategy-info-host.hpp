@@ -31,87 +31,165 @@
 namespace nfd {
 
 /** \brief base class for an entity onto which StrategyInfo objects may be placed
+ *
+ *  StrategyInfo items are kept in a small inline array indexed by T::getSlotId(),
+ *  so that a lookup is an array access plus a type check.
+ *  Each slot holds at most one item; inserting an item of a different type into an
+ *  occupied slot is an error, because other code may still hold pointers to the
+ *  existing item.
  */
 class StrategyInfoHost
 {
 public:
+  /** \brief indicates a StrategyInfo type clashes with the item stored in its slot
+   */
+  class Error : public std::logic_error
+  {
+  public:
+    explicit
+    Error(const std::string& what)
+      : std::logic_error(what)
+    {
+    }
+  };
+
+  StrategyInfoHost();
+
+  StrategyInfoHost(StrategyInfoHost&& other);
+
+  StrategyInfoHost&
+  operator=(StrategyInfoHost&& other);
+
+  StrategyInfoHost(const StrategyInfoHost&) = delete;
+
+  StrategyInfoHost&
+  operator=(const StrategyInfoHost&) = delete;
+
+  virtual
+  ~StrategyInfoHost();
+
   /** \brief get a StrategyInfo item
    *  \tparam T type of StrategyInfo, must be a subclass of from nfd::fw::StrategyInfo
    *  \retval nullptr if no StrategyInfo of type T is stored
+   *  \note the returned pointer is owned by this host, and remains valid
+   *        until the item is erased or replaced, or the host is destroyed
    */
   template<typename T>
-  shared_ptr<T>
+  T*
   getStrategyInfo() const;
 
-  /** \brief set a StrategyInfo item
+  /** \brief insert a StrategyInfo item
    *  \tparam T type of StrategyInfo, must be a subclass of from nfd::fw::StrategyInfo
+   *  \return a new item constructed with \p args, and true;
+   *          or the existing item of type T, and false
+   *  \throw Error the slot of T is occupied by an item of another type
    */
-  template<typename T>
-  void
-  setStrategyInfo(shared_ptr<T> strategyInfo);
+  template<typename T, typename ...A>
+  std::pair<T*, bool>
+  insertStrategyInfo(A&&... args);
 
   /** \brief get or create a StrategyInfo item
    *  \tparam T type of StrategyInfo, must be a subclass of from nfd::fw::StrategyInfo
    *
    *  If no StrategyInfo of type T is stored, it's created with \p args;
    *  otherwise, the existing item is returned.
+   *  \throw Error the slot of T is occupied by an item of another type
    */
   template<typename T, typename ...A>
-  shared_ptr<T>
+  T*
   getOrCreateStrategyInfo(A&&... args);
 
+  /** \brief erase a StrategyInfo item
+   *  \tparam T type of StrategyInfo, must be a subclass of from nfd::fw::StrategyInfo
+   *  \return whether an item of type T was erased
+   */
+  template<typename T>
+  bool
+  eraseStrategyInfo();
+
   /** \brief clear all StrategyInfo items
+   *
+   *  This is virtual so that a host keeping other per-strategy state (such as
+   *  measurements::Entry) can drop it as well when called through StrategyInfoHost&.
    */
-  void
+  virtual void
   clearStrategyInfo();
 
 private:
-  std::map<int, shared_ptr<fw::StrategyInfo>> m_items;
+  struct Slot
+  {
+    int typeId;
+    fw::StrategyInfo* item;
+  };
+
+  template<typename T>
+  static constexpr size_t
+  getSlotIndex()
+  {
+    static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
+                  "T must inherit from StrategyInfo");
+    static_assert(T::getSlotId() < fw::StrategyInfo::N_SLOTS,
+                  "T::getSlotId() is out of range");
+    return T::getSlotId();
+  }
+
+  void
+  resetSlot(Slot& slot);
+
+private:
+  Slot m_slots[fw::StrategyInfo::N_SLOTS];
 };
 
 
 template<typename T>
-shared_ptr<T>
+T*
 StrategyInfoHost::getStrategyInfo() const
 {
-  static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
-                "T must inherit from StrategyInfo");
-
-  auto it = m_items.find(T::getTypeId());
-  if (it == m_items.end()) {
+  const Slot& slot = m_slots[getSlotIndex<T>()];
+  if (slot.item == nullptr || slot.typeId != T::getTypeId()) {
     return nullptr;
   }
-  return static_pointer_cast<T, fw::StrategyInfo>(it->second);
+  return static_cast<T*>(slot.item);
 }
 
-template<typename T>
-void
-StrategyInfoHost::setStrategyInfo(shared_ptr<T> item)
+template<typename T, typename ...A>
+std::pair<T*, bool>
+StrategyInfoHost::insertStrategyInfo(A&&... args)
 {
-  static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
-                "T must inherit from StrategyInfo");
-
-  if (item == nullptr) {
-    m_items.erase(T::getTypeId());
+  T* item = this->getStrategyInfo<T>();
+  if (item != nullptr) {
+    return {item, false};
   }
-  else {
-    m_items[T::getTypeId()] = item;
+
+  Slot& slot = m_slots[getSlotIndex<T>()];
+  if (slot.item != nullptr) {
+    BOOST_THROW_EXCEPTION(Error("StrategyInfo slot " + to_string(getSlotIndex<T>()) +
+                                " is occupied by type " + to_string(slot.typeId) +
+                                ", cannot insert type " + to_string(T::getTypeId())));
   }
+
+  item = new T(std::forward<A>(args)...);
+  slot.typeId = T::getTypeId();
+  slot.item = item;
+  return {item, true};
 }
 
 template<typename T, typename ...A>
-shared_ptr<T>
+T*
 StrategyInfoHost::getOrCreateStrategyInfo(A&&... args)
 {
-  static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
-                "T must inherit from StrategyInfo");
+  return this->insertStrategyInfo<T>(std::forward<A>(args)...).first;
+}
 
-  shared_ptr<T> item = this->getStrategyInfo<T>();
-  if (!static_cast<bool>(item)) {
-    item = make_shared<T>(std::forward<A>(args)...);
-    this->setStrategyInfo(item);
+template<typename T>
+bool
+StrategyInfoHost::eraseStrategyInfo()
+{
+  if (this->getStrategyInfo<T>() == nullptr) {
+    return false;
   }
-  return item;
+  this->resetSlot(m_slots[getSlotIndex<T>()]);
+  return true;
 }
 
 } // namespace nfd
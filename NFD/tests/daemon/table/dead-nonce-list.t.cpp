@@ -24,6 +24,7 @@
  */
 
 #include "table/dead-nonce-list.hpp"
+#include "core/scheduler.hpp"
 
 #include "tests/test-common.hpp"
 
@@ -67,6 +67,12 @@ public:
     return 2;
   }
 
+  static constexpr size_t
+  getSlotId()
+  {
+    return 1;
+  }
+
   DummyStrategyInfo2(int id)
     : m_id(id)
   {
@@ -77,7 +83,7 @@ public:
 
 BOOST_FIXTURE_TEST_SUITE(TableStrategyInfoHost, BaseFixture)
 
-BOOST_AUTO_TEST_CASE(SetGetClear)
+BOOST_AUTO_TEST_CASE(InsertGetClear)
 {
   StrategyInfoHost host;
 
@@ -85,16 +91,21 @@ BOOST_AUTO_TEST_CASE(SetGetClear)
 
   g_DummyStrategyInfo_count = 0;
 
-  shared_ptr<DummyStrategyInfo> info = make_shared<DummyStrategyInfo>(7591);
-  host.setStrategyInfo(info);
-  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
-  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 7591);
-
-  info.reset(); // unlink local reference
-  // host should still have a reference to info
-  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
-  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 7591);
-
+  std::pair<DummyStrategyInfo*, bool> inserted = host.insertStrategyInfo<DummyStrategyInfo>(7591);
+  BOOST_CHECK(inserted.second);
+  BOOST_REQUIRE(inserted.first != nullptr);
+  BOOST_CHECK_EQUAL(inserted.first->m_id, 7591);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>(), inserted.first);
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 1);
+
+  // the existing item is kept
+  std::pair<DummyStrategyInfo*, bool> existing = host.insertStrategyInfo<DummyStrategyInfo>(2431);
+  BOOST_CHECK(!existing.second);
+  BOOST_CHECK_EQUAL(existing.first, inserted.first);
+  BOOST_CHECK_EQUAL(existing.first->m_id, 7591);
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 1);
+
+  // the host owns the item
   host.clearStrategyInfo();
   BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfo>() == nullptr);
   BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 0);
@@ -112,7 +123,8 @@ BOOST_AUTO_TEST_CASE(Create)
   BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
   BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 3503);
 
-  host.setStrategyInfo<DummyStrategyInfo>(nullptr);
+  BOOST_CHECK(host.eraseStrategyInfo<DummyStrategyInfo>());
+  BOOST_CHECK(!host.eraseStrategyInfo<DummyStrategyInfo>());
   host.getOrCreateStrategyInfo<DummyStrategyInfo>(9956);
   BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
   BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 9956);
@@ -192,6 +192,8 @@ ConsumerZipfMandelbrot::SendPacket()
 
   m_rtt->SentSeq(SequenceNumber32(seq), 1);
 
+  ScheduleRetxTimeoutCheck();
+
   m_transmittedInterests(interest, this, m_face);
   m_face->onReceiveInterest(*interest);
 
@@ -59,7 +59,8 @@ Consumer::GetTypeId(void)
                     MakeTimeAccessor(&Consumer::m_interestLifeTime), MakeTimeChecker())
 
       .AddAttribute("RetxTimer",
-                    "Timeout defining how frequent retransmission timeouts should be checked",
+                    "Granularity of retransmission timeout checks: deadlines are rounded up to "
+                    "a multiple of this value (0 to check at exact deadlines)",
                     StringValue("50ms"),
                     MakeTimeAccessor(&Consumer::GetRetxTimer, &Consumer::SetRetxTimer),
                     MakeTimeChecker())
@@ -92,12 +93,10 @@ Consumer::SetRetxTimer(Time retxTimer)
 {
   m_retxTimer = retxTimer;
   if (m_retxEvent.IsRunning()) {
-    // m_retxEvent.Cancel (); // cancel any scheduled cleanup events
-    Simulator::Remove(m_retxEvent); // slower, but better for memory
+    // re-arm with the new granularity
+    m_retxEvent.Cancel();
+    ScheduleRetxTimeoutCheck();
   }
-
-  // schedule even with new timeout
-  m_retxEvent = Simulator::Schedule(m_retxTimer, &Consumer::CheckRetxTimeout, this);
 }
 
 Time
@@ -127,7 +126,35 @@ Consumer::CheckRetxTimeout()
       break; // nothing else to do. All later packets need not be retransmitted
   }
 
-  m_retxEvent = Simulator::Schedule(m_retxTimer, &Consumer::CheckRetxTimeout, this);
+  ScheduleRetxTimeoutCheck();
+}
+
+void
+Consumer::ScheduleRetxTimeoutCheck()
+{
+  if (m_seqTimeouts.empty()) {
+    m_retxEvent.Cancel();
+    return;
+  }
+
+  Time now = Simulator::Now();
+  Time deadline = m_seqTimeouts.get<i_timestamp>().begin()->time + m_rtt->RetransmitTimeout();
+  if (m_retxTimer.IsStrictlyPositive()) {
+    int64_t granularity = m_retxTimer.GetTimeStep();
+    deadline = TimeStep((deadline.GetTimeStep() + granularity - 1) / granularity * granularity);
+  }
+  if (deadline < now) {
+    deadline = now;
+  }
+
+  if (m_retxEvent.IsRunning()) {
+    if (m_retxEvent.GetTs() <= static_cast<uint64_t>(deadline.GetTimeStep())) {
+      return; // the pending check will re-arm for the later deadline
+    }
+    m_retxEvent.Cancel();
+  }
+
+  m_retxEvent = Simulator::Schedule(deadline - now, &Consumer::CheckRetxTimeout, this);
 }
 
 // Application Methods
@@ -149,6 +176,7 @@ Consumer::StopApplication() // Called at time specified by Stop
 
   // cancel periodic packet generation
   Simulator::Cancel(m_sendEvent);
+  m_retxEvent.Cancel();
 
   // cleanup base stuff
   App::StopApplication();
@@ -251,6 +279,9 @@ Consumer::OnData(shared_ptr<const Data> data)
   m_retxSeqs.erase(seq);
 
   m_rtt->AckSeq(SequenceNumber32(seq));
+
+  // the earliest outstanding Interest or the RTO may have changed
+  ScheduleRetxTimeoutCheck();
 }
 
 void
@@ -282,6 +313,8 @@ Consumer::WillSendOutInterest(uint32_t sequenceNumber)
   m_seqRetxCounts[sequenceNumber]++;
 
   m_rtt->SentSeq(SequenceNumber32(sequenceNumber), 1);
+
+  ScheduleRetxTimeoutCheck();
 }
 
 } // namespace ndn
@@ -115,15 +115,26 @@ protected:
   CheckRetxTimeout();
 
   /**
-   * \brief Modifies the frequency of checking the retransmission timeouts
-   * \param retxTimer Timeout defining how frequent retransmission timeouts should be checked
+   * \brief Arms the retransmission check for the earliest deadline in m_seqTimeouts
+   *
+   * Must be called whenever the earliest outstanding Interest or the RTO may have changed.  A
+   * pending check that is due no later than the new deadline is kept; CheckRetxTimeout re-arms
+   * itself.  No event is kept when no Interest is outstanding.
+   */
+  void
+  ScheduleRetxTimeoutCheck();
+
+  /**
+   * \brief Modifies the granularity of retransmission timeout checks
+   * \param retxTimer Retransmission deadlines are rounded up to a multiple of this value, so that
+   *                  timeouts falling into the same slot are handled by one event (zero means
+   *                  exact deadlines)
    */
   void
   SetRetxTimer(Time retxTimer);
 
   /**
-   * \brief Returns the frequency of checking the retransmission timeouts
-   * \return Timeout defining how frequent retransmission timeouts should be checked
+   * \brief Returns the granularity of retransmission timeout checks
    */
   Time
   GetRetxTimer() const;
@@ -134,7 +145,7 @@ protected:
   uint32_t m_seq;      ///< @brief currently requested sequence number
   uint32_t m_seqMax;   ///< @brief maximum number of sequence number
   EventId m_sendEvent; ///< @brief EventId of pending "send packet" event
-  Time m_retxTimer;    ///< @brief Currently estimated retransmission timer
+  Time m_retxTimer;    ///< @brief Granularity of retransmission timeout checks
   EventId m_retxEvent; ///< @brief Event to check whether or not retransmission should be performed
 
   Ptr<RttEstimator> m_rtt; ///< @brief RTT estimator
@@ -21,6 +21,7 @@
 #include "ndn-fake-fileserver.hpp"
 #include "ns3/log.h"
 #include "ns3/string.h"
+#include "ns3/boolean.h"
 #include "ns3/uinteger.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
@@ -37,11 +38,15 @@
 #include "model/ndn-l3-protocol.hpp"
 #include "helper/ndn-fib-helper.hpp"
 
+#include "ndn-file-info.hpp"
+#include "ndn-file-catalog.hpp"
+
 #include <memory>
 #include <sys/types.h>
 #include <sys/stat.h>
 
 #include <math.h>
+#include <limits>
 #include <fstream>
 
 
@@ -87,7 +92,11 @@ FakeFileServer::GetTypeId(void)
          MakeUintegerChecker<uint32_t>())
       .AddAttribute("KeyLocator",
                     "Name to be used for key locator.  If root, then key locator is not used",
-                    NameValue(), MakeNameAccessor(&FakeFileServer::m_keyLocator), MakeNameChecker());
+                    NameValue(), MakeNameAccessor(&FakeFileServer::m_keyLocator), MakeNameChecker())
+      .AddAttribute("FileInfoInChunks",
+                    "Put the file size into every data chunk (and the last sequence number as FinalBlockId), "
+                    "so that consumers do not need to request the manifest",
+                    BooleanValue(false), MakeBooleanAccessor(&FakeFileServer::m_fileInfoInChunks), MakeBooleanChecker());
   return tid;
 }
 
@@ -107,7 +116,14 @@ FakeFileServer::StartApplication()
 
   FibHelper::AddRoute(GetNode(), m_prefix, m_face, 0);
 
-  // read m_metaDataFile and fill m_fileSizes
+  m_MTU = GetFaceMTU(0);
+
+  m_freshnessTime = ::ndn::time::milliseconds(m_freshness.GetMilliSeconds());
+
+  m_manifestPostfixName = Name(m_postfixManifest);
+  m_catalog.clear();
+
+  // read m_metaDataFile and index all files in m_catalog, so that chunks are served without any lookup work
   std::ifstream infile(m_metaDataFile.c_str());
   if (!infile.is_open())
   {
@@ -129,16 +145,24 @@ FakeFileServer::StartApplication()
     if (line.length() > 2){
       Tokenizer tok(line);
       vecLine.assign(tok.begin(), tok.end());
-      m_fileSizes["/" + vecLine.at(0)] = atoi(vecLine.at(1).c_str());
+
+      FileCatalogEntry file;
+      file.path = "/" + vecLine.at(0);
+      file.name = Name(m_prefix).append(Name(file.path));
+      file.fileSize = atoi(vecLine.at(1).c_str());
+
+      std::string fname = file.name.toUri();
+      // set the payload size to MTU minus the overhead (minus 4 bytes to be safe for sequence numbers, ethernet headers, etc...)
+      file.maxPayloadSize = m_MTU - EstimateOverhead(fname) - 4;
+      file.lastSeqNo = file.fileSize / file.maxPayloadSize;
+      m_catalog.insert(file);
     }
   }
 
 
   infile.close();
 
-  m_MTU = GetFaceMTU(0);
-
-  m_freshnessTime = ::ndn::time::milliseconds(m_freshness.GetMilliSeconds());
+  NS_LOG_INFO("FakeFileServer: " << m_catalog.size() << " files in the catalog");
 }
 
 
@@ -173,71 +197,72 @@ FakeFileServer::OnInterest(shared_ptr<const Interest> interest)
   if (!m_active)
     return;
 
-  Name dataName(interest->getName());
-  
-  // get last postfix
-  ndn::Name  lastPostfix = dataName.getSubName(dataName.size() -1 );
-  NS_LOG_INFO("> LastPostfix = " << lastPostfix);
+  const Name& interestName = interest->getName();
 
-  bool isManifest = false;
+  bool isManifest = IsManifestInterest(interestName, m_manifestPostfixName);
   uint32_t seqNo = -1;
 
-  if (lastPostfix == m_postfixManifest)
-  {
-    isManifest = true;
-  }
-  else
+  if (!isManifest)
   {
-    seqNo = dataName.at(-1).toSequenceNumber();
+    seqNo = interestName.at(-1).toSequenceNumber();
     seqNo = seqNo - 1; // Christian: the client thinks seqNo = 1 is the first one, for the server it's better to start at 0
   }
 
-  // remove the last postfix
-  dataName = dataName.getPrefix(-1);
-
-  // extract filename and get path to file
-  std::string fname = dataName.toUri();  // get the uri from interest
-
-  // measure how much overhead this actually this
-  int diff = EstimateOverhead(fname);
-  // set new payload size to this value (minus 4 bytes to be safe for sequence numbers, ethernet headers, etc...)
-  m_maxPayloadSize = m_MTU - diff - 4;
-
-  //NS_LOG_UNCOND("NewPayload = " << m_maxPayloadSize << " (Overhead: " << diff << ") ");
-
-  fname = fname.substr(m_prefix.length(), fname.length()); // remove the prefix
+  // everything else only depends on the file, i.e., the name without the last postfix
+  const FileCatalogEntry& file = GetCatalogEntry(interestName);
 
   // handle manifest or data
   if (isManifest)
   {
-    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Manifest for file " << fname);
-    ReturnManifestData(interest, fname);
+    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Manifest for file " << file.path);
+    ReturnManifestData(interest, file);
   } else
   {
-    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Payload for file " << fname);
-    NS_LOG_DEBUG("FileName: " << fname << ", SeqNo:" << seqNo);
+    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Payload for file " << file.path);
+    NS_LOG_DEBUG("FileName: " << file.path << ", SeqNo:" << seqNo);
 
 #ifdef DEBUG
     // check if file exists and the sanity of the sequence number requested
-    long fileSize = GetFileSize(fname);
-
-    if (fileSize == -1)
+    if (file.fileSize == -1)
       return; // file does not exist, just quit
 
-    if (seqNo > ceil(fileSize / m_maxPayloadSize))
+    if (seqNo > file.lastSeqNo)
       return; // sequence not available
 #endif
     // else:
-    ReturnVirtualPayloadData(interest, fname, seqNo);
+    ReturnVirtualPayloadData(interest, file, seqNo);
   }
 }
 
 
 
+const FileCatalogEntry&
+FakeFileServer::GetCatalogEntry(const Name& interestName)
+{
+  // the file is named by the Interest name without its last component
+  FileCatalogEntry* entry = m_catalog.find(interestName, interestName.size() - 1);
+  if (entry != nullptr)
+    return *entry;
+
+  // not in the list of file sizes, missing files are not remembered
+  m_missingFile.name = interestName.getPrefix(-1);
+  std::string fname = m_missingFile.name.toUri();  // get the uri from interest
+
+  m_missingFile.path = fname.substr(m_prefix.length(), fname.length()); // remove the prefix
+  fprintf(stderr, "Error finding file %s\n", m_missingFile.path.c_str());
+
+  m_missingFile.fileSize = -1;
+  m_missingFile.maxPayloadSize = m_MTU - EstimateOverhead(fname) - 4;
+  m_missingFile.lastSeqNo = 0;
+  return m_missingFile;
+}
+
+
+
 void
-FakeFileServer::ReturnManifestData(shared_ptr<const Interest> interest, std::string& fname)
+FakeFileServer::ReturnManifestData(shared_ptr<const Interest> interest, const FileCatalogEntry& file)
 {
-  long fileSize = GetFileSize(fname);
+  long fileSize = file.fileSize;
 
   auto data = make_shared<Data>();
   data->setName(interest->getName());
@@ -246,7 +271,7 @@ FakeFileServer::ReturnManifestData(shared_ptr<const Interest> interest, std::str
   // create a local buffer variable, which contains a long and an unsigned
   uint8_t buffer[sizeof(long) + sizeof(unsigned)];
   memcpy(buffer, &fileSize, sizeof(long));
-  memcpy(buffer+sizeof(long), &m_maxPayloadSize, sizeof(unsigned));
+  memcpy(buffer+sizeof(long), &file.maxPayloadSize, sizeof(unsigned));
 
   // create content with the file size in it
   data->setContent(reinterpret_cast<const uint8_t*>(buffer), sizeof(long) + sizeof(unsigned));
@@ -274,14 +299,17 @@ FakeFileServer::ReturnManifestData(shared_ptr<const Interest> interest, std::str
 
 
 void
-FakeFileServer::ReturnVirtualPayloadData(shared_ptr<const Interest> interest, std::string& fname, uint32_t seqNo)
+FakeFileServer::ReturnVirtualPayloadData(shared_ptr<const Interest> interest, const FileCatalogEntry& file, uint32_t seqNo)
 {
   auto data = make_shared<Data>();
   data->setName(interest->getName());
 
   data->setFreshnessPeriod(m_freshnessTime);
 
-  auto buffer = make_shared< ::ndn::Buffer>(m_maxPayloadSize);
+  if (m_fileInfoInChunks)
+    AddFileInfo(*data, file.fileSize, file.maxPayloadSize);
+
+  auto buffer = make_shared< ::ndn::Buffer>(file.maxPayloadSize);
   data->setContent(buffer);
 
   Signature signature;
@@ -312,11 +340,6 @@ FakeFileServer::ReturnVirtualPayloadData(shared_ptr<const Interest> interest, st
 size_t
 FakeFileServer::EstimateOverhead(std::string& fname)
 {
-  if (m_packetSizes.find(fname) != m_packetSizes.end())
-  {
-    return m_packetSizes[fname];
-  }
-
   uint32_t interestLength = fname.length();
   // estimate the payload size for now
   int estimatedMaxPayloadSize = m_MTU - interestLength - 30; // the -30 is something we saw in results, it's just to estimate...
@@ -325,6 +348,9 @@ FakeFileServer::EstimateOverhead(std::string& fname)
   data->setName(fname + "/1"); // to simulate that there is at least one chunk
   data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
 
+  if (m_fileInfoInChunks)
+    AddFileInfo(*data, std::numeric_limits<long>::max(), std::numeric_limits<uint32_t>::max()); // leave room for the largest file info
+
   auto buffer = make_shared< ::ndn::Buffer>(estimatedMaxPayloadSize);
   data->setContent(buffer);
 
@@ -344,29 +370,11 @@ FakeFileServer::EstimateOverhead(std::string& fname)
   // to create real wire encoding
   Block tmp = data->wireEncode();
 
-  m_packetSizes[fname] = tmp.size() - estimatedMaxPayloadSize;
-
   return tmp.size() - estimatedMaxPayloadSize;
 }
 
 
 
-// GetFileSize either from m_fileSizes map or from disk
-long FakeFileServer::GetFileSize(std::string filename)
-{
-  // check if is already in m_fileSizes
-  if (m_fileSizes.find(filename) != m_fileSizes.end())
-  {
-    return m_fileSizes[filename];
-  }
-  fprintf(stderr, "Error finding file %s\n", filename.c_str());
-  // else: query disk for file size
-
-  return -1;
-}
-
-
-
 
 
 } // namespace ndn
@@ -24,6 +24,7 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
 #include "ndn-app.hpp"
+#include "ndn-file-catalog.hpp"
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
 #include "ns3/nstime.h"
@@ -60,14 +61,14 @@ protected:
   virtual void
   StopApplication(); // Called at time specified by Stop
 
-  void
-  ReturnManifestData(shared_ptr<const Interest> interest, std::string& fname); // return file-manifest data
+  const FileCatalogEntry&
+  GetCatalogEntry(const Name& interestName); // look up the file of a chunk or manifest in the catalog
 
   void
-  ReturnVirtualPayloadData(shared_ptr<const Interest> interest, std::string& fname, uint32_t seqNo);
+  ReturnManifestData(shared_ptr<const Interest> interest, const FileCatalogEntry& file); // return file-manifest data
 
-  long
-  GetFileSize(std::string filename);
+  void
+  ReturnVirtualPayloadData(shared_ptr<const Interest> interest, const FileCatalogEntry& file, uint32_t seqNo);
 
   uint16_t
   GetFaceMTU(uint32_t faceId);
@@ -85,16 +86,18 @@ private:
   std::string m_metaDataFile;
   std::string m_contentDir;
   std::string m_postfixManifest;
+  Name m_manifestPostfixName;
   std::string m_metaDataContentDirectory;
-  std::map<std::string,long> m_fileSizes;
-  std::map<std::string,size_t> m_packetSizes;
+  FileCatalog m_catalog;
+  FileCatalogEntry m_missingFile; ///< \brief entry of the last file that was not found (not kept in m_catalog)
   std::vector<std::string> m_virtualFiles;
 
-  uint32_t m_maxPayloadSize;
   Time m_freshness;
 
   uint32_t m_signature;
   Name m_keyLocator;
+
+  bool m_fileInfoInChunks;
 };
 
 } // namespace ndn
@@ -21,6 +21,7 @@
 #include "ndn-fake-multimedia-server.hpp"
 #include "ns3/log.h"
 #include "ns3/string.h"
+#include "ns3/boolean.h"
 #include "ns3/uinteger.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
@@ -37,15 +38,21 @@
 #include "model/ndn-l3-protocol.hpp"
 #include "helper/ndn-fib-helper.hpp"
 
+#include "ndn-file-info.hpp"
+#include "ndn-file-catalog.hpp"
+
 #include <memory>
 #include <sys/types.h>
 #include <sys/stat.h>
 
 #include <math.h>
+#include <limits>
 #include <fstream>
 
 
 #include <algorithm>    // copy
+#include <cctype>
+#include <map>
 #include <iterator>     // ostream_operator
 
 #include <boost/tokenizer.hpp>
@@ -68,6 +75,9 @@ namespace ndn {
 
 NS_OBJECT_ENSURE_REGISTERED(FakeMultimediaServer);
 
+// number of names which are not segments whose payload size is kept
+static const size_t MAX_OTHER_PAYLOAD_SIZES = 1024;
+
 
 
 
@@ -99,7 +109,11 @@ FakeMultimediaServer::GetTypeId(void)
          MakeUintegerChecker<uint32_t>())
       .AddAttribute("KeyLocator",
                     "Name to be used for key locator.  If root, then key locator is not used",
-                    NameValue(), MakeNameAccessor(&FakeMultimediaServer::m_keyLocator), MakeNameChecker());
+                    NameValue(), MakeNameAccessor(&FakeMultimediaServer::m_keyLocator), MakeNameChecker())
+      .AddAttribute("FileInfoInChunks",
+                    "Put the file size into every data chunk (and the last sequence number as FinalBlockId), "
+                    "so that consumers do not need to request the manifest",
+                    BooleanValue(false), MakeBooleanAccessor(&FakeMultimediaServer::m_fileInfoInChunks), MakeBooleanChecker());
   return tid;
 }
 
@@ -119,12 +133,49 @@ FakeMultimediaServer::StartApplication()
 
   FibHelper::AddRoute(GetNode(), m_prefix, m_face, 0);
 
+  m_content = GetContent();
+  if (m_content == nullptr)
+    return;
+
+  m_MTU = GetFaceMTU(0);
+
+  m_freshnessTime = ::ndn::time::milliseconds(m_freshness.GetMilliSeconds());
+
+  m_manifestPostfixName = Name(m_postfixManifest);
+  m_prefixName = Name(m_prefix);
+  m_mpdName = Name(m_prefix + "/" + m_mpdFileName);
+
+  // the MPD is the only real file, everything about it is known in advance
+  m_mpdFile.path = "/" + m_mpdFileName;
+  m_mpdFile.fileSize = m_content->mpdFileContent.size();
+  m_mpdFile.maxPayloadSize = EstimatePayloadSize(m_mpdName);
+  m_mpdFile.lastSeqNo = m_mpdFile.fileSize / m_mpdFile.maxPayloadSize;
+
+  // payload sizes of the segments are estimated when they are requested for the first time
+  m_segmentPayloadSizes.assign(m_content->representations.size() * m_content->numberOfSegments, 0);
+  m_otherPayloadSizes.clear();
+}
+
+
+
+shared_ptr<const FakeMultimediaServer::MultimediaContent>
+FakeMultimediaServer::GetContent()
+{
+  // servers with the same meta data file and prefix serve the same MPD
+  typedef std::map<std::pair<std::string, std::string>, std::weak_ptr<const MultimediaContent>> ContentCache;
+  static ContentCache contentCache;
+
+  std::pair<std::string, std::string> key(m_metaDataFile, m_prefix);
+  shared_ptr<const MultimediaContent> cached = contentCache[key].lock();
+  if (cached != nullptr)
+    return cached;
+
   // read m_metaDataFile and create fake representations
   std::ifstream infile(m_metaDataFile.c_str());
   if (!infile.is_open())
   {
     fprintf(stderr, "FakeMultimediaServer: Error opening %s\n", m_metaDataFile.c_str());
-    return;
+    return nullptr;
   }
 
 
@@ -135,6 +186,8 @@ FakeMultimediaServer::StartApplication()
 
   fprintf(stderr, "Reading Multimedia Specifics from %s\n", m_metaDataFile.c_str());
 
+  auto content = make_shared<MultimediaContent>();
+
   int segment_duration = 0;
   int number_of_segments = 0;
 
@@ -149,6 +202,8 @@ FakeMultimediaServer::StartApplication()
   if (!line.compare(0, prefix.size(), prefix))
     number_of_segments = atoi(line.substr(prefix.size()).c_str());
 
+  content->numberOfSegments = number_of_segments;
+
  // fprintf(stderr,"duration=%d,number=%d\n", segment_duration,number_of_segments);
   std::stringstream mpdData;
 
@@ -195,15 +250,16 @@ FakeMultimediaServer::StartApplication()
                  " width=\"" << screen_width << "\" height=\"" << screen_height << "\" startWithSAP=\"1\" bandwidth=\"" << (iBitrate*1000) << "\">" << std::endl;
       mpdData << "<SegmentList duration=\"" << segment_duration << "\">" << std::endl;
 
-      
-      int iSegmentSize = (double)iBitrate/8.0 * (double)segment_duration * 1024; // in byte
+      // all segments of a representation have the same size
+      MultimediaContent::Representation representation;
+      representation.id = repr_id;
+      representation.segmentSize = (double)iBitrate/8.0 * (double)segment_duration * 1024; // in byte
+      content->representationIndex[repr_id] = content->representations.size();
+      content->representations.push_back(representation);
+
       for (int i = 0; i < number_of_segments; i++)
       {
-        std::ostringstream segmentFileName;
-        segmentFileName << "/repr_" << repr_id << "_seg_" << i << ".264";
-        m_fileSizes[segmentFileName.str()] = iSegmentSize;
         mpdData << "<SegmentURL media=\"" <<  "repr_" << repr_id << "_seg_" << i << ".264" << "\"/> " << std::endl;
-        //fprintf(stderr, "SegmentName=%s,Size=%d\n", segmentFileName.str().c_str(), iSegmentSize);
       }
 
       mpdData << "</SegmentList>" << std::endl << "</Representation>" << std::endl;
@@ -219,18 +275,12 @@ FakeMultimediaServer::StartApplication()
   std::stringstream compressedMpdData;
   CompressString(mpdData.str(), compressedMpdData);
 
-  m_mpdFileContent = compressedMpdData.str();
+  content->mpdFileContent = compressedMpdData.str();
 
   infile.close();
 
-  std::ostringstream mpdFileName;
-  mpdFileName << "/" << m_mpdFileName;
-  // store file size for mpd file name
-  m_fileSizes[mpdFileName.str()] = m_mpdFileContent.size();
-
-  m_MTU = GetFaceMTU(0);
-
-  m_freshnessTime = ::ndn::time::milliseconds(m_freshness.GetMilliSeconds());
+  contentCache[key] = content;
+  return content;
 }
 
 
@@ -263,52 +313,37 @@ FakeMultimediaServer::OnInterest(shared_ptr<const Interest> interest)
 
   NS_LOG_FUNCTION(this << interest);
 
-  if (!m_active)
+  if (!m_active || m_content == nullptr)
     return;
 
-  Name dataName(interest->getName());
-
-  // get last postfix
-  ndn::Name  lastPostfix = dataName.getSubName(dataName.size() -1 );
-  NS_LOG_INFO("> LastPostfix = " << lastPostfix);
+  const Name& interestName = interest->getName();
 
-  bool isManifest = false;
+  bool isManifest = IsManifestInterest(interestName, m_manifestPostfixName);
   uint32_t seqNo = -1;
 
-  if (lastPostfix == m_postfixManifest)
+  if (!isManifest)
   {
-    isManifest = true;
-  }
-  else
-  {
-    seqNo = dataName.at(-1).toSequenceNumber();
+    seqNo = interestName.at(-1).toSequenceNumber();
     seqNo = seqNo - 1; // Christian: the client thinks seqNo = 1 is the first one, for the server it's better to start at 0
   }
 
-  // remove the last postfix
-  dataName = dataName.getPrefix(-1);
-
-  // extract filename and get path to file
-  std::string fname = dataName.toUri();  // get the uri from interest
+  // everything else only depends on the file, i.e., the name without the last postfix
+  bool isMpd = interestName.size() == m_mpdName.size() + 1 && m_mpdName.isPrefixOf(interestName);
 
-  // measure how much overhead this actually this
-  int diff = EstimateOverhead(fname);
-  // set new payload size to this value (minus 4 bytes to be safe for sequence numbers, ethernet headers, etc...)
-  m_maxPayloadSize = m_MTU - diff - 4;
+  FileCatalogEntry segment;
+  if (!isMpd)
+    GetSegmentEntry(interestName, segment);
 
-  //NS_LOG_UNCOND("NewPayload = " << m_maxPayloadSize << " (Overhead: " << diff << ") ");
-  fname = fname.substr(m_prefix.length(), fname.length()); // remove the prefix
+  const FileCatalogEntry& file = isMpd ? m_mpdFile : segment;
 
 
 
 #ifdef DEBUG
   // check if file exists and the sanity of the sequence number requested
-  long fileSize = GetFileSize(fname);
-
-  if (fileSize == -1)
+  if (file.fileSize == -1)
     return; // file does not exist, just quit
 
-  if (seqNo > ceil(fileSize / m_maxPayloadSize))
+  if (seqNo > file.lastSeqNo)
     return; // sequence not available
 #endif
 
@@ -316,26 +351,133 @@ FakeMultimediaServer::OnInterest(shared_ptr<const Interest> interest)
   // handle manifest or data
   if (isManifest)
   {
-    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Manifest for file " << fname);
-    ReturnManifestData(interest, fname);
+    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Manifest for file " << interestName.getPrefix(-1));
+    ReturnManifestData(interest, file);
   } else
   {
-    if (fname.compare(1, std::string::npos, m_mpdFileName) == 0)
+    if (isMpd)
     {
       // we are processing the MPD here... this is important
-      // return m_mpdFileContent
-      NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Real Payload for file " << fname);
-      NS_LOG_DEBUG("FileName: " << fname << ", SeqNo:" << seqNo);
-      ReturnPayloadData(interest, fname, seqNo, m_mpdFileContent.c_str(), m_mpdFileContent.size());
+      // return m_content->mpdFileContent
+      NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Real Payload for file " << file.path);
+      NS_LOG_DEBUG("FileName: " << file.path << ", SeqNo:" << seqNo);
+      ReturnPayloadData(interest, file, seqNo, m_content->mpdFileContent.c_str(), m_content->mpdFileContent.size());
     } else {  
-      NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Virtual Payload for file " << fname);
-      NS_LOG_DEBUG("FileName: " << fname << ", SeqNo:" << seqNo);
-      ReturnVirtualPayloadData(interest, fname, seqNo);
+      NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Virtual Payload for file " << interestName.getPrefix(-1));
+      NS_LOG_DEBUG("FileName: " << interestName.getPrefix(-1) << ", SeqNo:" << seqNo);
+      ReturnVirtualPayloadData(interest, file, seqNo);
     }
   }
 }
 
 
+void
+FakeMultimediaServer::GetSegmentEntry(const Name& interestName, FileCatalogEntry& file)
+{
+  uint32_t repIndex = 0;
+  uint32_t segmentNr = 0;
+
+  // segments are served as <prefix>/repr_<id>_seg_<nr>.264/<postfix>
+  if (interestName.size() == m_prefixName.size() + 2 && m_prefixName.isPrefixOf(interestName))
+  {
+    const name::Component& component = interestName.get(-2);
+    const char* begin = reinterpret_cast<const char*>(component.value());
+
+    if (ParseSegmentName(begin, begin + component.value_size(), repIndex, segmentNr))
+    {
+      uint32_t& payloadSize = m_segmentPayloadSizes[static_cast<size_t>(repIndex) * m_content->numberOfSegments + segmentNr];
+      if (payloadSize == 0)
+      {
+        // first Interest for this segment
+        payloadSize = EstimatePayloadSize(interestName.getPrefix(-1));
+      }
+
+      file.fileSize = m_content->representations[repIndex].segmentSize;
+      file.maxPayloadSize = payloadSize;
+      file.lastSeqNo = file.fileSize / file.maxPayloadSize;
+      return;
+    }
+  }
+
+  // not a segment of this server, still answered with virtual payload
+  NS_LOG_WARN("Not a segment: " << interestName);
+  Name fileName = interestName.getPrefix(-1);
+  auto it = m_otherPayloadSizes.find(fileName);
+  if (it == m_otherPayloadSizes.end())
+  {
+    // these names come from the consumers, do not let them grow the cache without limit
+    if (m_otherPayloadSizes.size() >= MAX_OTHER_PAYLOAD_SIZES)
+      m_otherPayloadSizes.clear();
+    it = m_otherPayloadSizes.insert(std::make_pair(fileName, EstimatePayloadSize(fileName))).first;
+  }
+
+  file.fileSize = -1;
+  file.maxPayloadSize = it->second;
+  file.lastSeqNo = 0;
+}
+
+
+
+uint32_t
+FakeMultimediaServer::EstimatePayloadSize(const Name& fileName)
+{
+  std::string fname = fileName.toUri();
+  // leave 4 bytes to be safe for sequence numbers, ethernet headers, etc...
+  size_t overhead = EstimateOverhead(fname) + 4;
+  if (overhead >= m_MTU)
+  {
+    // the MTU is too small for this name, serve chunks which exceed it instead of none at all
+    NS_LOG_ERROR("MTU of " << m_MTU << " bytes leaves no room for the payload of " << fileName);
+    return 1;
+  }
+
+  return m_MTU - overhead;
+}
+
+
+bool
+FakeMultimediaServer::ParseSegmentName(const char* begin, const char* end, uint32_t& repIndex, uint32_t& segmentNr) const
+{
+  static const std::string reprPrefix = "repr_";
+  static const std::string segInfix = "_seg_";
+  static const std::string segPostfix = ".264";
+
+  if (end - begin < (long)(reprPrefix.size() + segInfix.size() + segPostfix.size()) ||
+      !std::equal(reprPrefix.begin(), reprPrefix.end(), begin) ||
+      !std::equal(segPostfix.begin(), segPostfix.end(), end - segPostfix.size()))
+    return false;
+
+  // the representation id may contain "_seg_" itself, the segment number does not
+  const char* numberEnd = end - segPostfix.size();
+  const char* numberBegin = numberEnd;
+  while (numberBegin > begin && isdigit(static_cast<unsigned char>(*(numberBegin - 1))))
+    numberBegin--;
+
+  if (numberBegin == numberEnd || numberBegin - begin < (long)(reprPrefix.size() + segInfix.size()) ||
+      !std::equal(segInfix.begin(), segInfix.end(), numberBegin - segInfix.size()))
+    return false;
+
+  uint64_t number = 0;
+  for (const char* digit = numberBegin; digit != numberEnd; digit++)
+  {
+    number = number * 10 + (*digit - '0');
+    if (number >= m_content->numberOfSegments)
+      return false;
+  }
+
+  const char* idBegin = begin + reprPrefix.size();
+  const char* idEnd = numberBegin - segInfix.size();
+
+  auto representation = m_content->representationIndex.find(std::string(idBegin, idEnd));
+  if (representation == m_content->representationIndex.end())
+    return false;
+
+  repIndex = representation->second;
+  segmentNr = number;
+  return true;
+}
+
+
 bool
 FakeMultimediaServer::CompressString(std::string input, std::stringstream& outputStream)
 {
@@ -351,9 +493,9 @@ FakeMultimediaServer::CompressString(std::string input, std::stringstream& outpu
 
 
 void
-FakeMultimediaServer::ReturnManifestData(shared_ptr<const Interest> interest, std::string& fname)
+FakeMultimediaServer::ReturnManifestData(shared_ptr<const Interest> interest, const FileCatalogEntry& file)
 {
-  long fileSize = GetFileSize(fname);
+  long fileSize = file.fileSize;
 
   auto data = make_shared<Data>();
   data->setName(interest->getName());
@@ -362,7 +504,7 @@ FakeMultimediaServer::ReturnManifestData(shared_ptr<const Interest> interest, st
   // create a local buffer variable, which contains a long and an unsigned
   uint8_t buffer[sizeof(long) + sizeof(unsigned)];
   memcpy(buffer, &fileSize, sizeof(long));
-  memcpy(buffer+sizeof(long), &m_maxPayloadSize, sizeof(unsigned));
+  memcpy(buffer+sizeof(long), &file.maxPayloadSize, sizeof(unsigned));
 
   // create content with the file size in it
   data->setContent(reinterpret_cast<const uint8_t*>(buffer), sizeof(long) + sizeof(unsigned));
@@ -389,13 +531,16 @@ FakeMultimediaServer::ReturnManifestData(shared_ptr<const Interest> interest, st
 
 
 void
-FakeMultimediaServer::ReturnPayloadData(shared_ptr<const Interest> interest, std::string& fname, uint32_t seqNo, const char* payload, int payload_size)
+FakeMultimediaServer::ReturnPayloadData(shared_ptr<const Interest> interest, const FileCatalogEntry& file, uint32_t seqNo, const char* payload, int payload_size)
 {
   auto data = make_shared<Data>();
   data->setName(interest->getName());
   data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
 
-  int start_byte_no = seqNo * m_maxPayloadSize;
+  if (m_fileInfoInChunks)
+    AddFileInfo(*data, payload_size, file.maxPayloadSize);
+
+  int start_byte_no = seqNo * file.maxPayloadSize;
 
   if (start_byte_no > payload_size)
   {
@@ -403,7 +548,7 @@ FakeMultimediaServer::ReturnPayloadData(shared_ptr<const Interest> interest, std
     return;
   }
 
-  int actual_payload_length = m_maxPayloadSize;
+  int actual_payload_length = file.maxPayloadSize;
   if ((start_byte_no + actual_payload_length) > payload_size)
   {
     actual_payload_length -= (start_byte_no + actual_payload_length) - payload_size;
@@ -416,7 +561,7 @@ FakeMultimediaServer::ReturnPayloadData(shared_ptr<const Interest> interest, std
   }
 
 
-  auto buffer = make_shared< ::ndn::Buffer>(m_maxPayloadSize);
+  auto buffer = make_shared< ::ndn::Buffer>(file.maxPayloadSize);
 
   memcpy(buffer->get(), &payload[start_byte_no], actual_payload_length);
 
@@ -445,14 +590,17 @@ FakeMultimediaServer::ReturnPayloadData(shared_ptr<const Interest> interest, std
 
 
 void
-FakeMultimediaServer::ReturnVirtualPayloadData(shared_ptr<const Interest> interest, std::string& fname, uint32_t seqNo)
+FakeMultimediaServer::ReturnVirtualPayloadData(shared_ptr<const Interest> interest, const FileCatalogEntry& file, uint32_t seqNo)
 {
   auto data = make_shared<Data>();
   data->setName(interest->getName());
 
   data->setFreshnessPeriod(m_freshnessTime);
 
-  auto buffer = make_shared< ::ndn::Buffer>(m_maxPayloadSize);
+  if (m_fileInfoInChunks)
+    AddFileInfo(*data, file.fileSize, file.maxPayloadSize);
+
+  auto buffer = make_shared< ::ndn::Buffer>(file.maxPayloadSize);
   data->setContent(buffer);
 
   Signature signature;
@@ -483,19 +631,19 @@ FakeMultimediaServer::ReturnVirtualPayloadData(shared_ptr<const Interest> intere
 size_t
 FakeMultimediaServer::EstimateOverhead(std::string& fname)
 {
-  if (m_packetSizes.find(fname) != m_packetSizes.end())
-  {
-    return m_packetSizes[fname];
-  }
+  // not cached here, the callers keep the payload size per file
 
   uint32_t interestLength = fname.length();
   // estimate the payload size for now
-  int estimatedMaxPayloadSize = m_MTU - interestLength - 30; // the -30 is something we saw in results, it's just to estimate...
+  int estimatedMaxPayloadSize = std::max<int>(static_cast<int>(m_MTU) - static_cast<int>(interestLength) - 30, 0); // the -30 is something we saw in results, it's just to estimate...
 
   auto data = make_shared<Data>();
   data->setName(fname + "/1"); // to simulate that there is at least one chunk
   data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
 
+  if (m_fileInfoInChunks)
+    AddFileInfo(*data, std::numeric_limits<long>::max(), std::numeric_limits<uint32_t>::max()); // leave room for the largest file info
+
   auto buffer = make_shared< ::ndn::Buffer>(estimatedMaxPayloadSize);
   data->setContent(buffer);
 
@@ -515,29 +663,11 @@ FakeMultimediaServer::EstimateOverhead(std::string& fname)
   // to create real wire encoding
   Block tmp = data->wireEncode();
 
-  m_packetSizes[fname] = tmp.size() - estimatedMaxPayloadSize;
-
   return tmp.size() - estimatedMaxPayloadSize;
 }
 
 
 
-// GetFileSize either from m_fileSizes map or from disk
-long FakeMultimediaServer::GetFileSize(std::string filename)
-{
-  // check if is already in m_fileSizes
-  if (m_fileSizes.find(filename) != m_fileSizes.end())
-  {
-    return m_fileSizes[filename];
-  }
-  fprintf(stderr, "Error finding file %s\n", filename.c_str());
-  // else: query disk for file size
-
-  return -1;
-}
-
-
-
 
 
 } // namespace ndn
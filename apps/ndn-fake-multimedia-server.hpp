@@ -24,6 +24,7 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
 #include "ndn-app.hpp"
+#include "ndn-file-catalog.hpp"
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
 #include "ns3/nstime.h"
@@ -62,17 +63,20 @@ protected:
   CompressString(std::string input, std::stringstream& outputStream);
 
   void
-  ReturnManifestData(shared_ptr<const Interest> interest, std::string& fname); // return file-manifest data
+  GetSegmentEntry(const Name& interestName, FileCatalogEntry& file); // size and payload size of the requested segment
+
+  bool
+  ParseSegmentName(const char* begin, const char* end, uint32_t& repIndex, uint32_t& segmentNr) const; // repr_<id>_seg_<nr>.264
 
   void
-  ReturnVirtualPayloadData(shared_ptr<const Interest> interest, std::string& fname, uint32_t seqNo);
+  ReturnManifestData(shared_ptr<const Interest> interest, const FileCatalogEntry& file); // return file-manifest data
 
   void
-  ReturnPayloadData(shared_ptr<const Interest> interest, std::string& fname, uint32_t seqNo, const char* payload, int payload_size);
+  ReturnVirtualPayloadData(shared_ptr<const Interest> interest, const FileCatalogEntry& file, uint32_t seqNo);
 
+  void
+  ReturnPayloadData(shared_ptr<const Interest> interest, const FileCatalogEntry& file, uint32_t seqNo, const char* payload, int payload_size);
 
-  long
-  GetFileSize(std::string filename);
 
   uint16_t
   GetFaceMTU(uint32_t faceId);
@@ -80,28 +84,56 @@ protected:
   size_t
   EstimateOverhead(std::string& fname);
 
+  uint32_t
+  EstimatePayloadSize(const Name& fileName); // MTU minus overhead, at least 1 byte
+
   uint16_t m_MTU;
 
 
   ndn::time::milliseconds m_freshnessTime;
 
 private:
+  /**
+   * \brief Representations and compressed MPD generated from a meta data file, shared by all
+   * servers with the same meta data file and prefix
+   */
+  struct MultimediaContent
+  {
+    struct Representation
+    {
+      std::string id;
+      long segmentSize; ///< \brief all segments of a representation have the same size
+    };
+
+    std::vector<Representation> representations;
+    std::unordered_map<std::string, uint32_t> representationIndex; ///< \brief index in representations by id
+    uint32_t numberOfSegments;
+    std::string mpdFileContent;
+  };
+
+  shared_ptr<const MultimediaContent>
+  GetContent();
+
   std::string m_prefix;
   std::string m_metaDataFile;
   std::string m_postfixManifest;
+  Name m_manifestPostfixName;
   std::string m_mpdFileName;
+  Name m_prefixName;
+  Name m_mpdName;
 
-  std::string m_mpdFileContent;
-
-  std::map<std::string,long> m_fileSizes;
-  std::map<std::string,size_t> m_packetSizes;
+  shared_ptr<const MultimediaContent> m_content;
+  FileCatalogEntry m_mpdFile;
+  std::vector<uint32_t> m_segmentPayloadSizes; ///< \brief indexed by representation and segment number, 0 if not requested yet
+  std::unordered_map<Name, uint32_t, FileNameHash> m_otherPayloadSizes; ///< \brief payload sizes of the last requested names that are not segments
 
 
-  uint32_t m_maxPayloadSize;
   Time m_freshness;
 
   uint32_t m_signature;
   Name m_keyLocator;
+
+  bool m_fileInfoInChunks;
 };
 
 } // namespace ndn
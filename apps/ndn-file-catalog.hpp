@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2015 Christian Kreuzberger and Daniel Posch, Alpen-Adria-University 
+ * Klagenfurt
+ *
+ * This file is part of amus-ndnSIM, based on ndnSIM. See AUTHORS for complete list of 
+ * authors and contributors.
+ *
+ * amus-ndnSIM and ndnSIM are free software: you can redistribute it and/or modify it 
+ * under the terms of the GNU General Public License as published by the Free Software 
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * amus-ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * amus-ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_FILE_CATALOG_H
+#define NDN_FILE_CATALOG_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * \brief What a file serving app needs to know about a file to answer Interests for its chunks,
+ * derived once when the file is added to the catalog
+ */
+struct FileCatalogEntry
+{
+  Name name;               ///< \brief name of the file, i.e., the Interest name without its last component
+  std::string path;        ///< \brief name of the file within the app (e.g., path on disk)
+  long fileSize;           ///< \brief size of the file in bytes, -1 if the file does not exist
+  uint32_t maxPayloadSize; ///< \brief payload size of the data chunks of this file
+  uint32_t lastSeqNo;      ///< \brief sequence number of the last chunk (the server counts from 0)
+};
+
+/**
+ * \brief Hashes the first components of a name, without encoding or copying them
+ */
+inline size_t
+HashFileName(const Name& name, size_t nComponents)
+{
+  size_t seed = 0;
+  for (size_t i = 0; i < nComponents; ++i) {
+    const name::Component& component = name.get(i);
+    boost::hash_range(seed, component.value(), component.value() + component.value_size());
+  }
+  return seed;
+}
+
+/**
+ * \brief Hashes a whole name with HashFileName
+ */
+struct FileNameHash
+{
+  size_t
+  operator()(const Name& name) const
+  {
+    return HashFileName(name, name.size());
+  }
+};
+
+/**
+ * \brief Files served by an app, keyed by the Interest name without its last component
+ *
+ * Entries are looked up by a prefix of the Interest name, so that no name has to be built to
+ * serve a chunk.
+ */
+class FileCatalog
+{
+public:
+  /**
+   * \brief Finds the file named by the first \p nComponents components of \p name
+   * \return the entry of the file, or nullptr if it is not in the catalog
+   */
+  FileCatalogEntry*
+  find(const Name& name, size_t nComponents)
+  {
+    auto range = m_entries.equal_range(HashFileName(name, nComponents));
+    for (auto it = range.first; it != range.second; ++it) {
+      const Name& fileName = it->second.name;
+      if (fileName.size() == nComponents && std::equal(fileName.begin(), fileName.end(), name.begin()))
+        return &it->second;
+    }
+    return nullptr;
+  }
+
+  /**
+   * \brief Adds \p file, replacing an entry with the same name
+   */
+  FileCatalogEntry&
+  insert(const FileCatalogEntry& file)
+  {
+    FileCatalogEntry* entry = find(file.name, file.name.size());
+    if (entry != nullptr) {
+      *entry = file;
+      return *entry;
+    }
+    return m_entries.insert(std::make_pair(HashFileName(file.name, file.name.size()), file))->second;
+  }
+
+  void
+  clear()
+  {
+    m_entries.clear();
+  }
+
+  size_t
+  size() const
+  {
+    return m_entries.size();
+  }
+
+private:
+  std::unordered_multimap<size_t, FileCatalogEntry> m_entries; ///< \brief entries by HashFileName
+};
+
+/**
+ * \brief Whether the last component of an Interest name is the manifest postfix
+ */
+inline bool
+IsManifestInterest(const Name& interestName, const Name& manifestPostfix)
+{
+  return manifestPostfix.size() == 1 && interestName.size() > 0 &&
+         interestName.get(-1) == manifestPostfix.get(0);
+}
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_FILE_CATALOG_H
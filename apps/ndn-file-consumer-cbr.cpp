@@ -82,7 +82,9 @@ FileConsumerCbr::StartApplication()
   }
 
   m_maxSeqNo = m_fileStartWindow;
-  m_sequenceStatus.resize(m_fileStartWindow+1); // set initial size, +1 for the manifest
+  if (m_skipManifest && m_maxSeqNo == 0)
+    m_maxSeqNo = 1; // at least the first chunk, which tells the file size
+  m_sequenceStatus.resize(m_maxSeqNo+1); // set initial size, +1 for the manifest
   m_fileSize = 1; // temporarily setting this
 
   m_inFlight = 0;
@@ -31,6 +31,8 @@
 
 #include "model/ndn-app-face.hpp"
 
+#include "ndn-file-info.hpp"
+
 #include "ns3/wifi-net-device.h"
 
 #include <math.h>
@@ -73,6 +75,9 @@ FileConsumer::GetTypeId(void)
                     MakeTimeAccessor(&FileConsumer::m_interestLifeTime), MakeTimeChecker())
       .AddAttribute("ManifestPostfix", "The manifest string added after a file", StringValue("/manifest"),
                     MakeStringAccessor(&FileConsumer::m_manifestPostfix), MakeStringChecker())
+      .AddAttribute("SkipManifest", "Do not request the manifest, but learn the file size from the first data chunk "
+                    "(requires FileInfoInChunks on the server)", BooleanValue(false),
+                    MakeBooleanAccessor(&FileConsumer::m_skipManifest), MakeBooleanChecker())
       .AddAttribute("WriteOutfile", "Write the downloaded file to outfile (empty means disabled)", StringValue(""),
                     MakeStringAccessor(&FileConsumer::m_outFile), MakeStringChecker())
       .AddAttribute("MaxEstimatedRTT", "The maximum RTT the RTTEstimator should have (in ms)", UintegerValue(500),
@@ -145,6 +150,16 @@ FileConsumer::StartApplication() // Called at time specified by Start
   m_sequenceStatus.clear();
   m_sequenceStatus.resize(1); // set initial size to 1 to cover the manifest
 
+  if (m_skipManifest)
+  {
+    // no manifest, start with requesting the first chunk, which tells the file size
+    m_hasRequestedManifest = true;
+    m_maxSeqNo = 1;
+    m_fileSize = 1; // temporarily setting this
+    m_sequenceStatus.resize(2);
+    m_manifestRequestTime = Simulator::Now().GetMilliSeconds();
+  }
+
 
   m_packetsReceived = m_packetsSent = m_packetsTimeout = m_packetsRetransmitted = 0;
 
@@ -192,6 +207,14 @@ FileConsumer::StopApplication() // Called at time specified by Stop
 
   m_sequenceStatus.clear();
 
+  // forget about prefetched files
+  for (PrefetchedFile& file : m_prefetchedFiles)
+  {
+    for (auto& event : file.chunkTimeoutEvents)
+      Simulator::Cancel(event.second);
+  }
+  m_prefetchedFiles.clear();
+
   if (m_localDataCache != NULL)
   {
     free(m_localDataCache);
@@ -295,22 +318,80 @@ FileConsumer::SendFilePacket()
     return false;
 
 
-  unsigned seq = GetNextSeqNo();
+  NS_LOG_FUNCTION_NOARGS();
 
-  NS_LOG_DEBUG("Requesting Sequence " << seq);
+  if (SendFileChunk(GetCurrentFileState()))
+  {
+    m_curSeqNo++;
+    return true;
+  }
 
-  if (seq > m_maxSeqNo || m_fileSize == 0)
+  if (!m_hasReceivedManifest)
     return false;
 
-  // check if this is a retransmission
-  if (m_sequenceStatus[seq] == TimedOut)
-    m_packetsRetransmitted++;
+  // all chunks of the current file have been requested, keep the window busy with prefetched files
+  for (PrefetchedFile& file : m_prefetchedFiles)
+  {
+    if (SendFileChunk(GetFileState(file)))
+      return true;
+  }
 
-  m_sequenceStatus[seq] = Requested;
-  m_sequenceSendTime[seq] = Simulator::Now().GetMilliSeconds();
+  // nothing left to request, maybe there is another file to download
+  size_t nPrefetched = m_prefetchedFiles.size();
+  if (!m_finishedDownloadingFile)
+    OnAllChunksRequested();
 
-  NS_LOG_FUNCTION_NOARGS();
+  if (m_prefetchedFiles.size() == nPrefetched)
+    return false;
 
+  return SendFileChunk(GetFileState(m_prefetchedFiles.back()));
+}
+
+
+bool
+FileConsumer::SendFileChunk(FileState file)
+{
+  uint32_t seqNo;
+
+  if (!file.hasRequestedManifest)
+  {
+    // without the manifest, the first chunk tells the file size
+    seqNo = m_skipManifest ? 1 : 0;
+    file.hasRequestedManifest = true;
+    file.manifestRequestTime = Simulator::Now().GetMilliSeconds();
+  } else
+  {
+    seqNo = FindNextSeqNo(file);
+
+    if (seqNo > file.maxSeqNo || file.fileSize == 0)
+      return false;
+  }
+
+  NS_LOG_DEBUG("Requesting Sequence " << seqNo << " of " << file.name);
+  SendChunkInterest(file, seqNo);
+  return true;
+}
+
+
+void
+FileConsumer::SendChunkInterest(FileState file, uint32_t seqNo)
+{
+  shared_ptr<Name> name = make_shared<Name>(file.name);
+
+  if (seqNo == 0)
+  {
+    name->append(m_manifestPostfix);
+  } else
+  {
+    // check if this is a retransmission
+    if (file.sequenceStatus[seqNo] == TimedOut)
+      m_packetsRetransmitted++;
+
+    name->appendSequenceNumber(seqNo);
+    file.sequenceSendTime[seqNo] = Simulator::Now().GetMilliSeconds();
+  }
+
+  file.sequenceStatus[seqNo] = Requested;
 
   // set the interest lifetime
   double timeout = 1.0 * EstimatedRTT + 4.0 * DeviationRTT; // , where u = 1 and q = 4
@@ -318,33 +399,23 @@ FileConsumer::SendFilePacket()
   if (timeout < MINIMUM_TIMEOUT)
     timeout = MINIMUM_TIMEOUT;
 
-
   m_interestLifeTime = ns3::Time::FromDouble(timeout, ns3::Time::MS);
 
-  shared_ptr<Name> nameWithSequence = make_shared<Name>(m_interestName);
-
-  nameWithSequence->appendSequenceNumber(seq);
-
   shared_ptr<Interest> interest = make_shared<Interest>();
 
   // m_rand returns a double value - multiply by 1000, else (int)nonce is always 0 !!!
   interest->setNonce(m_rand->GetValue()*1000);
-  interest->setName(*nameWithSequence);
+  interest->setName(*name);
 
   time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
   interest->setInterestLifetime(interestLifeTime);
 
-  CreateTimeoutEvent(seq, m_interestLifeTime.GetMilliSeconds());
-
-  NS_LOG_INFO("> File INTEREST (Seq: " << seq << "): " << interest->getName());
+  ScheduleChunkTimeout(file, seqNo, m_interestLifeTime.GetMilliSeconds());
 
+  NS_LOG_INFO("> File INTEREST (Seq: " << seqNo << "): " << interest->getName());
 
   m_transmittedInterests(interest, this, m_face);
   m_face->onReceiveInterest(*interest);
-
-  m_curSeqNo++;
-
-  return true;
 }
 
 
@@ -352,20 +423,27 @@ FileConsumer::SendFilePacket()
 // find a sequence number that has not been requested yet or timed out
 uint32_t
 FileConsumer::GetNextSeqNo()
+{
+  return FindNextSeqNo(GetCurrentFileState());
+}
+
+
+uint32_t
+FileConsumer::FindNextSeqNo(const FileState& file) const
 {
   // start by counting from 1 (seqNo = 0 is the manifest)
   uint32_t seqNo = 1;
 
-  for (; seqNo <= m_maxSeqNo; seqNo ++)
+  for (; seqNo <= file.maxSeqNo; seqNo ++)
   {
-    auto seqStatus = m_sequenceStatus[seqNo];
+    auto seqStatus = file.sequenceStatus[seqNo];
     if (seqStatus == NotRequested || seqStatus == TimedOut)
     {
       return seqNo;
     }
   }
 
-  return m_maxSeqNo+1;
+  return file.maxSeqNo+1;
 }
 
 
@@ -392,14 +470,22 @@ FileConsumer::AreAllSeqReceived()
 void
 FileConsumer::CreateTimeoutEvent(uint32_t seqNo, uint32_t timeout)
 {
-  if (m_chunkTimeoutEvents.find( seqNo ) != m_chunkTimeoutEvents.end())
+  ScheduleChunkTimeout(GetCurrentFileState(), seqNo, timeout);
+}
+
+
+void
+FileConsumer::ScheduleChunkTimeout(FileState file, uint32_t seqNo, uint32_t timeout)
+{
+  if (file.chunkTimeoutEvents.find( seqNo ) != file.chunkTimeoutEvents.end())
   {
-    Simulator::Cancel(m_chunkTimeoutEvents[seqNo]);
-    m_chunkTimeoutEvents[seqNo].Cancel();
+    Simulator::Cancel(file.chunkTimeoutEvents[seqNo]);
   }
 
   // schedule the timeout event 1 miliseconds after the interest lifetime is over (just in case, we don't want events to trigger at the same time)
-  m_chunkTimeoutEvents[seqNo] = Simulator::Schedule(MilliSeconds(timeout+1), &FileConsumer::CheckSeqForTimeout, this, seqNo);
+  // the file name tells whether the chunk still belongs to the current file once the timeout fires
+  file.chunkTimeoutEvents[seqNo] = Simulator::Schedule(MilliSeconds(timeout+1), &FileConsumer::CheckFileForTimeout,
+                                                       this, file.name, seqNo);
 }
 
 
@@ -418,6 +504,9 @@ FileConsumer::CheckSeqForTimeout(uint32_t seqNo)
     return;
   }
 
+  if (seqNo >= m_sequenceStatus.size())
+    return; // requested beyond the end of the file
+
   if (m_sequenceStatus[seqNo] != Received)
   {
     // means this sequence has timed out
@@ -435,6 +524,12 @@ FileConsumer::CheckSeqForTimeout(uint32_t seqNo)
 
     // call ontimeout
     OnTimeout(seqNo);
+
+    if (!m_hasReceivedManifest)
+    {
+      // the file size is still unknown, nothing else will request this chunk again
+      ScheduleNextSendEvent();
+    }
   }
 }
 
@@ -478,86 +573,130 @@ FileConsumer::OnData(shared_ptr<const Data> data)
     }
   }
 
+  // check whether this belongs to a prefetched file
+  for (PrefetchedFile& file : m_prefetchedFiles)
+  {
+    if (file.name.isPrefixOf(data->getName()))
+    {
+      OnFileChunk(GetFileState(file), data);
+      return;
+    }
+  }
+
+  OnFileChunk(GetCurrentFileState(), data);
+}
+
+
+void
+FileConsumer::OnFileChunk(FileState file, shared_ptr<const Data> data)
+{
   // get interest name
   ndn::Name interestName = data->getName();
 
   // Check whether this is a Manifest Packet or a Data Packet
   // Manifest packets will end with m_manifestPostfix
-  // only check if we haven't received the manifest yet
-  if (!m_hasReceivedManifest)
-  {
-    ndn::Name  lastPostfix = interestName.getSubName(interestName.size() -1 );
+  bool isManifest = (interestName.getSubName(interestName.size() -1 ) == m_manifestPostfix);
 
-    NS_LOG_INFO("< LastPostfix = " << lastPostfix);
+  bool receivedFileInfo = false;
 
-    if (lastPostfix == m_manifestPostfix)
-    {
-      // this means we have just received the manifest
-      // get the content value: cast unit8_t* to long* and then dereference it
-      //long fileSize =  *((long*)data->getContent().value());
+  long fileSize;
+  uint32_t maxPayload;
 
-      uint8_t *buffer = ((uint8_t*)data->getContent().value());
-      long fileSize;
-      int maxPayload;
-      memcpy(&fileSize, buffer, sizeof(long));
-      memcpy(&maxPayload, buffer+sizeof(long), sizeof(unsigned));
+  // only check if we haven't received the manifest yet
+  if (!file.hasReceivedManifest && ReadFileInfo(*data, isManifest, fileSize, maxPayload))
+  {
+    NS_LOG_DEBUG("FileConsumer: Received " << (isManifest ? "Manifest" : "file info") << " of " << file.name << "! FileSize=" << fileSize << ", MaxPayload=" << maxPayload);
+    file.hasReceivedManifest = true;
+    receivedFileInfo = file.isCurrent;
 
+    if (isManifest)
+    {
+      Simulator::Cancel(file.chunkTimeoutEvents[0]);
+      file.chunkTimeoutEvents.erase(0);
+    }
 
-      NS_LOG_DEBUG("FileConsumer: Received Manifest! FileSize=" << fileSize << ", MaxPayload=" << maxPayload);
-      m_hasReceivedManifest = true;
-      m_fileSize = fileSize;
-      m_maxPayloadSize = maxPayload;
+    bool isFound = ApplyFileInfo(file, fileSize, maxPayload);
 
-      if (m_fileSize == -1)
-      {
-        NS_LOG_UNCOND("ERROR: FileConsumer: File not found on server: " << interestName);
-        m_fileSize = 0;
-        m_curSeqNo = 0;
-        m_maxSeqNo = 0;
-      } else
+    if (file.isCurrent)
+    {
+      if (!isFound)
       {
+        // file not found, stop requesting it
+        Simulator::Cancel(m_sendEvent);
+        return;
+      }
+
+      if (isManifest)
         m_curSeqNo = 0;
-        m_maxSeqNo = ceil((double)m_fileSize/(double)m_maxPayloadSize);
-        NS_LOG_DEBUG("FileConsumer: Resulting Max Seq Nr = " << m_maxSeqNo);
 
-        // Trigger OnManifest
-        m_chunkTimeoutEvents[0].Cancel();
-        OnManifest(fileSize);
-        AfterData(true, false, 0);
-      }
+      // Trigger OnManifest
+      OnManifest(fileSize);
+    } else
+    {
+      // the callbacks only concern the current file
+      file.sequenceStatus[0] = Received;
 
-      return;
+      if (isManifest)
+        UpdateRTT(Simulator::Now().GetMilliSeconds() - file.manifestRequestTime);
+
+      if (isFound)
+        m_manifestReceivedTrace(this, make_shared<Name>(file.name), fileSize);
     }
   }
-  // else: this is a normal data packet, process it as such a data packet
+
+  if (isManifest)
+  {
+    // (possibly a duplicate) manifest, no chunk to process
+    AfterData(receivedFileInfo, false, 0);
+    return;
+  }
 
   // Get seq_nr from Interest Name
   uint32_t seqNo = interestName.at(-1).toSequenceNumber();
-  m_lastSeqNoReceived = seqNo;
+
+  if (seqNo == 0 || seqNo > file.maxSeqNo || seqNo >= file.sequenceStatus.size())
+  {
+    // chunk beyond the end of the file
+    AfterData(receivedFileInfo, false, seqNo);
+    return;
+  }
 
   // make sure that we mark this sequence as received
-  m_sequenceStatus[seqNo] = Received;
+  file.sequenceStatus[seqNo] = Received;
 
-  if (m_chunkTimeoutEvents.find( seqNo ) != m_chunkTimeoutEvents.end())
+  auto event = file.chunkTimeoutEvents.find(seqNo);
+  if (event != file.chunkTimeoutEvents.end())
   {
     // cancel timeout event
-    Simulator::Cancel(m_chunkTimeoutEvents[seqNo]);
-    m_chunkTimeoutEvents[seqNo].Cancel();
-    m_chunkTimeoutEvents.erase(seqNo);
+    Simulator::Cancel(event->second);
+    file.chunkTimeoutEvents.erase(event);
   } // else: don't bother, probably was a duplicate
 
-  // trigger OnFileData
-  NS_LOG_DEBUG("SeqNo: " << seqNo);
-  NS_LOG_DEBUG("Contentvaluesize: " << data->getContent().value_size());
-  OnFileData(seqNo, data->getContent().value(), data->getContent().value_size());
+  if (file.isCurrent)
+  {
+    m_lastSeqNoReceived = seqNo;
+
+    // trigger OnFileData
+    NS_LOG_DEBUG("SeqNo: " << seqNo);
+    NS_LOG_DEBUG("Contentvaluesize: " << data->getContent().value_size());
+    OnFileData(seqNo, data->getContent().value(), data->getContent().value_size());
 
-  // check if everything has been received
-  if (!m_finishedDownloadingFile && AreAllSeqReceived())
+    // check if everything has been received
+    if (!m_finishedDownloadingFile && AreAllSeqReceived())
+    {
+      OnFileReceived(0, 0);
+    }
+  } else
   {
-    OnFileReceived(0, 0);
+    auto sendTime = file.sequenceSendTime.find(seqNo);
+    if (sendTime != file.sequenceSendTime.end())
+    {
+      UpdateRTT(Simulator::Now().GetMilliSeconds() - sendTime->second);
+      file.sequenceSendTime.erase(sendTime);
+    }
   }
 
-  AfterData(false, false, seqNo);
+  AfterData(receivedFileInfo, false, seqNo);
 }
 
 
@@ -669,7 +808,13 @@ FileConsumer::OnFileData(uint32_t seq_nr, const uint8_t* data, unsigned length)
   m_sequenceSendTime.erase(seq_nr);
 //  delete m_sequenceSendTime[seq_nr];
 
+  UpdateRTT(SampleRTT);
+}
 
+
+void
+FileConsumer::UpdateRTT(long SampleRTT)
+{
   // 90% of estimated + 10% of measured RTT
   EstimatedRTT = (1-BETA) * EstimatedRTT + BETA * SampleRTT;
 
@@ -679,7 +824,6 @@ FileConsumer::OnFileData(uint32_t seq_nr, const uint8_t* data, unsigned length)
     absDiff = MINIMUM_DEVIATION;
 
   DeviationRTT = (1-ALPHA)* DeviationRTT + ALPHA * absDiff;
-
 }
 
 void
@@ -754,6 +898,229 @@ FileConsumer::OnFileReceived(unsigned status, unsigned length)
 }
 
 
+void
+FileConsumer::OnAllChunksRequested()
+{
+  // by default, files are downloaded one at a time
+}
+
+
+void
+FileConsumer::PrefetchFile(const Name& fileName)
+{
+  NS_LOG_FUNCTION(this << fileName);
+
+  PrefetchedFile file;
+  file.name = fileName;
+  file.hasRequestedManifest = false;
+  file.hasReceivedManifest = false;
+  file.fileSize = m_skipManifest ? 1 : 0; // temporarily, until the first chunk tells the file size
+  file.maxPayloadSize = 0;
+  file.maxSeqNo = m_skipManifest ? 1 : 0;
+  file.sequenceStatus.resize(file.maxSeqNo+1); // the manifest (and the first chunk)
+  file.manifestRequestTime = 0;
+  file.startTime = Simulator::Now().GetMilliSeconds();
+
+  m_prefetchedFiles.push_back(file);
+
+  m_downloadStartedTrace(this, make_shared<Name>(fileName));
+}
+
+
+bool
+FileConsumer::StartPrefetchedFile()
+{
+  if (m_prefetchedFiles.empty())
+    return false;
+
+  PrefetchedFile& file = m_prefetchedFiles.front();
+  NS_LOG_DEBUG("Continuing with prefetched file " << file.name);
+
+  // drop whatever is left of the current file
+  AbortFile();
+
+  if (m_localDataCache != NULL)
+  {
+    free(m_localDataCache);
+    m_localDataCache = NULL;
+  }
+  m_outFile = "";
+
+  m_interestName = file.name;
+  m_hasRequestedManifest = file.hasRequestedManifest;
+  m_hasReceivedManifest = file.hasReceivedManifest;
+  m_finishedDownloadingFile = false;
+
+  m_fileSize = file.fileSize;
+  m_maxPayloadSize = file.maxPayloadSize;
+  m_curSeqNo = 0;
+  m_maxSeqNo = file.maxSeqNo;
+  m_lastSeqNoReceived = -1;
+
+  m_sequenceStatus.swap(file.sequenceStatus);
+  m_chunkTimeoutEvents.swap(file.chunkTimeoutEvents);
+  m_sequenceSendTime.swap(file.sequenceSendTime);
+  m_manifestRequestTime = file.manifestRequestTime;
+
+  _start_time = file.startTime;
+  _shared_interestName = make_shared<Name>(m_interestName);
+
+  m_prefetchedFiles.pop_front();
+
+  if (m_hasReceivedManifest && AreAllSeqReceived())
+  {
+    // the whole file arrived while it was prefetched
+    Simulator::ScheduleNow(&FileConsumer::OnFileReceived, this, 0, 0);
+  } else
+  {
+    ScheduleNextSendEvent();
+  }
+
+  if (!m_packetStatsUpdateEvent.IsRunning())
+    PacketStatsUpdateEvent();
+
+  return true;
+}
+
+
+void
+FileConsumer::AbortFile()
+{
+  NS_LOG_FUNCTION(this << m_interestName);
+
+  Simulator::Cancel(m_sendEvent);
+
+  for (auto& event : m_chunkTimeoutEvents)
+    Simulator::Cancel(event.second);
+  m_chunkTimeoutEvents.clear();
+
+  // outstanding Interests of this file are not waited for anymore
+  m_sequenceSendTime.clear();
+  m_finishedDownloadingFile = true;
+}
+
+
+void
+FileConsumer::CheckFileForTimeout(Name fileName, uint32_t seqNo)
+{
+  if (fileName == m_interestName)
+  {
+    // the current file (which might have been prefetched)
+    CheckSeqForTimeout(seqNo);
+    return;
+  }
+
+  for (PrefetchedFile& file : m_prefetchedFiles)
+  {
+    if (file.name != fileName)
+      continue;
+
+    file.chunkTimeoutEvents.erase(seqNo);
+
+    if (file.sequenceStatus[seqNo] == Received)
+      return;
+
+    file.sequenceStatus[seqNo] = TimedOut;
+
+    if (!file.hasReceivedManifest)
+    {
+      // request the manifest (or the first chunk) again
+      file.hasRequestedManifest = false;
+      SendPacket();
+      return;
+    }
+
+    NS_LOG_DEBUG("Timeout occured for seq " << seqNo << " of prefetched file " << fileName);
+    m_packetsTimeout++;
+
+    // update estimated rtt
+    EstimatedRTT = EstimatedRTT * 2;
+    if (EstimatedRTT > m_maxRTT)
+      EstimatedRTT = m_maxRTT;
+
+    OnTimeout(seqNo);
+    return;
+  }
+}
+
+
+FileConsumer::FileState
+FileConsumer::GetCurrentFileState()
+{
+  return FileState{true, m_interestName, m_hasRequestedManifest, m_hasReceivedManifest,
+                   m_manifestRequestTime, m_fileSize, m_maxPayloadSize, m_maxSeqNo,
+                   m_sequenceStatus, m_chunkTimeoutEvents, m_sequenceSendTime};
+}
+
+
+FileConsumer::FileState
+FileConsumer::GetFileState(PrefetchedFile& file)
+{
+  return FileState{false, file.name, file.hasRequestedManifest, file.hasReceivedManifest,
+                   file.manifestRequestTime, file.fileSize, file.maxPayloadSize, file.maxSeqNo,
+                   file.sequenceStatus, file.chunkTimeoutEvents, file.sequenceSendTime};
+}
+
+
+bool
+FileConsumer::ReadFileInfo(const Data& data, bool isManifest, long& fileSize, uint32_t& maxPayload) const
+{
+  if (isManifest)
+  {
+    // the manifest carries the file size followed by the maximum payload size
+    const uint8_t* buffer = data.getContent().value();
+    memcpy(&fileSize, buffer, sizeof(long));
+    memcpy(&maxPayload, buffer+sizeof(long), sizeof(unsigned));
+    return true;
+  }
+
+  // the first chunk that arrives replaces the manifest
+  return m_skipManifest && GetFileInfo(data, fileSize, maxPayload);
+}
+
+
+bool
+FileConsumer::ApplyFileInfo(FileState file, long fileSize, uint32_t maxPayload)
+{
+  if (fileSize < 0 || maxPayload == 0)
+  {
+    if (fileSize == -1)
+      NS_LOG_UNCOND("ERROR: FileConsumer: File not found on server: " << file.name);
+    else
+      NS_LOG_UNCOND("ERROR: FileConsumer: Invalid file info (FileSize=" << fileSize << ", MaxPayload=" << maxPayload << ") for " << file.name);
+    file.fileSize = 0;
+    file.maxSeqNo = 0;
+
+    // nothing to wait for anymore
+    for (auto& event : file.chunkTimeoutEvents)
+      Simulator::Cancel(event.second);
+    file.chunkTimeoutEvents.clear();
+    file.sequenceSendTime.clear();
+    return false;
+  }
+
+  file.fileSize = fileSize;
+  file.maxPayloadSize = maxPayload;
+  file.maxSeqNo = ceil((double)file.fileSize/(double)file.maxPayloadSize);
+  NS_LOG_DEBUG("FileConsumer: Resulting Max Seq Nr = " << file.maxSeqNo);
+
+  // chunks requested beyond the end of the file will not be answered
+  for (uint32_t seq = file.maxSeqNo+1; seq < file.sequenceStatus.size(); seq++)
+  {
+    auto event = file.chunkTimeoutEvents.find(seq);
+    if (event != file.chunkTimeoutEvents.end())
+    {
+      Simulator::Cancel(event->second);
+      file.chunkTimeoutEvents.erase(event);
+    }
+    file.sequenceSendTime.erase(seq);
+  }
+
+  file.sequenceStatus.resize(file.maxSeqNo+1);
+  return true;
+}
+
+
 bool
 FileConsumer::DecompressFile ( std::string source, std::string filename )
 {
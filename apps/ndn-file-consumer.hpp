@@ -45,6 +45,8 @@
 #include "ns3/integer.h"
 #include "ns3/double.h"
 
+#include <deque>
+
 
 
 #define MAX_RTT 1000.0
@@ -131,6 +133,38 @@ protected:
   CheckSeqForTimeout(uint32_t seqNo);
 
 
+  /**
+   * \brief Called when every chunk of the current and the prefetched files has been requested,
+   * while the current file is still being downloaded; subclasses can call PrefetchFile here
+   */
+  virtual void
+  OnAllChunksRequested();
+
+  /**
+   * \brief Start downloading another file while the current one is still in progress
+   * Interests for the prefetched file are sent in the same window as the interests of the
+   * current file, once all chunks of the current file have been requested. Prefetched files are
+   * not written to the outfile.
+   */
+  void
+  PrefetchFile(const Name& fileName);
+
+  /**
+   * \brief Replace the current file by the oldest prefetched file, keeping the chunks that have
+   * already been requested or received
+   * \return false if no file has been prefetched
+   */
+  bool
+  StartPrefetchedFile();
+
+  /**
+   * \brief Stop downloading the current file: cancel its pending send event and chunk timeouts and
+   * forget about its outstanding Interests; prefetched files keep downloading
+   */
+  void
+  AbortFile();
+
+
   long
   GetFaceBitrate(uint32_t faceId);
 
@@ -144,6 +178,7 @@ protected:
   Time m_interestLifeTime; ///< \brief LifeTime for interest packet
 
   std::string m_manifestPostfix;
+  bool m_skipManifest;     ///< \brief whether the file size is learned from the first data chunk instead of the manifest
 
 
   bool m_hasRequestedManifest;
@@ -185,6 +220,51 @@ protected:
   EventId m_packetStatsUpdateEvent;
 
 
+  /**
+   * \brief Download state of a file that has been prefetched
+   */
+  struct PrefetchedFile
+  {
+    Name name;
+    bool hasRequestedManifest;
+    bool hasReceivedManifest;
+    long fileSize;
+    uint32_t maxPayloadSize;
+    uint32_t maxSeqNo;
+    std::vector<SequenceStatus> sequenceStatus;
+    std::map<uint32_t,EventId> chunkTimeoutEvents;
+    std::map<uint32_t,long> sequenceSendTime;
+    long manifestRequestTime;
+    int64_t startTime;
+  };
+
+  std::deque<PrefetchedFile> m_prefetchedFiles; ///< \brief files downloaded after the current one, oldest first
+
+  /**
+   * \brief References to the download state of one file, either the current or a prefetched one
+   */
+  struct FileState
+  {
+    bool isCurrent; ///< \brief whether this is the current file, which triggers the virtual callbacks
+    const Name& name;
+    bool& hasRequestedManifest;
+    bool& hasReceivedManifest;
+    long& manifestRequestTime;
+    long& fileSize;
+    uint32_t& maxPayloadSize;
+    uint32_t& maxSeqNo;
+    std::vector<SequenceStatus>& sequenceStatus;
+    std::map<uint32_t,EventId>& chunkTimeoutEvents;
+    std::map<uint32_t,long>& sequenceSendTime;
+  };
+
+  FileState
+  GetCurrentFileState();
+
+  static FileState
+  GetFileState(PrefetchedFile& file);
+
+
 protected: // callbacks/traces
   TracedCallback<Ptr<ns3::ndn::App> /* app */, shared_ptr<const Name> /* interestName */> m_downloadStartedTrace;
   TracedCallback<Ptr<ns3::ndn::App> /* app */, shared_ptr<const Name> /* interestName */,
@@ -208,6 +288,57 @@ private:
   double
   CalculateDownloadSpeed();
 
+  void
+  UpdateRTT(long SampleRTT);
+
+  /**
+   * \brief Request the next chunk of a file that has not been requested yet or timed out (or, if
+   * nothing has been requested yet, its manifest or first chunk)
+   * \return false if nothing is left to request
+   */
+  bool
+  SendFileChunk(FileState file);
+
+  /**
+   * \return the first chunk of a file that has not been requested yet or timed out, or
+   * maxSeqNo+1 if there is none
+   */
+  uint32_t
+  FindNextSeqNo(const FileState& file) const;
+
+  /**
+   * \brief Process a manifest or data chunk of a file
+   */
+  void
+  OnFileChunk(FileState file, shared_ptr<const Data> data);
+
+  void
+  CheckFileForTimeout(Name fileName, uint32_t seqNo);
+
+  /**
+   * \brief Request chunk seqNo of a file (0 is the manifest), with a lifetime that follows the
+   * current RTT estimate, and schedule its timeout
+   */
+  void
+  SendChunkInterest(FileState file, uint32_t seqNo);
+
+  void
+  ScheduleChunkTimeout(FileState file, uint32_t seqNo, uint32_t timeout);
+
+  /**
+   * \brief Read the file size and the maximum payload size from a manifest or, with SkipManifest,
+   * from the file info of a data chunk
+   * \return false if data carries neither
+   */
+  bool
+  ReadFileInfo(const Data& data, bool isManifest, long& fileSize, uint32_t& maxPayload) const;
+
+  /**
+   * \brief Size the download state of a file after its manifest or file info arrived
+   * \return false if the server did not find the file (fileSize = -1) or the file info is invalid
+   */
+  bool
+  ApplyFileInfo(FileState file, long fileSize, uint32_t maxPayload);
 
 
 };
@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2015 Christian Kreuzberger and Daniel Posch, Alpen-Adria-University 
+ * Klagenfurt
+ *
+ * This file is part of amus-ndnSIM, based on ndnSIM. See AUTHORS for complete list of 
+ * authors and contributors.
+ *
+ * amus-ndnSIM and ndnSIM are free software: you can redistribute it and/or modify it 
+ * under the terms of the GNU General Public License as published by the Free Software 
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * amus-ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * amus-ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_FILE_INFO_H
+#define NDN_FILE_INFO_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <math.h>
+#include <limits>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * \brief TLV types of the application-specific MetaInfo blocks which carry the size of a file in
+ * its data chunks, so that consumers can download the file without requesting the manifest
+ *
+ * A chunk of a file that was not found carries an empty FileMissing block instead of the file size.
+ */
+enum FileInfoTlvType { FileSizeTlvType = 128, MaxPayloadSizeTlvType = 129, FileMissingTlvType = 130 };
+
+/**
+ * \brief Put the file size and the payload size of the chunks into a data chunk, as well as the
+ * sequence number of the last chunk as FinalBlockId (consumers count chunks starting at 1)
+ *
+ * A negative file size tells that the file was not found, like in the manifest.
+ */
+inline void
+AddFileInfo(Data& data, long fileSize, uint32_t maxPayloadSize)
+{
+  uint64_t lastSeqNo = fileSize < 0 ? 0 : ceil((double)fileSize / (double)maxPayloadSize);
+  data.setFinalBlockId(name::Component::fromSequenceNumber(lastSeqNo));
+
+  ::ndn::MetaInfo metaInfo = data.getMetaInfo();
+  if (fileSize < 0) {
+    static const uint8_t NO_VALUE = 0;
+    metaInfo.addAppMetaInfo(::ndn::dataBlock(FileMissingTlvType, &NO_VALUE, 0));
+  }
+  else {
+    metaInfo.addAppMetaInfo(::ndn::nonNegativeIntegerBlock(FileSizeTlvType, fileSize));
+  }
+  metaInfo.addAppMetaInfo(::ndn::nonNegativeIntegerBlock(MaxPayloadSizeTlvType, maxPayloadSize));
+  data.setMetaInfo(metaInfo);
+}
+
+/**
+ * \brief Read the file size and the payload size of the chunks from a data chunk
+ *
+ * The file size is -1 if the file was not found.
+ *
+ * \return false if the data chunk does not carry them or carries a file size that does not fit
+ */
+inline bool
+GetFileInfo(const Data& data, long& fileSize, uint32_t& maxPayloadSize)
+{
+  const Block* fileSizeBlock = data.getMetaInfo().findAppMetaInfo(FileSizeTlvType);
+  const Block* fileMissingBlock = data.getMetaInfo().findAppMetaInfo(FileMissingTlvType);
+  const Block* maxPayloadSizeBlock = data.getMetaInfo().findAppMetaInfo(MaxPayloadSizeTlvType);
+
+  if ((fileSizeBlock == nullptr) == (fileMissingBlock == nullptr) || maxPayloadSizeBlock == nullptr)
+    return false;
+
+  uint64_t maxPayload = 0;
+  uint64_t size = 0;
+  try {
+    maxPayload = ::ndn::readNonNegativeInteger(*maxPayloadSizeBlock);
+    if (fileSizeBlock != nullptr)
+      size = ::ndn::readNonNegativeInteger(*fileSizeBlock);
+  }
+  catch (const ::ndn::tlv::Error&) {
+    return false;
+  }
+
+  if (maxPayload > std::numeric_limits<uint32_t>::max()
+      || size > static_cast<uint64_t>(std::numeric_limits<long>::max()))
+    return false;
+
+  fileSize = fileMissingBlock != nullptr ? -1 : static_cast<long>(size);
+
+  maxPayloadSize = static_cast<uint32_t>(maxPayload);
+  return true;
+}
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_FILE_INFO_H
@@ -21,6 +21,7 @@
 #include "ndn-fileserver.hpp"
 #include "ns3/log.h"
 #include "ns3/string.h"
+#include "ns3/boolean.h"
 #include "ns3/uinteger.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
@@ -36,11 +37,15 @@
 #include "model/ndn-l3-protocol.hpp"
 #include "helper/ndn-fib-helper.hpp"
 
+#include "ndn-file-info.hpp"
+#include "ndn-file-catalog.hpp"
+
 #include <memory>
 #include <sys/types.h>
 #include <sys/stat.h>
 
 #include <math.h>
+#include <limits>
 
 
 NS_LOG_COMPONENT_DEFINE("ndn.FileServer");
@@ -77,7 +82,11 @@ FileServer::GetTypeId(void)
          MakeUintegerChecker<uint32_t>())
       .AddAttribute("KeyLocator",
                     "Name to be used for key locator.  If root, then key locator is not used",
-                    NameValue(), MakeNameAccessor(&FileServer::m_keyLocator), MakeNameChecker());
+                    NameValue(), MakeNameAccessor(&FileServer::m_keyLocator), MakeNameChecker())
+      .AddAttribute("FileInfoInChunks",
+                    "Put the file size into every data chunk (and the last sequence number as FinalBlockId), "
+                    "so that consumers do not need to request the manifest",
+                    BooleanValue(false), MakeBooleanAccessor(&FileServer::m_fileInfoInChunks), MakeBooleanChecker());
   return tid;
 }
 
@@ -98,6 +107,9 @@ FileServer::StartApplication()
   FibHelper::AddRoute(GetNode(), m_prefix, m_face, 0);
 
   m_MTU = GetFaceMTU(0);
+
+  m_manifestPostfixName = Name(m_postfixManifest);
+  m_catalog.clear();
 }
 
 void
@@ -130,72 +142,87 @@ FileServer::OnInterest(shared_ptr<const Interest> interest)
   if (!m_active)
     return;
 
-  Name dataName(interest->getName());
-
-  // get last postfix
-  ndn::Name  lastPostfix = dataName.getSubName(dataName.size() -1 );
-  NS_LOG_INFO("> LastPostfix = " << lastPostfix);
+  const Name& interestName = interest->getName();
 
-  bool isManifest = false;
+  bool isManifest = IsManifestInterest(interestName, m_manifestPostfixName);
   uint32_t seqNo = -1;
 
-  if (lastPostfix == m_postfixManifest)
+  if (!isManifest)
   {
-    isManifest = true;
-  }
-  else
-  {
-    seqNo = dataName.at(-1).toSequenceNumber();
+    seqNo = interestName.at(-1).toSequenceNumber();
     seqNo = seqNo - 1; // Christian: the client thinks seqNo = 1 is the first one, for the server it's better to start at 0
   }
 
-  // remove the last postfix
-  dataName = dataName.getPrefix(-1);
-
-  // extract filename and get path to file
-  std::string fname = dataName.toUri();  // get the uri from interest
-
-  // measure how much overhead this actually this
-  int diff = EstimateOverhead(fname);
-  // set new payload size to this value (minus 4 bytes to be safe for sequence numbers, ethernet headers, etc...)
-  m_maxPayloadSize = m_MTU - diff - 4;
-
-  //NS_LOG_UNCOND("NewPayload = " << m_maxPayloadSize << " (Overhead: " << diff << ") ");
-
-  fname = fname.substr(m_prefix.length(), fname.length()); // remove the prefix
-  fname = std::string(m_contentDir).append(fname); // prepend the data path
+  // everything else only depends on the file, i.e., the name without the last postfix
+  const FileCatalogEntry& file = GetCatalogEntry(interestName);
 
   // handle manifest or data
   if (isManifest)
   {
-    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Manifest for file " << fname);
-    ReturnManifestData(interest, fname);
+    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Manifest for file " << file.path);
+    ReturnManifestData(interest, file);
   } else
   {
-    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Payload for file " << fname);
-    NS_LOG_DEBUG("FileName: " << fname);
+    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Payload for file " << file.path);
+    NS_LOG_DEBUG("FileName: " << file.path);
     NS_LOG_DEBUG("SeqNo: " << seqNo);
 
     // check if file exists and the sanity of the sequence number requested
-    long fileSize = GetFileSize(fname);
-
-    if (fileSize == -1)
+    // (consumers which skip the manifest learn about a missing file from the file info of an empty chunk)
+    if (file.fileSize == -1 && !m_fileInfoInChunks)
       return; // file does not exist, just quit
 
-    if (seqNo > ceil(fileSize / m_maxPayloadSize))
+    if (seqNo > file.lastSeqNo)
       return; // sequence not available
 
     // else:
-    ReturnPayloadData(interest, fname, seqNo);
+    ReturnPayloadData(interest, file, seqNo);
+  }
+}
+
+
+
+const FileCatalogEntry&
+FileServer::GetCatalogEntry(const Name& interestName)
+{
+  // the file is named by the Interest name without its last component
+  FileCatalogEntry* entry = m_catalog.find(interestName, interestName.size() - 1);
+  if (entry != nullptr)
+    return *entry;
+
+  // first Interest for this file
+  FileCatalogEntry file;
+  file.name = interestName.getPrefix(-1);
+
+  std::string fname = file.name.toUri();  // get the uri from interest
+
+  // measure how much overhead this actually this
+  int diff = EstimateOverhead(fname);
+  // set new payload size to this value (minus 4 bytes to be safe for sequence numbers, ethernet headers, etc...)
+  file.maxPayloadSize = m_MTU - diff - 4;
+
+  fname = fname.substr(m_prefix.length(), fname.length()); // remove the prefix
+  file.path = std::string(m_contentDir).append(fname); // prepend the data path
+
+  file.fileSize = GetFileSize(file.path);
+  file.lastSeqNo = file.fileSize < 0 ? 0 : file.fileSize / file.maxPayloadSize;
+
+  if (file.fileSize == -1)
+  {
+    // missing files are not remembered, the file might be there on the next Interest
+    m_missingFile = file;
+    return m_missingFile;
   }
+
+  return m_catalog.insert(file);
 }
 
 
 
 void
-FileServer::ReturnManifestData(shared_ptr<const Interest> interest, std::string& fname)
+FileServer::ReturnManifestData(shared_ptr<const Interest> interest, const FileCatalogEntry& file)
 {
-  long fileSize = GetFileSize(fname);
+  long fileSize = file.fileSize;
 
   auto data = make_shared<Data>();
   data->setName(interest->getName());
@@ -204,7 +231,7 @@ FileServer::ReturnManifestData(shared_ptr<const Interest> interest, std::string&
   // create a local buffer variable, which contains a long and an unsigned
   uint8_t buffer[sizeof(long) + sizeof(unsigned)];
   memcpy(buffer, &fileSize, sizeof(long));
-  memcpy(buffer+sizeof(long), &m_maxPayloadSize, sizeof(unsigned));
+  memcpy(buffer+sizeof(long), &file.maxPayloadSize, sizeof(unsigned));
 
   // create content with the file size in it
   data->setContent(reinterpret_cast<const uint8_t*>(buffer), sizeof(long) + sizeof(unsigned));
@@ -234,26 +261,36 @@ FileServer::ReturnManifestData(shared_ptr<const Interest> interest, std::string&
 
 // OON
 void
-FileServer::ReturnPayloadData(shared_ptr<const Interest> interest, std::string& fname, uint32_t seqNo)
+FileServer::ReturnPayloadData(shared_ptr<const Interest> interest, const FileCatalogEntry& file, uint32_t seqNo)
 {
   auto data = make_shared<Data>();
   data->setName(interest->getName());
   data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
 
-  // go to pointer seqNo*m_maxPayloadSize in file
-  FILE* fp = fopen(fname.c_str(), "rb");
-  fseek(fp, seqNo * m_maxPayloadSize, SEEK_SET);
+  if (m_fileInfoInChunks)
+    AddFileInfo(*data, file.fileSize, file.maxPayloadSize);
 
-  auto buffer = make_shared< ::ndn::Buffer>(m_maxPayloadSize);
-  //size_t actualSize = fread(buffer->get(), sizeof(uint8_t), m_maxPayloadSize, fp);
-  // this is make new content
-  fread(buffer->get(), sizeof(uint8_t), m_maxPayloadSize, fp);
-  fclose(fp);
+  if (file.fileSize == -1)
+  {
+    // file does not exist, the (empty) chunk only carries the file info
+    data->setContent(make_shared< ::ndn::Buffer>());
+  } else
+  {
+    // go to pointer seqNo*maxPayloadSize in file
+    FILE* fp = fopen(file.path.c_str(), "rb");
+    fseek(fp, seqNo * file.maxPayloadSize, SEEK_SET);
 
-  /*if (actualSize < m_maxPayloadSize)
-    buffer->resize(actualSize+1);*/
+    auto buffer = make_shared< ::ndn::Buffer>(file.maxPayloadSize);
+    //size_t actualSize = fread(buffer->get(), sizeof(uint8_t), file.maxPayloadSize, fp);
+    // this is make new content
+    fread(buffer->get(), sizeof(uint8_t), file.maxPayloadSize, fp);
+    fclose(fp);
 
-  data->setContent(buffer);
+    /*if (actualSize < m_maxPayloadSize)
+      buffer->resize(actualSize+1);*/
+
+    data->setContent(buffer);
+  }
 
   Signature signature;
   SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
@@ -278,11 +315,6 @@ FileServer::ReturnPayloadData(shared_ptr<const Interest> interest, std::string&
 size_t
 FileServer::EstimateOverhead(std::string& fname)
 {
-  if (m_packetSizes.find(fname) != m_packetSizes.end())
-  {
-    return m_packetSizes[fname];
-  }
-
   uint32_t interestLength = fname.length();
   // estimate the payload size for now
   int estimatedMaxPayloadSize = m_MTU - interestLength - 30; // the -30 is something we saw in results, it's just to estimate...
@@ -291,6 +323,9 @@ FileServer::EstimateOverhead(std::string& fname)
   data->setName(fname + "/1"); // to simulate that there is at least one chunk
   data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
 
+  if (m_fileInfoInChunks)
+    AddFileInfo(*data, std::numeric_limits<long>::max(), std::numeric_limits<uint32_t>::max()); // leave room for the largest file info
+
   auto buffer = make_shared< ::ndn::Buffer>(estimatedMaxPayloadSize);
   data->setContent(buffer);
 
@@ -310,29 +345,19 @@ FileServer::EstimateOverhead(std::string& fname)
   // to create real wire encoding
   Block tmp = data->wireEncode();
 
-  m_packetSizes[fname] = tmp.size() - estimatedMaxPayloadSize;
-
   return tmp.size() - estimatedMaxPayloadSize;
 }
 
 
 
-// GetFileSize either from m_fileSizes map or from disk
+// GetFileSize from disk (the catalog remembers the size of files that exist)
 long FileServer::GetFileSize(std::string filename)
 {
-  // check if is already in m_fileSizes
-  if (m_fileSizes.find(filename) != m_fileSizes.end())
-  {
-    return m_fileSizes[filename];
-  }
-  // else: query disk for file size
-
   struct stat stat_buf;
   int rc = stat(filename.c_str(), &stat_buf);
 
   if (rc == 0)
   {
-    m_fileSizes[filename] = stat_buf.st_size;
     return stat_buf.st_size;
   }
   // else: file not found
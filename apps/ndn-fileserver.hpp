@@ -26,6 +26,7 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
 #include "ndn-app.hpp"
+#include "ndn-file-catalog.hpp"
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
 #include "ns3/nstime.h"
@@ -62,11 +63,14 @@ protected:
   virtual void
   StopApplication(); // Called at time specified by Stop
 
+  const FileCatalogEntry&
+  GetCatalogEntry(const Name& interestName); // look up the file of a chunk or manifest, add it to the catalog on the first request
+
   void
-  ReturnManifestData(shared_ptr<const Interest> interest, std::string& fname); // return file-manifest data
+  ReturnManifestData(shared_ptr<const Interest> interest, const FileCatalogEntry& file); // return file-manifest data
 
   void
-  ReturnPayloadData(shared_ptr<const Interest> interest, std::string& fname, uint32_t seqNo);
+  ReturnPayloadData(shared_ptr<const Interest> interest, const FileCatalogEntry& file, uint32_t seqNo);
 
   long
   GetFileSize(std::string filename);
@@ -84,16 +88,18 @@ private:
   std::string m_prefix;
   std::string m_contentDir;
   std::string m_postfixManifest;
+  Name m_manifestPostfixName;
 
-  std::map<std::string,long> m_fileSizes;
-  std::map<std::string,size_t> m_packetSizes;
+  FileCatalog m_catalog;
+  FileCatalogEntry m_missingFile; ///< \brief entry of the last file that was not found (not kept in m_catalog)
 
 
-  uint32_t m_maxPayloadSize;
   Time m_freshness;
 
   uint32_t m_signature;
   Name m_keyLocator;
+
+  bool m_fileInfoInChunks;
 };
 
 } // namespace ndn
@@ -70,6 +70,9 @@ MultimediaConsumer<Parent>::GetTypeId(void)
                     MakeUintegerAccessor(&MultimediaConsumer<Parent>::m_screenHeight), MakeUintegerChecker<uint32_t>())
       .template AddAttribute("MaxBufferedSeconds", "Maximum amount of buffered seconds allowed", UintegerValue(30),
                     MakeUintegerAccessor(&MultimediaConsumer<Parent>::m_maxBufferedSeconds), MakeUintegerChecker<uint32_t>())
+      .template AddAttribute("MaxSegmentsInFlight", "Maximum number of segments that are downloaded at the same time, "
+                          "sharing the interest window (1 = download one segment after the other)", UintegerValue(1),
+                    MakeUintegerAccessor(&MultimediaConsumer<Parent>::m_maxSegmentsInFlight), MakeUintegerChecker<uint32_t>(1))
       .template AddAttribute("DeviceType", "PC, Laptop, Tablet, Phone, Game Console", StringValue("PC"),
                     MakeStringAccessor(&MultimediaConsumer<Parent>::m_deviceType), MakeStringChecker())
       .template AddAttribute("AllowUpscale", "Define whether or not the client has capabilities to upscale content with lower resolutions", BooleanValue(true),
@@ -148,11 +151,16 @@ MultimediaConsumer<Parent>::StartApplication() // Called at time specified by St
   m_initSegmentIsGlobal = false;
   m_hasInitSegment = false;
   m_hasDownloadedAllSegments = false;
+  m_hasRequestedAllSegments = false;
   m_hasStartedPlaying = false;
+  m_isWaitingForBufferSpace = false;
+  m_isWaitingForAdaptation = false;
+  m_isWaitingForSegment = false;
   m_freezeStartTime = 0;
   totalConsumedSegments = 0;
   requestedRepresentation = NULL;
   requestedSegmentURL = NULL;
+  m_prefetchedSegments.clear();
 
   m_currentDownloadType = MPD;
   m_startTime = Simulator::Now().GetMilliSeconds();
@@ -185,6 +193,8 @@ MultimediaConsumer<Parent>::StopApplication() // Called at time specified by Sto
   m_downloadEventTimer.Cancel();
   Simulator::Cancel(m_downloadEventTimer);
 
+  m_prefetchedSegments.clear();
+
   /*OK LOG ALL NOT RECEIVED FILES FROM MPD*/
   if(traceNotDownloadedSegments)
   {
@@ -506,14 +516,18 @@ MultimediaConsumer<Parent>::OnMultimediaFile()
     if(mPlayer->EnoughSpaceInBuffer(requestedSegmentNr, requestedRepresentation, m_isLayeredContent))
     {
       if(mPlayer->AddToBuffer(requestedSegmentNr, requestedRepresentation, super::lastDownloadBitrate, m_isLayeredContent))
+      {
         NS_LOG_DEBUG("Segment Accepted for Buffering");
+        ResumePlayback();
+      }
       else
         NS_LOG_DEBUG("Segment Rejected for Buffering");
     }
     else
     {
-      // try again in 1 second, and again and again... but do not donwload anything in the meantime
-      Simulator::Schedule(Seconds(1.0), &MultimediaConsumer<Parent>::OnMultimediaFile, this);
+      // try again as soon as playback frees space in the buffer, but do not download anything in the meantime
+      NS_LOG_DEBUG("Buffer full, waiting for playback");
+      m_isWaitingForBufferSpace = true;
       return;
     }
   }
@@ -552,17 +566,55 @@ MultimediaConsumer<Parent>::OnData(shared_ptr<const Data> data)
     return;
   }
 
-  std::string interestName = data->getName().toUri();
+  const Name& dataName = data->getName();
 
-  if(boost::starts_with(interestName, m_baseURL+(requestedSegmentURL->GetMediaURI())))
+  if(m_requestedSegmentName.isPrefixOf(dataName))
   {
     super::OnData(data);
+    return;
+  }
+
+  // or one of the segments that are being prefetched
+  for (const PrefetchedSegment& segment : m_prefetchedSegments)
+  {
+    if(segment.name.isPrefixOf(dataName))
+    {
+      super::OnData(data);
+      return;
+    }
   }
   // else
   // ignore
 }
 
 
+template<class Parent>
+void
+MultimediaConsumer<Parent>::OnAllChunksRequested()
+{
+  // only media segments are prefetched, and only as many as allowed to be in flight
+  // (including the segment that is currently being downloaded)
+  if (!m_mpdParsed || m_currentDownloadType != Segment || m_hasRequestedAllSegments)
+    return;
+
+  if (m_prefetchedSegments.size() + 1 >= m_maxSegmentsInFlight)
+    return;
+
+  PrefetchedSegment next;
+  next.representation = NULL;
+  next.segmentNr = 0;
+  next.segmentURL = mPlayer->GetAdaptationLogic()->GetNextSegment(&next.segmentNr, &next.representation, &m_hasRequestedAllSegments);
+
+  if (m_hasRequestedAllSegments || next.segmentURL == NULL) // DONE or IDLE
+    return;
+
+  NS_LOG_DEBUG("Prefetching segment " << next.segmentNr << " (rep=" << next.representation->GetId() << ")");
+  next.name = Name(m_baseURL + next.segmentURL->GetMediaURI());
+  m_prefetchedSegments.push_back(next);
+  super::PrefetchFile(next.name);
+}
+
+
 template<class Parent>
 void
 MultimediaConsumer<Parent>::ScheduleDownloadOfInitSegment()
@@ -594,8 +646,10 @@ MultimediaConsumer<Parent>::ScheduleDownloadOfSegment()
 {
   // wait 1 ms (dummy time) before downloading next segment - this prevents some issues
   // with start/stop application and interests coming in late.
+  // a prefetched segment does not restart the application, so it can continue right away
+  double wait_time = m_prefetchedSegments.empty() ? 0.001 : 0.0;
   m_downloadEventTimer.Cancel();
-  m_downloadEventTimer = Simulator::Schedule(Seconds(0.001), &MultimediaConsumer<Parent>::DownloadSegment, this);
+  m_downloadEventTimer = Simulator::Schedule(Seconds(wait_time), &MultimediaConsumer<Parent>::DownloadSegment, this);
 }
 
 
@@ -614,6 +668,29 @@ MultimediaConsumer<Parent>::DownloadSegment()
     return;
   }*/
 
+  if (!m_prefetchedSegments.empty())
+  {
+    // the next segment is already being downloaded, make it the requested one
+    const PrefetchedSegment& next = m_prefetchedSegments.front();
+    requestedSegmentURL = next.segmentURL;
+    m_requestedSegmentName = next.name;
+    requestedRepresentation = next.representation;
+    requestedSegmentNr = next.segmentNr;
+    m_prefetchedSegments.pop_front();
+
+    NS_LOG_DEBUG("Continuing with prefetched segment " << requestedSegmentNr);
+    super::StartPrefetchedFile();
+    CheckAbortDownload();
+    return;
+  }
+
+  if (m_hasRequestedAllSegments) // DONE, found out while prefetching
+  {
+    m_hasDownloadedAllSegments = true;
+    NS_LOG_DEBUG("No more segments available for download!\n");
+    return;
+  }
+
   // get segment number and rep id
   requestedRepresentation = NULL;
   requestedSegmentNr = 0;
@@ -629,15 +706,84 @@ MultimediaConsumer<Parent>::DownloadSegment()
   if (requestedSegmentURL == NULL) //IDLE
   {
     NS_LOG_DEBUG("IDLE\n");
-    m_downloadEventTimer = Simulator::Schedule(Seconds(1.0), &MultimediaConsumer<Parent>::DownloadSegment, this);
+    // ask the adaptation logic again as soon as playback frees space in the buffer
+    m_isWaitingForAdaptation = true;
     return;
   }
 
+  m_requestedSegmentName = Name(m_baseURL + requestedSegmentURL->GetMediaURI());
+
   super::StopApplication();
-  super::SetAttribute("FileToRequest", StringValue(m_baseURL + requestedSegmentURL->GetMediaURI()));
+  super::SetAttribute("FileToRequest", StringValue(m_requestedSegmentName.toUri()));
   super::SetAttribute("WriteOutfile", StringValue(""));
   super::SetAttribute("StartWindowSize", StringValue("10"));
   super::StartApplication();
+  CheckAbortDownload();
+}
+
+
+template<class Parent>
+void
+MultimediaConsumer<Parent>::ResumeDownload()
+{
+  if (m_isWaitingForBufferSpace)
+  {
+    // the downloaded segment still waits to be buffered
+    m_isWaitingForBufferSpace = false;
+    m_downloadEventTimer.Cancel();
+    m_downloadEventTimer = Simulator::ScheduleNow(&MultimediaConsumer<Parent>::OnMultimediaFile, this);
+  }
+  else if (m_isWaitingForAdaptation)
+  {
+    m_isWaitingForAdaptation = false;
+    ScheduleDownloadOfSegment();
+  }
+}
+
+
+template<class Parent>
+void
+MultimediaConsumer<Parent>::ResumePlayback()
+{
+  if (m_isWaitingForSegment)
+  {
+    m_isWaitingForSegment = false;
+    SchedulePlay(0.0);
+  }
+}
+
+
+template<class Parent>
+void
+MultimediaConsumer<Parent>::CheckAbortDownload()
+{
+  // only while playback stalls
+  if (!m_isWaitingForSegment)
+    return;
+
+  if(requestedRepresentation != NULL && !m_hasDownloadedAllSegments && requestedRepresentation->GetDependencyId().size() > 0) // means we are downloading something with dependencies
+  {
+    //check buffer state
+    if(!mPlayer->GetAdaptationLogic()->hasMinBufferLevel(requestedRepresentation))
+    {
+      //abort download ...
+      NS_LOG_DEBUG("Aborting to download a segment with repId = " << requestedRepresentation->GetId().c_str());
+      mPlayer->SetLastDownloadBitRate(0.0);//set dl_bitrate to zero.
+
+      if (m_prefetchedSegments.empty())
+      {
+        super::StopApplication();
+        ScheduleDownloadOfSegment();
+        return;
+      }
+
+      // prefetched segments keep downloading, the next one replaces the aborted segment right away,
+      // so that late data of the aborted segment is not taken for it
+      super::AbortFile();
+      m_downloadEventTimer.Cancel();
+      DownloadSegment();
+    }
+  }
 }
 
 
@@ -663,6 +809,9 @@ MultimediaConsumer<Parent>::DoPlay()
   if(consumed_sec > 0) // we play
   {
     SchedulePlay(consumed_sec);
+
+    // playing freed space in the buffer
+    ResumeDownload();
   }
   else if(consumed_sec == 0.0 && m_hasDownloadedAllSegments)
   {
@@ -671,22 +820,14 @@ MultimediaConsumer<Parent>::DoPlay()
   }
   else //we stall
   {
-     //restart timer
-     SchedulePlay(); // with default parm.
+    // continue as soon as the next segment has been buffered
+    m_isWaitingForSegment = true;
+
+    // the buffer is empty now, so a download waiting for space can continue
+    ResumeDownload();
 
     //check if we should abort the download
-    if(requestedRepresentation != NULL && !m_hasDownloadedAllSegments && requestedRepresentation->GetDependencyId().size() > 0) // means we are downloading something with dependencies
-    {
-      //check buffer state
-      if(!mPlayer->GetAdaptationLogic()->hasMinBufferLevel(requestedRepresentation))
-      {
-        //abort download ...
-        NS_LOG_DEBUG("Aborting to download a segment with repId = " << requestedRepresentation->GetId().c_str());
-        super::StopApplication();
-        mPlayer->SetLastDownloadBitRate(0.0);//set dl_bitrate to zero.
-        ScheduleDownloadOfSegment();
-      }
-    }
+    CheckAbortDownload();
   }
 }
 
@@ -56,6 +56,8 @@
 #include <boost/random/random_device.hpp>
 #include <boost/random/uniform_int_distribution.hpp>
 
+#include <deque>
+
 #define MULTIMEDIA_CONSUMER_LOOP_TIMER 0.1
 #define MIN_BUFFER_LEVEL 4.0
 
@@ -106,6 +108,7 @@ protected:
   bool m_allowUpscale;        ///< \brief Whether or not it is possible to upscale content with lower resolutions to the screen width/height
   bool m_allowDownscale;      ///< \brief Whether or not it is possible to downscale content with higher resolutions to the screen width/height
   unsigned int m_maxBufferedSeconds; ///< \brief The maximum amount of buffered seconds
+  unsigned int m_maxSegmentsInFlight; ///< \brief The maximum number of segments that are downloaded at the same time
   double startupDelay;
 
   std::string m_startRepresentationId;  ///< \brief The representation ID for initializing streaming
@@ -144,12 +147,47 @@ protected:
   dash::mpd::ISegmentURL* requestedSegmentURL;
   const dash::mpd::IRepresentation* requestedRepresentation;
   unsigned int requestedSegmentNr;
+  Name m_requestedSegmentName; ///< \brief name of the requested segment, the prefix of its data packets
+
+  /**
+   * \brief A segment that is downloaded while the requested segment is still in progress
+   */
+  struct PrefetchedSegment
+  {
+    dash::mpd::ISegmentURL* segmentURL;
+    const dash::mpd::IRepresentation* representation;
+    unsigned int segmentNr;
+    Name name;
+  };
+
+  std::deque<PrefetchedSegment> m_prefetchedSegments; ///< \brief segments following the requested segment, oldest first
+  bool m_hasRequestedAllSegments; ///< \brief whether the adaptation logic has no more segments to prefetch
+
+  bool m_isWaitingForBufferSpace; ///< \brief the downloaded segment is buffered once playback frees space
+  bool m_isWaitingForAdaptation;  ///< \brief the adaptation logic is asked again once playback frees space
+  bool m_isWaitingForSegment;     ///< \brief playback stalls until the next segment is buffered
 
 
   void SchedulePlay(double wait_time = MULTIMEDIA_CONSUMER_LOOP_TIMER);
   void DoPlay();
   double consume();
 
+  /**
+   * \brief Called when playback freed space in the buffer, continues a download that waits for it
+   */
+  void ResumeDownload();
+
+  /**
+   * \brief Called when a segment has been buffered, continues a stalled playback
+   */
+  void ResumePlayback();
+
+  /**
+   * \brief Aborts the download of a segment with dependencies while playback stalls and the
+   * buffer does not hold enough of the lower layers
+   */
+  void CheckAbortDownload();
+
   EventId m_consumerLoopTimer;
   EventId m_downloadEventTimer;
 
@@ -159,6 +197,9 @@ protected:
   virtual void
   OnData(shared_ptr<const Data> data);
 
+  virtual void
+  OnAllChunksRequested();
+
   virtual void
   OnMpdFile();
 
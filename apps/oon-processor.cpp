@@ -21,6 +21,7 @@
 #include "oon-processor.hpp"
 #include "ns3/log.h"
 #include "ns3/string.h"
+#include "ns3/boolean.h"
 #include "ns3/uinteger.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
@@ -36,11 +37,15 @@
 #include "model/ndn-l3-protocol.hpp"
 #include "helper/ndn-fib-helper.hpp"
 
+#include "ndn-file-info.hpp"
+#include "ndn-file-catalog.hpp"
+
 #include <memory>
 #include <sys/types.h>
 #include <sys/stat.h>
 
 #include <math.h>
+#include <limits>
 
 #include <iostream>
 
@@ -78,7 +83,11 @@ Processor::GetTypeId(void)
          MakeUintegerChecker<uint32_t>())
       .AddAttribute("KeyLocator",
                     "Name to be used for key locator.  If root, then key locator is not used",
-                    NameValue(), MakeNameAccessor(&Processor::m_keyLocator), MakeNameChecker());
+                    NameValue(), MakeNameAccessor(&Processor::m_keyLocator), MakeNameChecker())
+      .AddAttribute("FileInfoInChunks",
+                    "Put the file size into every data chunk (and the last sequence number as FinalBlockId), "
+                    "so that consumers do not need to request the manifest",
+                    BooleanValue(false), MakeBooleanAccessor(&Processor::m_fileInfoInChunks), MakeBooleanChecker());
   return tid;
 }
 
@@ -156,6 +165,9 @@ Processor::StartApplication()
 
   FibHelper::AddRoute(GetNode(), m_prefix, m_face, 0);
   m_MTU = GetFaceMTU(0);
+
+  m_manifestPostfixName = Name(m_postfixManifest);
+  m_catalog.clear();
 }
 
 void
@@ -186,123 +198,92 @@ Processor::OnInterest(shared_ptr<const Interest> interest)
   if (!m_active)
     return;
 
-  Name dataName(interest->getName());
-  //std::cout<<dataName.toUri()<<std::endl;
-  // get last postfix
-  ndn::Name  lastPostfix = dataName.getSubName(dataName.size() -1 );
-  NS_LOG_INFO("> LastPostfix = " << lastPostfix);
+  const Name& interestName = interest->getName();
+  //std::cout<<interestName.toUri()<<std::endl;
 
-  bool isManifest = false;
+  bool isManifest = IsManifestInterest(interestName, m_manifestPostfixName);
   uint32_t seqNo = -1;
 
-  if (lastPostfix == m_postfixManifest)
-  {
-    isManifest = true;
-  }
-  else
+  if (!isManifest)
   {
-    seqNo = dataName.at(-1).toSequenceNumber();
+    seqNo = interestName.at(-1).toSequenceNumber();
     seqNo = seqNo - 1; // Christian: the client thinks seqNo = 1 is the first one, for the server it's better to start at 0
   }
 
   //std::cout<<seqNo<<std::endl;
-  // remove the last postfix
-  dataName = dataName.getPrefix(-1);
-
-  // extract filename and get path to file
-  std::string fname = dataName.toUri();  // get the uri from interest
-  
-
-//20161215 OON
-  ///home/percy/multimediaData/AVC/BBB/bunny_2s_250kbit/bunny_2s5.m4s
-  std::string new_fname;
-  std::string movie = "bunny_2s";
-  int pos_1 = fname.find(movie);
-  int pos_2 = fname.find(movie,pos_1+1);
-  if (pos_1 != std::string::npos)
-{
-  std::string prefix = fname.substr(0, pos_1+8);
-  std::string suffix;
-  std::string down_level;
-  if (pos_2 == std::string::npos){
-    suffix = fname.substr(pos_2-1);
-  //std::string quality = fname.substr(pos_1+8,pos_2-pos_1-9);
-    if (name_map[fname.substr(pos_1+8,pos_2-pos_1-9)]>1){
-      down_level = rename_map[name_map[fname.substr(pos_1+8,pos_2-pos_1-9)]-1];
-    }
-    else{
-      down_level = rename_map[name_map[fname.substr(pos_1+8,pos_2-pos_1-9)]];
-    }
-  }
-  new_fname = prefix+down_level+suffix;
-}else
-{
-  new_fname = fname;
-  std::cout<<"file does not exits"<<std::endl;
-  //GetFileSize(new_fname);
-}
-  //Name new_name(new_fname);
-
-  // measure how much overhead this actually this
-  int diff = EstimateOverhead(fname);
-
-  //OON
-  int oon_diff = EstimateOverhead(new_fname);
-  // set new payload size to this value (minus 4 bytes to be safe for sequence numbers, ethernet headers, etc...)
-  m_maxPayloadSize = m_MTU - diff - 4;
-    //OON
-  //m_maxPayloadSize = m_MTU - oon_diff - 4;
-  m_processorInterface = m_contentDir;
-  new_fname = new_fname.substr(m_prefix.length(), new_fname.length()); // remove the prefix
-  new_fname = std::string(m_processorInterface).append(new_fname); // prepend the data path
-
-
-  //NS_LOG_UNCOND("NewPayload = " << m_maxPayloadSize << " (Overhead: " << diff << ") ");
-
-  fname = fname.substr(m_prefix.length(), fname.length()); // remove the prefix
-  fname = std::string(m_contentDir).append(fname); // prepend the data path
+  // everything else only depends on the file, i.e., the name without the last postfix
+  const FileCatalogEntry& file = GetCatalogEntry(interestName);
 
   // handle manifest or data
   if (isManifest)
   {
-    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Manifest for file " << fname);
-    ReturnManifestData(interest, fname);
+    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Manifest for file " << file.path);
+    ReturnManifestData(interest, file);
   } else
   {
-    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Payload for file " << fname);
-    NS_LOG_DEBUG("FileName: " << fname);
+    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Payload for file " << file.path);
+    NS_LOG_DEBUG("FileName: " << file.path);
     NS_LOG_DEBUG("SeqNo: " << seqNo);
 
     // check if file exists and the sanity of the sequence number requested
-    long fileSize = GetFileSize(fname);
-
-    //OON
-    long new_fileSize = GetFileSize(new_fname);
-
-    if (fileSize == -1)
-      //std::cout<<"file does not exits"<<std::endl;
+    // (consumers which skip the manifest learn about a missing file from the file info of an empty chunk)
+    if (file.fileSize == -1 && !m_fileInfoInChunks)
       return; // file does not exist, just quit
 
-    if (seqNo > ceil(fileSize / m_maxPayloadSize))
+    if (seqNo > file.lastSeqNo)
       return; // sequence not available
 
-    //std::cout<<"filesize"<<m_maxPayloadSize<<"    "<<fileSize<<std::endl;
+    //std::cout<<"filesize"<<file.maxPayloadSize<<"    "<<file.fileSize<<std::endl;
     // else:
-    //OON
-    if(seqNo < floor(new_fileSize/m_maxPayloadSize)){
-     //ReturnPayloadData(interest, new_fname, seqNo);
-    }
-    //std::cout<<new_fname<<std::endl;
-    ReturnPayloadData(interest, fname, seqNo);
+    ReturnPayloadData(interest, file, seqNo);
+  }
+}
+
+
+
+const FileCatalogEntry&
+Processor::GetCatalogEntry(const Name& interestName)
+{
+  // the file is named by the Interest name without its last component
+  FileCatalogEntry* entry = m_catalog.find(interestName, interestName.size() - 1);
+  if (entry != nullptr)
+    return *entry;
+
+  // first Interest for this file
+  FileCatalogEntry file;
+  file.name = interestName.getPrefix(-1);
+
+  std::string fname = file.name.toUri();  // get the uri from interest
+
+  // measure how much overhead this actually this
+  int diff = EstimateOverhead(fname);
+  // set new payload size to this value (minus 4 bytes to be safe for sequence numbers, ethernet headers, etc...)
+  file.maxPayloadSize = m_MTU - diff - 4;
+
+  //NS_LOG_UNCOND("NewPayload = " << file.maxPayloadSize << " (Overhead: " << diff << ") ");
+
+  fname = fname.substr(m_prefix.length(), fname.length()); // remove the prefix
+  file.path = std::string(m_contentDir).append(fname); // prepend the data path
+
+  file.fileSize = GetFileSize(file.path);
+  file.lastSeqNo = file.fileSize < 0 ? 0 : file.fileSize / file.maxPayloadSize;
+
+  if (file.fileSize == -1)
+  {
+    // missing files are not remembered, the file might be there on the next Interest
+    m_missingFile = file;
+    return m_missingFile;
   }
+
+  return m_catalog.insert(file);
 }
 
 
 
 void
-Processor::ReturnManifestData(shared_ptr<const Interest> interest, std::string& fname)
+Processor::ReturnManifestData(shared_ptr<const Interest> interest, const FileCatalogEntry& file)
 {
-  long fileSize = GetFileSize(fname);
+  long fileSize = file.fileSize;
   //std::cout<<"Return ManifestData";
   auto data = make_shared<Data>();
   data->setName(interest->getName());
@@ -311,7 +292,7 @@ Processor::ReturnManifestData(shared_ptr<const Interest> interest, std::string&
   // create a local buffer variable, which contains a long and an unsigned
   uint8_t buffer[sizeof(long) + sizeof(unsigned)];
   memcpy(buffer, &fileSize, sizeof(long));
-  memcpy(buffer+sizeof(long), &m_maxPayloadSize, sizeof(unsigned));
+  memcpy(buffer+sizeof(long), &file.maxPayloadSize, sizeof(unsigned));
 
   // create content with the file size in it
   data->setContent(reinterpret_cast<const uint8_t*>(buffer), sizeof(long) + sizeof(unsigned));
@@ -341,26 +322,36 @@ Processor::ReturnManifestData(shared_ptr<const Interest> interest, std::string&
 
 // OON
 void
-Processor::ReturnPayloadData(shared_ptr<const Interest> interest, std::string& fname, uint32_t seqNo)
+Processor::ReturnPayloadData(shared_ptr<const Interest> interest, const FileCatalogEntry& file, uint32_t seqNo)
 {
   auto data = make_shared<Data>();
   data->setName(interest->getName());
   data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
 
-  // go to pointer seqNo*m_maxPayloadSize in file
-  FILE* fp = fopen(fname.c_str(), "rb");
-  fseek(fp, seqNo * m_maxPayloadSize, SEEK_SET);
+  if (m_fileInfoInChunks)
+    AddFileInfo(*data, file.fileSize, file.maxPayloadSize);
+
+  if (file.fileSize == -1)
+  {
+    // file does not exist, the (empty) chunk only carries the file info
+    data->setContent(make_shared< ::ndn::Buffer>());
+  } else
+  {
+    // go to pointer seqNo*maxPayloadSize in file
+    FILE* fp = fopen(file.path.c_str(), "rb");
+    fseek(fp, seqNo * file.maxPayloadSize, SEEK_SET);
 
-  auto buffer = make_shared< ::ndn::Buffer>(m_maxPayloadSize);
-  //size_t actualSize = fread(buffer->get(), sizeof(uint8_t), m_maxPayloadSize, fp);
-  // this is make new content
-  fread(buffer->get(), sizeof(uint8_t), m_maxPayloadSize, fp);
-  fclose(fp);
+    auto buffer = make_shared< ::ndn::Buffer>(file.maxPayloadSize);
+    //size_t actualSize = fread(buffer->get(), sizeof(uint8_t), file.maxPayloadSize, fp);
+    // this is make new content
+    fread(buffer->get(), sizeof(uint8_t), file.maxPayloadSize, fp);
+    fclose(fp);
 
-  /*if (actualSize < m_maxPayloadSize)
-    buffer->resize(actualSize+1);*/
+    /*if (actualSize < m_maxPayloadSize)
+      buffer->resize(actualSize+1);*/
 
-  data->setContent(buffer);
+    data->setContent(buffer);
+  }
 
   Signature signature;
   SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
@@ -385,11 +376,6 @@ Processor::ReturnPayloadData(shared_ptr<const Interest> interest, std::string& f
 size_t
 Processor::EstimateOverhead(std::string& fname)
 {
-  if (m_packetSizes.find(fname) != m_packetSizes.end())
-  {
-    return m_packetSizes[fname];
-  }
-
   uint32_t interestLength = fname.length();
   // estimate the payload size for now
   int estimatedMaxPayloadSize = m_MTU - interestLength - 30; // the -30 is something we saw in results, it's just to estimate...
@@ -398,6 +384,9 @@ Processor::EstimateOverhead(std::string& fname)
   data->setName(fname + "/1"); // to simulate that there is at least one chunk
   data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
 
+  if (m_fileInfoInChunks)
+    AddFileInfo(*data, std::numeric_limits<long>::max(), std::numeric_limits<uint32_t>::max()); // leave room for the largest file info
+
   auto buffer = make_shared< ::ndn::Buffer>(estimatedMaxPayloadSize);
   data->setContent(buffer);
 
@@ -417,29 +406,19 @@ Processor::EstimateOverhead(std::string& fname)
   // to create real wire encoding
   Block tmp = data->wireEncode();
 
-  m_packetSizes[fname] = tmp.size() - estimatedMaxPayloadSize;
-
   return tmp.size() - estimatedMaxPayloadSize;
 }
 
 
 
-// GetFileSize either from m_fileSizes map or from disk
+// GetFileSize from disk (the catalog remembers the size of files that exist)
 long Processor::GetFileSize(std::string filename)
 {
-  // check if is already in m_fileSizes
-  if (m_fileSizes.find(filename) != m_fileSizes.end())
-  {
-    return m_fileSizes[filename];
-  }
-  // else: query disk for file size
-
   struct stat stat_buf;
   int rc = stat(filename.c_str(), &stat_buf);
 
   if (rc == 0)
   {
-    m_fileSizes[filename] = stat_buf.st_size;
     return stat_buf.st_size;
   }
   // else: file not found
@@ -57,10 +57,14 @@ int
 main(int argc, char* argv[])
 {
   std::string confFile = "brite.conf";
+  uint32_t csSize = 10000;
+  std::string strategy = "/localhost/nfd/strategy/best-route";
 
   // Read optional command-line parameters (e.g., enable visualizer with ./waf --run=<> --visualize
   CommandLine cmd;
   cmd.AddValue ("briteConfFile", "BRITE configuration file", confFile);
+  cmd.AddValue ("csSize", "Content store size of routers", csSize);
+  cmd.AddValue ("strategy", "Forwarding strategy for /myprefix", strategy);
   cmd.Parse(argc, argv);
 
   // Create NDN Stack
@@ -124,13 +128,13 @@ main(int argc, char* argv[])
   ndnHelper.Install (server);
 
   // what really needs a content store is the routers, which we don't have many
-  ndnHelper.setCsSize(10000);
+  ndnHelper.setCsSize(csSize);
   ndnHelper.Install(router);
 
   //ndnHelper.SetDefaultRoutes(true);
 
   // Choosing forwarding strategy
-  ndn::StrategyChoiceHelper::InstallAll("/myprefix", "/localhost/nfd/strategy/best-route");
+  ndn::StrategyChoiceHelper::InstallAll("/myprefix", strategy);
   // ndn::StrategyChoiceHelper::InstallAll("/prefix", "/localhost/nfd/strategy/broadcast");
 
 
@@ -157,6 +157,8 @@ main(int argc, char* argv[])
   Simulator::Stop(Seconds(400.0));
 
   Simulator::Run();
+  TopologyPartitioner::PrintRankLoad(std::cout);
+  ndn::MpiHelper::MergeTraces();
   Simulator::Destroy();
 
   MpiInterface::Disable();
@@ -0,0 +1,129 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-tree-25-node-mpi.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/mpi-interface.h"
+
+#ifdef NS3_MPI
+#include <mpi.h>
+#else
+#error "ndn-tree-25-node-mpi scenario can be compiled only if NS3_MPI is enabled"
+#endif
+
+namespace ns3 {
+
+/**
+ * This scenario simulates the 25-node tree topology from topo-tree-25-node.txt using MPI,
+ * letting the topology reader assign nodes to logical processors:
+ *
+ *   Src1..Src9 -- Rtr1..Rtr3 -- Rtr7 -- Rtr4..Rtr6 -- Dst1..Dst9
+ *
+ * Every SrcN requests /DstN/<seq-no> at 100 Interests per second, and DstN replies with
+ * 1024 bytes of virtual payload.
+ *
+ * System ids in the topology file are ignored; TopologyPartitioner splits the topology
+ * among all MPI processes, balancing the expected load and keeping short links within one
+ * process.  After the simulation, every process prints the number of nodes and NDN packets
+ * it handled, so the actual balance can be compared with the expected one.  The L3 rate
+ * trace of all nodes is written to rate-trace.txt, as in a serial run:
+ *
+ *     mpirun -np 4 ./waf --run=ndn-tree-25-node-mpi
+ */
+
+int
+main(int argc, char* argv[])
+{
+  bool nullmsg = false;
+
+  CommandLine cmd;
+  cmd.AddValue("nullmsg", "Enable the use of null-message synchronization", nullmsg);
+  cmd.Parse(argc, argv);
+
+  if (nullmsg) {
+    GlobalValue::Bind("SimulatorImplementationType",
+                      StringValue("ns3::NullMessageSimulatorImpl"));
+  }
+  else {
+    GlobalValue::Bind("SimulatorImplementationType",
+                      StringValue("ns3::DistributedSimulatorImpl"));
+  }
+
+  MpiInterface::Enable(&argc, &argv);
+
+  AnnotatedTopologyReader topologyReader("", 1);
+  topologyReader.SetFileName("src/ndnSIM/examples/topologies/topo-tree-25-node.txt");
+  topologyReader.SetAutoPartitioning(MpiInterface::GetSize());
+  topologyReader.Read();
+
+  // Install NDN stack on all nodes
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  // Installing global routing interface on all nodes
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+
+  // Applications are only installed on nodes of this logical processor by AppHelper
+  ndn::AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetAttribute("Frequency", StringValue("100"));
+
+  ndn::AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetAttribute("PayloadSize", StringValue("1024"));
+
+  for (int i = 1; i <= 9; ++i) {
+    std::string index = std::to_string(i);
+    Ptr<Node> consumer = Names::Find<Node>("Src" + index);
+    Ptr<Node> producer = Names::Find<Node>("Dst" + index);
+
+    consumerHelper.SetPrefix("/Dst" + index);
+    consumerHelper.Install(consumer);
+
+    producerHelper.SetPrefix("/Dst" + index);
+    producerHelper.Install(producer);
+    ndnGlobalRoutingHelper.AddOrigins("/Dst" + index, producer);
+  }
+
+  // Calculate and install FIBs
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+
+  // Every process traces its own nodes; MergeTraces combines the traces into rate-trace.txt
+  ndn::L3RateTracer::InstallAll("rate-trace.txt", Seconds(1.0));
+
+  Simulator::Stop(Seconds(60.0));
+
+  Simulator::Run();
+  TopologyPartitioner::PrintRankLoad(std::cout);
+  ndn::MpiHelper::MergeTraces();
+  Simulator::Destroy();
+
+  MpiInterface::Disable();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::main(argc, argv);
+}
@@ -57,10 +57,14 @@ int
 main(int argc, char* argv[])
 {
   std::string confFile = "brite.conf";
+  uint32_t csSize = 10000;
+  std::string strategy = "/localhost/nfd/strategy/multicast/";
 
   // Read optional command-line parameters (e.g., enable visualizer with ./waf --run=<> --visualize
   CommandLine cmd;
   cmd.AddValue ("briteConfFile", "BRITE configuration file", confFile);
+  cmd.AddValue ("csSize", "Content store size of routers", csSize);
+  cmd.AddValue ("strategy", "Forwarding strategy for /myprefix", strategy);
   cmd.Parse(argc, argv);
 
   // Create NDN Stack
@@ -124,14 +128,14 @@ main(int argc, char* argv[])
   ndnHelper.Install (server);
 
   //
-  ndnHelper.setCsSize(10000);
+  ndnHelper.setCsSize(csSize);
   ndnHelper.setOpMIPS(100);
   ndnHelper.Install(router);
 
   //ndnHelper.SetDefaultRoutes(true);
 
   // Choosing forwarding strategy
-  ndn::StrategyChoiceHelper::InstallAll("/myprefix", "/localhost/nfd/strategy/multicast/");
+  ndn::StrategyChoiceHelper::InstallAll("/myprefix", strategy);
   // ndn::StrategyChoiceHelper::InstallAll("/prefix", "/localhost/nfd/strategy/broadcast");
 
 
@@ -44,6 +44,11 @@
 
 #include "ndn-brite-helper.hpp"
 
+#ifdef NS3_MPI
+#include "ns3/mpi-interface.h"
+#endif
+
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
@@ -402,6 +407,16 @@ NDNBriteHelper::BuildBriteTopology ()
 {
   NS_LOG_FUNCTION (this);
 
+  // NS3_MPI is defined only when wscript links ndnSIM against ns-3's mpi module;
+  // otherwise the topology is always built for a single process
+#ifdef NS3_MPI
+  if (MpiInterface::IsEnabled () && MpiInterface::GetSize () > 1)
+    {
+      BuildBriteTopology (MpiInterface::GetSize ());
+      return;
+    }
+#endif
+
   GenerateBriteTopology ();
 
   //not using MPI so each AS is on system number 0
@@ -427,11 +442,29 @@ NDNBriteHelper::BuildBriteTopology (const uint32_t systemCount)
 
   GenerateBriteTopology ();
 
-  //determine as system number for each AS
-  NS_LOG_LOGIC ("Assigning << " << m_numAs << " AS to " << systemCount << " MPI instances");
+  //partition nodes so that short links stay within one MPI instance
+  for (uint32_t i = 0; i < m_briteNodeInfoList.size (); ++i)
+    {
+      m_partitioner.AddVertex ();
+    }
+  for (NDNBriteHelper::BriteEdgeInfoList::iterator it = m_briteEdgeInfoList.begin (); it != m_briteEdgeInfoList.end (); ++it)
+    {
+      // The brite value for delay is given in milliseconds
+      m_partitioner.AddEdge ((*it).srcId, (*it).destId, Seconds ((*it).delay/1000.0));
+    }
+
+  NS_LOG_LOGIC ("Assigning " << m_briteNodeInfoList.size () << " nodes to " << systemCount << " MPI instances");
+  std::vector<uint32_t> systemForNode = m_partitioner.Partition (systemCount);
+
+  //an AS is reported on the system holding most of its nodes
+  std::vector<std::vector<uint32_t> > nNodesOnSystem (m_numAs, std::vector<uint32_t> (systemCount, 0));
+  for (NDNBriteHelper::BriteNodeInfoList::iterator it = m_briteNodeInfoList.begin (); it != m_briteNodeInfoList.end (); ++it)
+    {
+      ++nNodesOnSystem[(*it).asId][systemForNode[(*it).nodeId]];
+    }
   for (uint32_t i = 0; i < m_numAs; ++i)
     {
-      int val = i % systemCount;
+      int val = std::max_element (nNodesOnSystem[i].begin (), nNodesOnSystem[i].end ()) - nNodesOnSystem[i].begin ();
       m_systemForAs.push_back (val);
       NS_LOG_INFO ("AS: " << i << " System: " << val);
     }
@@ -439,15 +472,21 @@ NDNBriteHelper::BuildBriteTopology (const uint32_t systemCount)
   //create nodes
   for (NDNBriteHelper::BriteNodeInfoList::iterator it = m_briteNodeInfoList.begin (); it != m_briteNodeInfoList.end (); ++it)
     {
-      m_nodes.Add (CreateObject<Node> (GetSystemNumberForAs ((*it).asId)));
+      m_nodes.Add (CreateObject<Node> (systemForNode[(*it).nodeId]));
       m_numNodes++;
     }
 
-  NS_LOG_INFO (m_numNodes << " nodes created in BRITE topology");
+  NS_LOG_INFO (m_numNodes << " nodes created in BRITE topology, lookahead " << m_partitioner.GetLookahead ().As (Time::MS));
 
   ConstructTopology ();
 }
 
+const TopologyPartitioner&
+NDNBriteHelper::GetPartitioner () const
+{
+  return m_partitioner;
+}
+
 
 void
 NDNBriteHelper::ConstructTopology ()
@@ -45,6 +45,7 @@
 #include "ns3/point-to-point-helper.h"
 #include "ns3/ndnSIM/helper/ndn-face-container.hpp"
 #include "ns3/random-variable-stream.h"
+#include "ns3/ndnSIM/utils/topology/topology-partitioner.hpp"
 
 
 
@@ -109,17 +110,29 @@ public:
 
   /**
    *  Create NS3 topology using information generated from BRITE.
+   *
+   *  If MPI is enabled with more than one instance, the topology is partitioned
+   *  among all instances as by BuildBriteTopology (MpiInterface::GetSize ()).
    */
   void BuildBriteTopology ();
 
   /**
    * Create NS3 topology using information generated from BRITE and configure topology for MPI use.
    *
+   * Nodes are assigned to MPI instances by TopologyPartitioner, which balances the number of
+   * links per instance and keeps links with short delays within one instance.
+   *
    * \param systemCount The number of MPI instances to be used in the simulation.
    *
    */
   void BuildBriteTopology (const uint32_t systemCount);
 
+  /**
+   * Returns the partitioner used by BuildBriteTopology (systemCount), e.g. to print
+   * the expected load of each MPI instance and the resulting lookahead
+   */
+  const TopologyPartitioner& GetPartitioner () const;
+
   /**
    * Returns the number of router leaf nodes for a given AS
    *
@@ -182,7 +195,8 @@ public:
   uint32_t GetNAs (void) const;
 
   /**
-    * Returns the system number for the MPI instance that this AS is assigned to.  Will always return 0 if MPI not used
+    * Returns the system number for the MPI instance that this AS is assigned to.  Will always return 0 if MPI not used.
+    * An AS may span several MPI instances; the instance holding most of its nodes is returned.
     *
     * \returns The system number that the specified AS number belongs to
     *
@@ -299,6 +313,9 @@ private:
   /// stores the MPI system number each AS assigned to.  All assigned to 0 if MPI not used.
   std::vector<int> m_systemForAs;
 
+  /// assigns nodes to MPI instances
+  TopologyPartitioner m_partitioner;
+
   /// the Brite topology
   brite::Topology* m_topology;
 
@@ -0,0 +1,298 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-cs-snapshot-helper.hpp"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "model/cs/ndn-content-store.hpp"
+#include "helper/ndn-mpi-helper.hpp"
+#include "utils/ndn-binary-file.hpp"
+
+#include "daemon/fw/forwarder.hpp"
+#include "daemon/table/cs.hpp"
+#include "core/city-hash.hpp"
+
+#include "ns3/log.h"
+#include "ns3/node-list.h"
+#include "ns3/simulator.h"
+
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE("ndn.CsSnapshotHelper");
+
+namespace ns3 {
+namespace ndn {
+
+const int64_t CsSnapshotHelper::NEVER_STALE = std::numeric_limits<int64_t>::max();
+
+namespace {
+
+const uint32_t CS_SNAPSHOT_MAGIC = 0x4e435331; // "NCS1", also detects byte order
+const uint32_t CS_SNAPSHOT_VERSION = 1;
+
+/**
+ * @brief Wire encodings of the saved Data packets, each stored once
+ */
+class DataTable
+{
+public:
+  uint32_t
+  add(const Data& data)
+  {
+    const Block& wire = data.wireEncode();
+    uint64_t hash = CityHash64(reinterpret_cast<const char*>(wire.wire()), wire.size());
+
+    auto range = m_index.equal_range(hash);
+    for (auto i = range.first; i != range.second; ++i) {
+      const Block& other = m_wires[i->second];
+      if (other.size() == wire.size() &&
+          std::equal(wire.wire(), wire.wire() + wire.size(), other.wire())) {
+        return i->second;
+      }
+    }
+
+    m_index.insert(std::make_pair(hash, m_wires.size()));
+    m_wires.push_back(wire);
+    return m_wires.size() - 1;
+  }
+
+  const std::vector<Block>&
+  getWires() const
+  {
+    return m_wires;
+  }
+
+private:
+  std::vector<Block> m_wires;
+  std::unordered_multimap<uint64_t, uint32_t> m_index;
+};
+
+} // namespace
+
+/**
+ * In a distributed run, every rank keeps its own nodes in a separate file
+ */
+static std::string
+getSnapshotFile(const std::string& file)
+{
+  if (!MpiHelper::IsDistributed()) {
+    return file;
+  }
+  return file + ".rank-" + boost::lexical_cast<std::string>(MpiHelper::GetSystemId());
+}
+
+void
+CsSnapshotHelper::Save(const std::string& file)
+{
+  DataTable dataTable;
+  std::vector<std::pair<uint32_t, std::vector<SavedEntry>>> nodes;
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    Ptr<L3Protocol> ndn = (*node)->GetObject<L3Protocol>();
+    if (ndn == nullptr || !MpiHelper::IsLocal(*node)) {
+      continue;
+    }
+
+    std::vector<SavedEntry> entries;
+
+    // as in L3Protocol, an ndnSIM content store replaces NFD's CS
+    Ptr<ContentStore> cs = ndn->GetObject<ContentStore>();
+    if (cs != nullptr) {
+      cs->ForEachInEvictionOrder([&] (shared_ptr<const Data> data, Time timeToExpire) {
+          int64_t staleIn = (timeToExpire == Time::Max()) ? NEVER_STALE
+                                                          : timeToExpire.GetNanoSeconds();
+          entries.push_back({dataTable.add(*data), false, staleIn});
+        });
+    }
+    else {
+      nfd::Cs& nfdCs = ndn->getForwarder()->getCs();
+      nfdCs.getPolicy()->forEachInEvictionOrder([&] (const nfd::cs::Entry& entry) {
+          int64_t staleIn = NEVER_STALE;
+          if (entry.getStaleTime() != time::steady_clock::TimePoint::max()) {
+            staleIn = time::duration_cast<time::nanoseconds>(entry.getStaleTime() - now).count();
+          }
+          entries.push_back({dataTable.add(entry.getData()), entry.isUnsolicited(), staleIn});
+        });
+    }
+
+    nodes.push_back(std::make_pair((*node)->GetId(), std::move(entries)));
+  }
+
+  std::string snapshotFile = getSnapshotFile(file);
+  size_t nEntries = 0;
+  bool isWritten = writeFileAtomically(snapshotFile, [&] (std::ostream& os) {
+      writeValue(os, CS_SNAPSHOT_MAGIC);
+      writeValue(os, CS_SNAPSHOT_VERSION);
+
+      writeValue<uint32_t>(os, dataTable.getWires().size());
+      for (const Block& wire : dataTable.getWires()) {
+        writeValue<uint32_t>(os, wire.size());
+        os.write(reinterpret_cast<const char*>(wire.wire()), wire.size());
+      }
+
+      writeValue<uint32_t>(os, nodes.size());
+      for (const auto& node : nodes) {
+        writeValue<uint32_t>(os, node.first);
+        writeValue<uint32_t>(os, node.second.size());
+        for (const SavedEntry& entry : node.second) {
+          writeValue<uint32_t>(os, entry.data);
+          writeValue<uint8_t>(os, entry.isUnsolicited);
+          writeValue<int64_t>(os, entry.staleIn);
+        }
+        nEntries += node.second.size();
+      }
+    });
+  if (!isWritten) {
+    NS_FATAL_ERROR("Cannot write content store snapshot " << snapshotFile);
+  }
+
+  NS_LOG_INFO("Saved " << nEntries << " entries (" << dataTable.getWires().size()
+              << " distinct Data packets) of " << nodes.size() << " content stores to "
+              << snapshotFile);
+}
+
+void
+CsSnapshotHelper::SaveAt(Time when, const std::string& file)
+{
+  Simulator::Schedule(when - Simulator::Now(), &CsSnapshotHelper::Save, file);
+}
+
+CsSnapshotHelper::CsSnapshotHelper(const std::string& file)
+{
+  std::string snapshotFile = getSnapshotFile(file);
+  std::ifstream is(snapshotFile.c_str(), std::ios_base::in | std::ios_base::binary);
+  if (!is.is_open() && snapshotFile != file) {
+    // snapshot of a serial run
+    snapshotFile = file;
+    is.open(snapshotFile.c_str(), std::ios_base::in | std::ios_base::binary);
+  }
+  if (!is.is_open()) {
+    throw Error("Cannot open content store snapshot " + snapshotFile);
+  }
+
+  is.seekg(0, std::ios_base::end);
+  std::streampos end = is.tellg();
+  is.seekg(0, std::ios_base::beg);
+
+  if (readValue<uint32_t>(is) != CS_SNAPSHOT_MAGIC
+      || readValue<uint32_t>(is) != CS_SNAPSHOT_VERSION) {
+    throw Error(snapshotFile + " is not a content store snapshot of this version");
+  }
+
+  // counts and sizes are checked against the rest of the file before anything is allocated,
+  // and every Data packet is decoded once here, so that Restore cannot fail
+  try {
+    m_wires.resize(readCount(is, end, sizeof(uint32_t)));
+    for (auto& wire : m_wires) {
+      uint32_t wireSize = readValue<uint32_t>(is);
+      if (wireSize > getRemainingSize(is, end)) {
+        is.setstate(std::ios_base::failbit);
+      }
+      if (!is) {
+        break;
+      }
+
+      std::vector<uint8_t> buffer(wireSize);
+      is.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
+      if (!is) {
+        break;
+      }
+      wire = Block(buffer.data(), buffer.size());
+      Data data(wire);
+    }
+
+    const size_t ENTRY_SIZE = sizeof(uint32_t) + sizeof(uint8_t) + sizeof(int64_t);
+    uint32_t nNodes = readCount(is, end, 2 * sizeof(uint32_t));
+    for (uint32_t i = 0; i < nNodes && is; i++) {
+      std::vector<SavedEntry>& entries = m_nodes[readValue<uint32_t>(is)];
+      entries.resize(readCount(is, end, ENTRY_SIZE));
+      for (SavedEntry& entry : entries) {
+        entry.data = readValue<uint32_t>(is);
+        entry.isUnsolicited = readValue<uint8_t>(is) != 0;
+        entry.staleIn = readValue<int64_t>(is);
+        if (entry.data >= m_wires.size()) {
+          is.setstate(std::ios_base::failbit);
+        }
+      }
+    }
+  }
+  catch (const Block::Error& error) {
+    NS_LOG_DEBUG("Malformed Data packet in content store snapshot: " << error.what());
+    is.setstate(std::ios_base::failbit);
+  }
+  catch (const ::ndn::tlv::Error& error) {
+    NS_LOG_DEBUG("Malformed Data packet in content store snapshot: " << error.what());
+    is.setstate(std::ios_base::failbit);
+  }
+
+  if (!is) {
+    throw Error("Damaged content store snapshot " + snapshotFile);
+  }
+
+  NS_LOG_INFO("Loaded content stores of " << m_nodes.size() << " nodes ("
+              << m_wires.size() << " distinct Data packets) from " << snapshotFile);
+}
+
+size_t
+CsSnapshotHelper::Restore(Ptr<Node> node) const
+{
+  auto saved = m_nodes.find(node->GetId());
+  if (saved == m_nodes.end()) {
+    return 0;
+  }
+
+  Ptr<L3Protocol> ndn = node->GetObject<L3Protocol>();
+  NS_ASSERT_MSG(ndn != nullptr, "NDN stack should be installed on node " << node->GetId());
+
+  Ptr<ContentStore> cs = ndn->GetObject<ContentStore>();
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+
+  for (const SavedEntry& entry : saved->second) {
+    // every node gets its own copy of the Data packet (sharing the wire encoding)
+    auto data = make_shared<Data>(m_wires[entry.data]);
+
+    if (cs != nullptr) {
+      if (entry.staleIn == NEVER_STALE) {
+        cs->Add(data);
+      }
+      else {
+        cs->Restore(data, NanoSeconds(entry.staleIn));
+      }
+    }
+    else {
+      time::steady_clock::TimePoint staleTime = time::steady_clock::TimePoint::max();
+      if (entry.staleIn != NEVER_STALE) {
+        staleTime = now + time::nanoseconds(entry.staleIn);
+      }
+      ndn->getForwarder()->getCs().insert(*data, entry.isUnsolicited, staleTime);
+    }
+  }
+
+  NS_LOG_DEBUG("Node " << node->GetId() << ": restored " << saved->second.size()
+               << " content store entries");
+  return saved->second.size();
+}
+
+} // namespace ndn
+} // namespace ns3
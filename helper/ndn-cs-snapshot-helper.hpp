@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_CS_SNAPSHOT_HELPER_H
+#define NDN_CS_SNAPSHOT_HELPER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/node.h"
+#include "ns3/nstime.h"
+
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Helper to save content stores of all nodes to a file and restore them in another run
+ *
+ * A warm-up run saves the content stores once the caches have reached a steady state:
+ *
+ * \code
+ *   ndn::CsSnapshotHelper::SaveAt(Seconds(600.0), "warm-caches.bin");
+ * \endcode
+ *
+ * Later runs of the same topology restore them when the stack is installed, so measurements
+ * can start at time 0:
+ *
+ * \code
+ *   ndn::StackHelper ndnHelper;
+ *   ndnHelper.setCsSnapshot("warm-caches.bin");
+ *   ndnHelper.InstallAll();
+ * \endcode
+ *
+ * For every node, the snapshot keeps the Data packets in the order the replacement policy
+ * would evict them, whether they are unsolicited, and the time left until they become stale.
+ * Entries are restored in that order, which recreates the eviction order of NFD's CS policies
+ * and of the LRU and FIFO policies of ndnSIM 1.0 content stores.  Data packets cached by
+ * several nodes are stored once.  Nodes are matched by their id, so the restoring scenario
+ * must create nodes in the same order.
+ *
+ * In a distributed (MPI) simulation every rank saves the nodes it simulates to
+ * "<file>.rank-<systemId>" and, if this file exists, restores from it.
+ */
+class CsSnapshotHelper {
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    explicit
+    Error(const std::string& what)
+      : std::runtime_error(what)
+    {
+    }
+  };
+
+  /**
+   * @brief Save content stores of all (local) nodes to @p file now
+   */
+  static void
+  Save(const std::string& file);
+
+  /**
+   * @brief Schedule saving of content stores of all (local) nodes to @p file at time @p when
+   */
+  static void
+  SaveAt(Time when, const std::string& file);
+
+  /**
+   * @brief Load a snapshot saved with Save or SaveAt
+   *
+   * @throw Error the file is missing, is not a snapshot of this version, or is damaged
+   */
+  explicit CsSnapshotHelper(const std::string& file);
+
+  /**
+   * @brief Restore the saved content store of @p node
+   * @returns number of restored entries
+   */
+  size_t
+  Restore(Ptr<Node> node) const;
+
+private:
+  struct SavedEntry
+  {
+    uint32_t data;   ///< index in m_wires
+    bool isUnsolicited;
+    int64_t staleIn; ///< nanoseconds until the entry becomes stale, NEVER_STALE if it never does
+  };
+
+  static const int64_t NEVER_STALE;
+
+private:
+  std::vector<Block> m_wires; ///< wire encodings of the saved Data packets
+  std::unordered_map<uint32_t, std::vector<SavedEntry>> m_nodes;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_CS_SNAPSHOT_HELPER_H
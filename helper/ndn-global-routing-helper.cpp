@@ -27,13 +27,18 @@
 
 #include "model/ndn-l3-protocol.hpp"
 #include "helper/ndn-fib-helper.hpp"
+#include "helper/ndn-mpi-helper.hpp"
+#include "helper/ndn-shortest-path-trees.hpp"
 #include "model/ndn-net-device-face.hpp"
 #include "model/ndn-global-router.hpp"
+#include "utils/ndn-binary-file.hpp"
 
 #include "daemon/table/fib.hpp"
 #include "daemon/fw/forwarder.hpp"
 #include "daemon/table/fib-entry.hpp"
 #include "daemon/table/fib-nexthop.hpp"
+#include "core/name-interner.hpp"
+#include "core/city-hash.hpp"
 
 #include "ns3/object.h"
 #include "ns3/node.h"
@@ -52,6 +57,10 @@
 #include <boost/concept/assert.hpp>
 #include <boost/graph/dijkstra_shortest_paths.hpp>
 
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
 #include <unordered_map>
 
 #include "boost-graph-ndn-global-routing-helper.hpp"
@@ -180,8 +189,7 @@ GlobalRoutingHelper::AddOrigin(const std::string& prefix, Ptr<Node> node)
   Ptr<GlobalRouter> gr = node->GetObject<GlobalRouter>();
   NS_ASSERT_MSG(gr != 0, "GlobalRouter is not installed on the node");
 
-  auto name = make_shared<Name>(prefix);
-  gr->AddLocalPrefix(name);
+  gr->AddLocalPrefix(nfd::internName(Name(prefix)));
 }
 
 void
@@ -214,9 +222,329 @@ GlobalRoutingHelper::AddOriginsForAll()
   }
 }
 
+// directory of the route cache, disabled if empty
+static std::string g_routeCacheDirectory;
+
+namespace {
+
+const uint32_t ROUTE_CACHE_MAGIC = 0x4e524331; // "NRC1", also detects byte order
+const uint32_t ROUTE_CACHE_VERSION = 1;
+
+enum RouteCalculation {
+  SHORTEST_PATH_ROUTES = 1,
+  ALL_POSSIBLE_ROUTES = 2
+};
+
+/**
+ * @brief Route installed by CalculateRoutes or CalculateAllPossibleRoutes
+ */
+struct CachedRoute
+{
+  uint32_t node;
+  uint32_t prefix; ///< index in the prefix table of the cache file
+  uint32_t faceId;
+  int32_t metric;
+};
+
+/**
+ * @brief Serialized representation of the routing topology, to be hashed
+ */
+class TopologyDigest
+{
+public:
+  template<typename T>
+  void
+  add(T value)
+  {
+    m_data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  void
+  add(const Name& name)
+  {
+    const Block& wire = name.wireEncode();
+    add<uint32_t>(wire.size());
+    m_data.append(reinterpret_cast<const char*>(wire.wire()), wire.size());
+  }
+
+  void
+  add(GlobalRouter& router)
+  {
+    add<uint32_t>(router.GetId());
+    for (const auto& incidency : router.GetIncidencies()) {
+      const shared_ptr<Face>& face = std::get<1>(incidency);
+      add<uint64_t>(face != nullptr ? face->getId() : nfd::INVALID_FACEID);
+      add<uint64_t>(face != nullptr ? face->getMetric() : 0);
+      add<uint32_t>(std::get<2>(incidency)->GetId());
+    }
+    add<uint32_t>(router.GetLocalPrefixes().size());
+    for (const auto& prefix : router.GetLocalPrefixes()) {
+      add(*prefix);
+    }
+  }
+
+  uint64_t
+  hash() const
+  {
+    return CityHash64(m_data.data(), m_data.size());
+  }
+
+private:
+  std::string m_data;
+};
+
+} // namespace
+
+static uint64_t
+hashTopology(RouteCalculation calculation)
+{
+  TopologyDigest digest;
+  digest.add<uint32_t>(calculation);
+  digest.add<uint32_t>(MpiHelper::GetSystemId());
+  digest.add<uint32_t>(MpiHelper::GetSize());
+
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    Ptr<GlobalRouter> router = (*node)->GetObject<GlobalRouter>();
+    if (router != 0) {
+      digest.add<uint32_t>((*node)->GetId());
+      digest.add(*router);
+    }
+  }
+  for (ChannelList::Iterator channel = ChannelList::Begin(); channel != ChannelList::End();
+       channel++) {
+    Ptr<GlobalRouter> router = (*channel)->GetObject<GlobalRouter>();
+    if (router != 0) {
+      digest.add<uint32_t>((*channel)->GetId());
+      digest.add(*router);
+    }
+  }
+  return digest.hash();
+}
+
+static std::string
+getRouteCacheFile(uint64_t topologyHash)
+{
+  std::ostringstream os;
+  os << g_routeCacheDirectory << "/routes-" << std::hex << std::setw(16) << std::setfill('0')
+     << topologyHash << ".bin";
+  return os.str();
+}
+
+static void
+saveRoutes(uint64_t topologyHash, const std::vector<shared_ptr<const Name>>& prefixes,
+           const std::vector<CachedRoute>& routes)
+{
+  std::string file = getRouteCacheFile(topologyHash);
+  bool isWritten = writeFileAtomically(file, [&] (std::ostream& os) {
+      writeValue(os, ROUTE_CACHE_MAGIC);
+      writeValue(os, ROUTE_CACHE_VERSION);
+      writeValue(os, topologyHash);
+
+      writeValue<uint32_t>(os, prefixes.size());
+      for (const auto& prefix : prefixes) {
+        const Block& wire = prefix->wireEncode();
+        writeValue<uint32_t>(os, wire.size());
+        os.write(reinterpret_cast<const char*>(wire.wire()), wire.size());
+      }
+
+      writeValue<uint32_t>(os, routes.size());
+      for (const auto& route : routes) {
+        writeValue(os, route);
+      }
+    });
+  if (!isWritten) {
+    NS_LOG_WARN("Cannot write route cache " << file);
+    return;
+  }
+  NS_LOG_INFO("Saved " << routes.size() << " routes to " << file);
+}
+
+static bool
+loadRoutes(uint64_t topologyHash)
+{
+  std::string file = getRouteCacheFile(topologyHash);
+  std::ifstream is(file.c_str(), std::ios_base::in | std::ios_base::binary);
+  if (!is.is_open()) {
+    NS_LOG_INFO("No cached routes for this topology in " << file);
+    return false;
+  }
+
+  is.seekg(0, std::ios_base::end);
+  std::streampos end = is.tellg();
+  is.seekg(0, std::ios_base::beg);
+
+  if (readValue<uint32_t>(is) != ROUTE_CACHE_MAGIC || readValue<uint32_t>(is) != ROUTE_CACHE_VERSION
+      || readValue<uint64_t>(is) != topologyHash) {
+    NS_LOG_WARN("Ignoring incompatible route cache " << file);
+    return false;
+  }
+
+  // read everything before installing anything, so a damaged file does not leave partial FIBs;
+  // counts and sizes are checked against the rest of the file before anything is allocated
+  std::vector<shared_ptr<const Name>> prefixes;
+  std::vector<CachedRoute> routes;
+  try {
+    prefixes.resize(readCount(is, end, sizeof(uint32_t)));
+    for (auto& prefix : prefixes) {
+      uint32_t wireSize = readValue<uint32_t>(is);
+      if (wireSize > getRemainingSize(is, end)) {
+        is.setstate(std::ios_base::failbit);
+      }
+      if (!is) {
+        break;
+      }
+
+      std::vector<uint8_t> wire(wireSize);
+      is.read(reinterpret_cast<char*>(wire.data()), wire.size());
+      if (!is) {
+        break;
+      }
+      prefix = nfd::internName(Name(Block(wire.data(), wire.size())));
+    }
+
+    routes.resize(readCount(is, end, sizeof(CachedRoute)));
+    for (auto& route : routes) {
+      route = readValue<CachedRoute>(is);
+      if (route.prefix >= prefixes.size() || route.node >= NodeList::GetNNodes()) {
+        is.setstate(std::ios_base::failbit);
+      }
+    }
+  }
+  catch (const Block::Error& error) {
+    NS_LOG_DEBUG("Malformed prefix in route cache: " << error.what());
+    is.setstate(std::ios_base::failbit);
+  }
+  catch (const ::ndn::tlv::Error& error) {
+    NS_LOG_DEBUG("Malformed prefix in route cache: " << error.what());
+    is.setstate(std::ios_base::failbit);
+  }
+
+  if (!is) {
+    NS_LOG_WARN("Ignoring damaged route cache " << file);
+    return false;
+  }
+
+  // face ids are not part of the topology hash; a cache written by a scenario that created
+  // faces in another order is stale, and the routes have to be calculated again
+  std::vector<shared_ptr<Face>> faces;
+  faces.reserve(routes.size());
+  for (const auto& route : routes) {
+    Ptr<L3Protocol> l3protocol = NodeList::GetNode(route.node)->GetObject<L3Protocol>();
+    shared_ptr<Face> face = l3protocol != 0 ? l3protocol->getFaceById(route.faceId) : nullptr;
+    if (face == nullptr) {
+      NS_LOG_WARN("Ignoring stale route cache " << file << ": node " << route.node
+                  << " has no face " << route.faceId);
+      return false;
+    }
+    faces.push_back(face);
+  }
+
+  for (size_t i = 0; i < routes.size(); ++i) {
+    FibHelper::AddRoute(NodeList::GetNode(routes[i].node), *prefixes[routes[i].prefix], faces[i],
+                        routes[i].metric);
+  }
+
+  NS_LOG_INFO("Installed " << routes.size() << " cached routes from " << file);
+  return true;
+}
+
+namespace {
+
+/**
+ * @brief Routes installed by a route calculation, recorded for the route cache
+ */
+class RouteRecorder
+{
+public:
+  explicit
+  RouteRecorder(RouteCalculation calculation)
+    : m_isEnabled(!g_routeCacheDirectory.empty())
+    , m_topologyHash(m_isEnabled ? hashTopology(calculation) : 0)
+  {
+  }
+
+  /**
+   * @brief Install cached routes, if the cache has them
+   */
+  bool
+  load()
+  {
+    return m_isEnabled && loadRoutes(m_topologyHash);
+  }
+
+  void
+  add(Ptr<Node> node, const shared_ptr<const Name>& prefix, const shared_ptr<Face>& face,
+      int32_t metric)
+  {
+    if (!m_isEnabled)
+      return;
+
+    auto index = m_prefixIndex.insert(std::make_pair(prefix.get(), m_prefixes.size()));
+    if (index.second) {
+      m_prefixes.push_back(prefix);
+    }
+    NS_ASSERT(face->getId() <= std::numeric_limits<uint32_t>::max());
+    m_routes.push_back({node->GetId(), static_cast<uint32_t>(index.first->second),
+                        static_cast<uint32_t>(face->getId()), metric});
+  }
+
+  void
+  save() const
+  {
+    if (m_isEnabled) {
+      saveRoutes(m_topologyHash, m_prefixes, m_routes);
+    }
+  }
+
+private:
+  bool m_isEnabled;
+  uint64_t m_topologyHash;
+  std::vector<shared_ptr<const Name>> m_prefixes;
+  std::unordered_map<const Name*, size_t> m_prefixIndex;
+  std::vector<CachedRoute> m_routes;
+};
+
+} // namespace
+
+void
+GlobalRoutingHelper::SetRouteCacheDirectory(const std::string& directory)
+{
+  g_routeCacheDirectory = directory;
+}
+
+// shortest path trees kept for RecalculateRoutes
+static bool g_isIncremental = false;
+static std::unique_ptr<ShortestPathTrees> g_shortestPathTrees;
+
+void
+GlobalRoutingHelper::EnableIncrementalUpdates(bool isEnabled)
+{
+  g_isIncremental = isEnabled;
+  if (!isEnabled) {
+    g_shortestPathTrees.reset();
+  }
+}
+
+void
+GlobalRoutingHelper::RecalculateRoutes()
+{
+  if (g_shortestPathTrees == nullptr) {
+    NS_FATAL_ERROR("RecalculateRoutes requires EnableIncrementalUpdates before CalculateRoutes");
+  }
+
+  size_t nChanges = g_shortestPathTrees->update();
+  NS_LOG_INFO("Routes recalculated, " << nChanges << " next hops changed");
+}
+
 void
 GlobalRoutingHelper::CalculateRoutes()
 {
+  if (g_isIncremental) {
+    g_shortestPathTrees.reset(new ShortestPathTrees());
+    g_shortestPathTrees->calculate();
+    return;
+  }
+
   /**
    * Implementation of route calculation is heavily based on Boost Graph Library
    * See http://www.boost.org/doc/libs/1_49_0/libs/graph/doc/table_of_contents.html for more details
@@ -225,6 +553,11 @@ GlobalRoutingHelper::CalculateRoutes()
   BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<boost::NdnGlobalRouterGraph>));
   BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<boost::NdnGlobalRouterGraph>));
 
+  RouteRecorder recorder(SHORTEST_PATH_ROUTES);
+  if (recorder.load()) {
+    return;
+  }
+
   boost::NdnGlobalRouterGraph graph;
   // typedef graph_traits < NdnGlobalRouterGraph >::vertex_descriptor vertex_descriptor;
 
@@ -239,6 +572,11 @@ GlobalRoutingHelper::CalculateRoutes()
       continue;
     }
 
+    if (!MpiHelper::IsLocal(*node)) {
+      // FIB of this node is populated by the rank that simulates it
+      continue;
+    }
+
     boost::DistancesMap distances;
 
     dijkstra_shortest_paths(graph, source,
@@ -272,11 +610,14 @@ GlobalRoutingHelper::CalculateRoutes()
 
             FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second),
                                 std::get<1>(dist.second));
+            recorder.add(*node, prefix, std::get<0>(dist.second), std::get<1>(dist.second));
           }
         }
       }
     }
   }
+
+  recorder.save();
 }
 
 void
@@ -290,6 +631,11 @@ GlobalRoutingHelper::CalculateAllPossibleRoutes()
   BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<boost::NdnGlobalRouterGraph>));
   BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<boost::NdnGlobalRouterGraph>));
 
+  RouteRecorder recorder(ALL_POSSIBLE_ROUTES);
+  if (recorder.load()) {
+    return;
+  }
+
   boost::NdnGlobalRouterGraph graph;
   // typedef graph_traits < NdnGlobalRouterGraph >::vertex_descriptor vertex_descriptor;
 
@@ -304,6 +650,11 @@ GlobalRoutingHelper::CalculateAllPossibleRoutes()
       continue;
     }
 
+    if (!MpiHelper::IsLocal(*node)) {
+      // FIB of this node is populated by the rank that simulates it
+      continue;
+    }
+
     Ptr<L3Protocol> L3protocol = (*node)->GetObject<L3Protocol>();
     shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
 
@@ -370,6 +721,7 @@ GlobalRoutingHelper::CalculateAllPossibleRoutes()
 
               FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second),
                                   std::get<1>(dist.second));
+              recorder.add(*node, prefix, std::get<0>(dist.second), std::get<1>(dist.second));
             }
           }
         }
@@ -384,6 +736,8 @@ GlobalRoutingHelper::CalculateAllPossibleRoutes()
       l3->getForwarder()->getFaceTable().get(i.first)->setMetric(i.second);
     }
   }
+
+  recorder.save();
 }
 
 } // namespace ndn
@@ -96,10 +96,43 @@ public:
 
   /**
    * @brief Calculate for every node shortest path trees and install routes to all prefix origins
+   *
+   * In a distributed (MPI) simulation, only routes of the nodes simulated by the current rank
+   * are calculated.  Origins must still be added on every rank.
    */
   static void
   CalculateRoutes();
 
+  /**
+   * @brief Make CalculateRoutes keep shortest path trees of all nodes for RecalculateRoutes
+   *
+   * Must be called before CalculateRoutes.  CalculateRoutes then installs the same routes
+   * (when several origins of a prefix are reachable through the same face, with the lowest
+   * cost), but keeps distance and next hop towards every node in the tree of every node, which
+   * takes memory proportional to the square of the number of nodes.  The route cache (see
+   * SetRouteCacheDirectory) is not used.
+   */
+  static void
+  EnableIncrementalUpdates(bool isEnabled = true);
+
+  /**
+   * @brief Update routes installed by CalculateRoutes after link failures and recoveries
+   *
+   * Compares the current graph (links failed with LinkControlHelper::FailLink are excluded;
+   * face metrics may have changed) with the graph of the last calculation, recomputes shortest
+   * paths only towards the affected nodes, and adds or removes only next hops that differ.
+   * Stale routes over failed links are removed.
+   *
+   * \code
+   *   Simulator::Schedule(Seconds(10.0), ndn::LinkControlHelper::FailLinkByName, "A", "B");
+   *   Simulator::Schedule(Seconds(10.0), ndn::GlobalRoutingHelper::RecalculateRoutes);
+   * \endcode
+   *
+   * Requires EnableIncrementalUpdates before CalculateRoutes.
+   */
+  static void
+  RecalculateRoutes();
+
   /**
    * @brief Calculate all possible next-hop independent alternative routes
    *
@@ -111,6 +144,21 @@ public:
   static void
   CalculateAllPossibleRoutes();
 
+  /**
+   * @brief Keep routes computed by CalculateRoutes and CalculateAllPossibleRoutes in @p directory
+   *
+   * Computed routes are saved to a binary file named after a hash of the routing topology:
+   * nodes, links, face metrics and origins (and the MPI rank, in distributed simulations).
+   * When a later run finds a file for the same topology, its routes are installed into the FIBs
+   * directly and no shortest paths are calculated.  This saves time in parameter sweeps,
+   * where every run of a scenario computes the same routes.
+   *
+   * Files are written atomically, so parallel runs may share the directory, which must exist.
+   * An empty @p directory (default) disables the cache.
+   */
+  static void
+  SetRouteCacheDirectory(const std::string& directory);
+
 private:
   void
   Install(Ptr<Channel> channel);
@@ -33,6 +33,7 @@
 
 #include "model/ndn-l3-protocol.hpp"
 #include "model/ndn-net-device-face.hpp"
+#include "model/ndn-global-router.hpp"
 
 #include "fw/forwarder.hpp"
 
@@ -41,6 +42,21 @@ NS_LOG_COMPONENT_DEFINE("ndn.LinkControlHelper");
 namespace ns3 {
 namespace ndn {
 
+void
+LinkControlHelper::setIncidencyState(Ptr<Node> node, shared_ptr<Face> face, bool isUp)
+{
+  Ptr<GlobalRouter> gr = node->GetObject<GlobalRouter>();
+  if (gr == nullptr || face == nullptr)
+    return;
+
+  if (isUp) {
+    gr->EnableIncidency(face);
+  }
+  else {
+    gr->DisableIncidency(face);
+  }
+}
+
 void
 LinkControlHelper::setErrorRate(Ptr<Node> node1, Ptr<Node> node2, double errorRate)
 {
@@ -84,6 +100,10 @@ LinkControlHelper::setErrorRate(Ptr<Node> node1, Ptr<Node> node2, double errorRa
 
       nd1->SetAttribute("ReceiveErrorModel", PointerValue(errorFactory.Create<ErrorModel>()));
       nd2->SetAttribute("ReceiveErrorModel", PointerValue(errorFactory.Create<ErrorModel>()));
+
+      // failed links are excluded from global routes calculated (or recalculated) later
+      setIncidencyState(node1, ndFace, errorRate < 1.0);
+      setIncidencyState(node2, ndn2->getFaceByNetDevice(nd2), errorRate < 1.0);
       return;
     }
   }
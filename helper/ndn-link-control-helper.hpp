@@ -21,6 +21,7 @@
 #define NDN_LINK_CONTROL_HELPER_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/model/ndn-face.hpp"
 
 #include "ns3/ptr.h"
 #include "ns3/node.h"
@@ -32,6 +33,9 @@ namespace ndn {
  * @ingroup ndn-helpers
  * @brief Helper class to control the up or down statuss of an NDN link connecting two specific
  *        nodes
+ *
+ * Failed links are also excluded from routes calculated by GlobalRoutingHelper afterwards.
+ * GlobalRoutingHelper::RecalculateRoutes updates installed routes after FailLink and UpLink.
  */
 class LinkControlHelper {
 public:
@@ -96,6 +100,9 @@ public:
   UpLinkByName(const std::string& node1, const std::string& node2);
 
 private:
+  static void
+  setIncidencyState(Ptr<Node> node, shared_ptr<Face> face, bool isUp);
+
   static void
   setErrorRate(Ptr<Node> node1, Ptr<Node> node2, double errorRate);
 }; // LinkControlHelper
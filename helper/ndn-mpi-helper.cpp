@@ -0,0 +1,294 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-mpi-helper.hpp"
+
+#include "ns3/log.h"
+#include "ns3/names.h"
+#include "ns3/node-list.h"
+
+#include "utils/tracers/l2-rate-tracer.hpp"
+#include "utils/tracers/ndn-app-delay-tracer.hpp"
+#include "utils/tracers/ndn-cs-tracer.hpp"
+#include "utils/tracers/ndn-dashplayer-tracer.hpp"
+#include "utils/tracers/ndn-fileconsumer-log-tracer.hpp"
+#include "utils/tracers/ndn-fileconsumer-tracer.hpp"
+#include "utils/tracers/ndn-l3-rate-tracer.hpp"
+
+#ifdef NS3_MPI
+#include "ns3/mpi-interface.h"
+#include <mpi.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <unordered_map>
+
+#include <boost/lexical_cast.hpp>
+
+NS_LOG_COMPONENT_DEFINE("ndn.MpiHelper");
+
+namespace ns3 {
+namespace ndn {
+
+// trace files requested by the scenario, in the order they were opened
+static std::vector<std::string> g_rankFiles;
+
+static std::string
+rankFileName(const std::string& file, uint32_t systemId)
+{
+  return file + ".rank-" + boost::lexical_cast<std::string>(systemId);
+}
+
+bool
+MpiHelper::IsDistributed()
+{
+  return GetSize() > 1;
+}
+
+uint32_t
+MpiHelper::GetSystemId()
+{
+#ifdef NS3_MPI
+  if (MpiInterface::IsEnabled()) {
+    return MpiInterface::GetSystemId();
+  }
+#endif
+  return 0;
+}
+
+uint32_t
+MpiHelper::GetSize()
+{
+#ifdef NS3_MPI
+  if (MpiInterface::IsEnabled()) {
+    return MpiInterface::GetSize();
+  }
+#endif
+  return 1;
+}
+
+bool
+MpiHelper::IsLocal(Ptr<Node> node)
+{
+  return !IsDistributed() || node->GetSystemId() == GetSystemId();
+}
+
+std::string
+MpiHelper::GetRankFileName(const std::string& file)
+{
+  if (file == "-" || !IsDistributed()) {
+    return file;
+  }
+
+  if (std::find(g_rankFiles.begin(), g_rankFiles.end(), file) == g_rankFiles.end()) {
+    g_rankFiles.push_back(file);
+  }
+  return rankFileName(file, GetSystemId());
+}
+
+#ifdef NS3_MPI
+
+namespace {
+
+struct TraceRow
+{
+  double time;
+  uint32_t node;
+  std::string line;
+};
+
+/**
+ * @brief Map the "Node" column of the tracers (node name or node id) to the node id
+ */
+class NodeOrder
+{
+public:
+  NodeOrder()
+  {
+    for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+      std::string name = Names::FindName(*node);
+      if (!name.empty()) {
+        m_ids[name] = (*node)->GetId();
+      }
+    }
+  }
+
+  uint32_t
+  operator()(const std::string& node) const
+  {
+    auto id = m_ids.find(node);
+    if (id != m_ids.end()) {
+      return id->second;
+    }
+
+    char* end = nullptr;
+    unsigned long value = std::strtoul(node.c_str(), &end, 10);
+    if (!node.empty() && *end == '\0') {
+      return static_cast<uint32_t>(value);
+    }
+    return std::numeric_limits<uint32_t>::max();
+  }
+
+private:
+  std::unordered_map<std::string, uint32_t> m_ids;
+};
+
+} // namespace
+
+static void
+mergeRankFiles(const std::string& file, uint32_t nRanks, const NodeOrder& nodeOrder)
+{
+  std::string header;
+  std::vector<TraceRow> rows;
+
+  for (uint32_t rank = 0; rank < nRanks; rank++) {
+    std::string rankFile = rankFileName(file, rank);
+    std::ifstream is(rankFile.c_str());
+    if (!is.is_open()) {
+      // the scenario may have installed this tracer on some ranks only
+      NS_LOG_DEBUG("Rank " << rank << " has not written " << rankFile);
+      continue;
+    }
+
+    std::string line;
+    if (std::getline(is, line) && header.empty()) {
+      header = line;
+    }
+
+    while (std::getline(is, line)) {
+      if (line.empty())
+        continue;
+
+      // all tracers start rows with "Time<TAB>Node<TAB>"
+      TraceRow row;
+      row.time = std::strtod(line.c_str(), nullptr);
+      row.node = std::numeric_limits<uint32_t>::max();
+      size_t timeEnd = line.find('\t');
+      if (timeEnd != std::string::npos) {
+        size_t nodeEnd = line.find('\t', timeEnd + 1);
+        row.node = nodeOrder(line.substr(timeEnd + 1, nodeEnd - timeEnd - 1));
+      }
+      row.line.swap(line);
+      rows.push_back(std::move(row));
+    }
+
+    is.close();
+    std::remove(rankFile.c_str());
+  }
+
+  // rows of the same node are already in order; stable sorting keeps it
+  std::stable_sort(rows.begin(), rows.end(), [] (const TraceRow& a, const TraceRow& b) {
+      return a.time < b.time || (a.time == b.time && a.node < b.node);
+    });
+
+  std::ofstream os(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+  if (!os.is_open()) {
+    NS_LOG_ERROR("File " << file << " cannot be opened for writing. Trace is not merged");
+    return;
+  }
+
+  if (!header.empty()) {
+    os << header << "\n";
+  }
+  for (const auto& row : rows) {
+    os << row.line << "\n";
+  }
+
+  NS_LOG_DEBUG("Merged " << rows.size() << " rows from " << nRanks << " ranks into " << file);
+}
+
+/**
+ * @brief Collect names of trace files opened on any rank at rank 0, in the order of ranks
+ */
+static std::vector<std::string>
+gatherRankFiles(uint32_t nRanks)
+{
+  std::string local;
+  for (const auto& file : g_rankFiles) {
+    local += file + '\n';
+  }
+
+  int length = static_cast<int>(local.size());
+  std::vector<int> lengths(nRanks);
+  MPI_Gather(&length, 1, MPI_INT, &lengths[0], 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+  std::vector<int> offsets(nRanks, 0);
+  for (uint32_t rank = 1; rank < nRanks; rank++) {
+    offsets[rank] = offsets[rank - 1] + lengths[rank - 1];
+  }
+  std::vector<char> all(offsets.back() + lengths.back() + 1);
+  MPI_Gatherv(&local[0], length, MPI_CHAR, &all[0], &lengths[0], &offsets[0], MPI_CHAR, 0,
+              MPI_COMM_WORLD);
+
+  std::vector<std::string> files;
+  std::string file;
+  for (auto c = all.begin(); c + 1 != all.end(); ++c) {
+    if (*c != '\n') {
+      file += *c;
+    }
+    else {
+      if (std::find(files.begin(), files.end(), file) == files.end()) {
+        files.push_back(file);
+      }
+      file.clear();
+    }
+  }
+  return files;
+}
+#endif // NS3_MPI
+
+void
+MpiHelper::MergeTraces()
+{
+  // flush and close all tracer outputs
+  L2RateTracer::Destroy();
+  L3RateTracer::Destroy();
+  CsTracer::Destroy();
+  AppDelayTracer::Destroy();
+  DASHPlayerTracer::Destroy();
+  FileConsumerTracer::Destroy();
+  FileConsumerLogTracer::Destroy();
+
+#ifdef NS3_MPI
+  if (IsDistributed()) {
+    // tracers may be installed on some ranks only, so rank 0 learns all file names; gathering
+    // them also guarantees that all ranks have closed their files before rank 0 reads them
+    std::vector<std::string> files = gatherRankFiles(GetSize());
+
+    if (GetSystemId() == 0) {
+      NodeOrder nodeOrder;
+      for (const auto& file : files) {
+        mergeRankFiles(file, GetSize(), nodeOrder);
+      }
+    }
+
+    // merged files are complete when MergeTraces returns on any rank
+    MPI_Barrier(MPI_COMM_WORLD);
+  }
+#endif // NS3_MPI
+
+  g_rankFiles.clear();
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,106 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_MPI_HELPER_H
+#define NDN_MPI_HELPER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/node.h"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Helper for running NDN scenarios distributed among several MPI processes
+ *
+ * In a distributed simulation every process (rank) builds the complete topology, but only
+ * simulates the nodes whose system id matches its own.  Stack, routing, application and
+ * tracer helpers use this class to set up only the local nodes.
+ *
+ * Tracers write to a separate file per rank (see GetRankFileName).  At the end of the
+ * simulation, MergeTraces collects the per-rank files into the file name requested by the
+ * scenario, so that the output has the same layout as the output of a serial run:
+ *
+ * \code
+ *   Simulator::Run();
+ *   ndn::MpiHelper::MergeTraces();
+ *   Simulator::Destroy();
+ *   MpiInterface::Disable();
+ * \endcode
+ *
+ * Without MPI (or with a single rank) all methods fall back to serial behavior.
+ */
+class MpiHelper {
+public:
+  /**
+   * @brief Check if the simulation runs in more than one MPI process
+   */
+  static bool
+  IsDistributed();
+
+  /**
+   * @brief Get system id (rank) of the current process, 0 in serial runs
+   */
+  static uint32_t
+  GetSystemId();
+
+  /**
+   * @brief Get number of MPI processes, 1 in serial runs
+   */
+  static uint32_t
+  GetSize();
+
+  /**
+   * @brief Check if @p node is simulated by the current process
+   */
+  static bool
+  IsLocal(Ptr<Node> node);
+
+  /**
+   * @brief Get name of the file the current process should write a trace to
+   *
+   * In a distributed run, returns "<file>.rank-<systemId>" and remembers @p file, so that
+   * MergeTraces can merge the per-rank files back into @p file.  Otherwise (and for "-",
+   * the standard output) @p file is returned unchanged.
+   */
+  static std::string
+  GetRankFileName(const std::string& file);
+
+  /**
+   * @brief Close all tracer outputs and merge per-rank trace files
+   *
+   * Destroys all tracers installed with the tracer helpers, which flushes and closes their
+   * files.  In a distributed run all ranks then wait for each other, and rank 0 merges the
+   * per-rank files: the header is written once and the rows are ordered by time and node, as
+   * they would be in a serial run.  The per-rank files are removed afterwards.
+   *
+   * Must be called by all ranks after Simulator::Run () and before Simulator::Destroy (),
+   * while the nodes are still available to order the rows.
+   */
+  static void
+  MergeTraces();
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_MPI_HELPER_H
@@ -85,6 +85,12 @@ ScenarioHelper::disableStatusServer()
   ndnHelper.disableStatusServer();
 }
 
+void
+ScenarioHelper::enableLazyManagement()
+{
+  ndnHelper.enableLazyManagement();
+}
+
 void
 ScenarioHelper::addRoutes(std::initializer_list<ScenarioHelper::RouteInfo> routes)
 {
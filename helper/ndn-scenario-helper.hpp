@@ -181,6 +181,12 @@ public: // topology accessors
   void
   disableStatusServer();
 
+  /**
+   * \brief Create management objects only when they are needed
+   */
+  void
+  enableLazyManagement();
+
 private:
   Ptr<Node>
   getOrCreateNode(const std::string& nodeName);
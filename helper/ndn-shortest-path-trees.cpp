@@ -0,0 +1,369 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-shortest-path-trees.hpp"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "model/ndn-global-router.hpp"
+#include "helper/ndn-fib-helper.hpp"
+#include "helper/ndn-mpi-helper.hpp"
+
+#include "ns3/log.h"
+#include "ns3/node-list.h"
+#include "ns3/channel-list.h"
+
+#include <algorithm>
+#include <limits>
+#include <set>
+
+NS_LOG_COMPONENT_DEFINE("ndn.ShortestPathTrees");
+
+namespace ns3 {
+namespace ndn {
+
+static const uint32_t INFINITE_DISTANCE = std::numeric_limits<uint32_t>::max();
+static const uint32_t NO_VERTEX = std::numeric_limits<uint32_t>::max();
+
+ShortestPathTrees::Graph
+ShortestPathTrees::readGraph()
+{
+  Graph graph;
+  auto addEdges = [&graph] (GlobalRouter& router) {
+    uint32_t source = router.GetId();
+    for (const auto& incidency : router.GetIncidencies()) {
+      const shared_ptr<Face>& face = std::get<1>(incidency);
+      uint32_t target = std::get<2>(incidency)->GetId();
+      if (graph.size() <= std::max(source, target)) {
+        graph.resize(std::max(source, target) + 1);
+      }
+      // same weights as in GlobalRoutingHelper::CalculateRoutes
+      graph[source].push_back({target, face != nullptr ? face->getId() : nfd::INVALID_FACEID,
+                               face != nullptr ? face->getMetric() : 0u});
+    }
+  };
+
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    Ptr<GlobalRouter> router = (*node)->GetObject<GlobalRouter>();
+    if (router != 0) {
+      addEdges(*router);
+    }
+  }
+  for (ChannelList::Iterator channel = ChannelList::Begin(); channel != ChannelList::End();
+       channel++) {
+    Ptr<GlobalRouter> router = (*channel)->GetObject<GlobalRouter>();
+    if (router != 0) {
+      addEdges(*router);
+    }
+  }
+  return graph;
+}
+
+void
+ShortestPathTrees::setGraph(Graph graph)
+{
+  m_graph = std::move(graph);
+
+  m_inEdges.assign(m_graph.size(), {});
+  for (uint32_t source = 0; source < m_graph.size(); source++) {
+    for (const auto& edge : m_graph[source]) {
+      m_inEdges[edge.target].push_back(std::make_pair(source, edge));
+    }
+  }
+}
+
+void
+ShortestPathTrees::relax(Tree& tree, uint32_t from, const Edge& edge, Queue& queue,
+                         PreviousState* previous)
+{
+  if (tree.distance[from] == INFINITE_DISTANCE)
+    return;
+
+  uint32_t distance = tree.distance[from] + edge.weight;
+  if (distance >= tree.distance[edge.target])
+    return;
+
+  if (previous != nullptr) {
+    // keeps the state before the first change
+    previous->insert(std::make_pair(edge.target, std::make_pair(tree.distance[edge.target],
+                                                                tree.firstHop[edge.target])));
+  }
+  tree.distance[edge.target] = distance;
+  tree.parent[edge.target] = from;
+  tree.firstHop[edge.target] = (from == tree.source) ? edge.face : tree.firstHop[from];
+  queue.push(std::make_pair(distance, edge.target));
+}
+
+void
+ShortestPathTrees::propagate(Tree& tree, Queue& queue, PreviousState* previous) const
+{
+  while (!queue.empty()) {
+    uint32_t distance = queue.top().first;
+    uint32_t vertex = queue.top().second;
+    queue.pop();
+    if (distance != tree.distance[vertex])
+      continue; // outdated queue entry
+
+    for (const auto& edge : m_graph[vertex]) {
+      relax(tree, vertex, edge, queue, previous);
+    }
+  }
+}
+
+void
+ShortestPathTrees::calculate()
+{
+  setGraph(readGraph());
+  m_trees.clear();
+  m_prefixes.clear();
+  m_origins.clear();
+  m_originated.assign(m_graph.size(), {});
+
+  std::map<Name, size_t> prefixIndex;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    Ptr<GlobalRouter> router = (*node)->GetObject<GlobalRouter>();
+    if (router == 0)
+      continue;
+
+    if (router->GetId() >= m_graph.size()) {
+      // isolated node
+      m_graph.resize(router->GetId() + 1);
+      m_inEdges.resize(router->GetId() + 1);
+      m_originated.resize(router->GetId() + 1);
+    }
+
+    for (const auto& prefix : router->GetLocalPrefixes()) {
+      auto index = prefixIndex.insert(std::make_pair(*prefix, m_prefixes.size()));
+      if (index.second) {
+        m_prefixes.push_back(prefix);
+        m_origins.push_back({});
+      }
+      m_origins[index.first->second].push_back(router->GetId());
+      m_originated[router->GetId()].push_back(index.first->second);
+    }
+
+    if (MpiHelper::IsLocal(*node)) {
+      m_trees.push_back(Tree());
+      m_trees.back().node = (*node)->GetId();
+      m_trees.back().source = router->GetId();
+    }
+  }
+
+  for (auto& tree : m_trees) {
+    tree.distance.assign(m_graph.size(), INFINITE_DISTANCE);
+    tree.parent.assign(m_graph.size(), NO_VERTEX);
+    tree.firstHop.assign(m_graph.size(), nfd::INVALID_FACEID);
+
+    Queue queue;
+    tree.distance[tree.source] = 0;
+    queue.push(std::make_pair(0, tree.source));
+    propagate(tree, queue, nullptr);
+
+    for (size_t prefix = 0; prefix < m_prefixes.size(); prefix++) {
+      installNextHops(tree, prefix, NextHops(), getNextHops(tree, prefix, nullptr));
+    }
+  }
+}
+
+size_t
+ShortestPathTrees::update()
+{
+  Graph graph = readGraph();
+  graph.resize(std::max(graph.size(), m_graph.size()));
+
+  // an edge with a changed weight is both removed and added
+  std::vector<std::pair<uint32_t, Edge>> removed;
+  std::vector<std::pair<uint32_t, Edge>> added;
+  auto isSameEdge = [] (const Edge& a, const Edge& b) {
+    return a.target == b.target && a.face == b.face && a.weight == b.weight;
+  };
+  for (uint32_t source = 0; source < graph.size(); source++) {
+    static const std::vector<Edge> noEdges;
+    const auto& oldEdges = source < m_graph.size() ? m_graph[source] : noEdges;
+    const auto& newEdges = graph[source];
+    for (const auto& edge : oldEdges) {
+      if (std::none_of(newEdges.begin(), newEdges.end(),
+                       [&] (const Edge& other) { return isSameEdge(edge, other); })) {
+        removed.push_back(std::make_pair(source, edge));
+      }
+    }
+    for (const auto& edge : newEdges) {
+      if (std::none_of(oldEdges.begin(), oldEdges.end(),
+                       [&] (const Edge& other) { return isSameEdge(edge, other); })) {
+        added.push_back(std::make_pair(source, edge));
+      }
+    }
+  }
+
+  if (removed.empty() && added.empty()) {
+    return 0;
+  }
+
+  NS_LOG_DEBUG(removed.size() << " edges removed, " << added.size() << " edges added");
+  setGraph(std::move(graph));
+  m_originated.resize(m_graph.size());
+
+  size_t nChanges = 0;
+  for (auto& tree : m_trees) {
+    tree.distance.resize(m_graph.size(), INFINITE_DISTANCE);
+    tree.parent.resize(m_graph.size(), NO_VERTEX);
+    tree.firstHop.resize(m_graph.size(), nfd::INVALID_FACEID);
+
+    PreviousState previous;
+    updateTree(tree, removed, added, previous);
+
+    std::set<size_t> prefixes;
+    for (const auto& state : previous) {
+      uint32_t vertex = state.first;
+      if (state.second.first != tree.distance[vertex] ||
+          state.second.second != tree.firstHop[vertex]) {
+        prefixes.insert(m_originated[vertex].begin(), m_originated[vertex].end());
+      }
+    }
+
+    for (size_t prefix : prefixes) {
+      nChanges += installNextHops(tree, prefix, getNextHops(tree, prefix, &previous),
+                                  getNextHops(tree, prefix, nullptr));
+    }
+  }
+  return nChanges;
+}
+
+void
+ShortestPathTrees::updateTree(Tree& tree, const std::vector<std::pair<uint32_t, Edge>>& removed,
+                              const std::vector<std::pair<uint32_t, Edge>>& added,
+                              PreviousState& previous) const
+{
+  Queue queue;
+
+  // removed edges of the tree: detach subtrees below them
+  std::vector<uint32_t> roots;
+  for (const auto& i : removed) {
+    uint32_t from = i.first;
+    const Edge& edge = i.second;
+    if (tree.parent[edge.target] == from && tree.distance[from] != INFINITE_DISTANCE &&
+        tree.distance[from] + edge.weight == tree.distance[edge.target] &&
+        (from != tree.source || tree.firstHop[edge.target] == edge.face)) {
+      roots.push_back(edge.target);
+    }
+  }
+
+  if (!roots.empty()) {
+    std::vector<std::vector<uint32_t>> children(m_graph.size());
+    for (uint32_t vertex = 0; vertex < m_graph.size(); vertex++) {
+      if (tree.parent[vertex] != NO_VERTEX) {
+        children[tree.parent[vertex]].push_back(vertex);
+      }
+    }
+
+    std::vector<bool> isDetached(m_graph.size(), false);
+    std::vector<uint32_t> detached;
+    while (!roots.empty()) {
+      uint32_t vertex = roots.back();
+      roots.pop_back();
+      if (isDetached[vertex])
+        continue;
+
+      isDetached[vertex] = true;
+      detached.push_back(vertex);
+      roots.insert(roots.end(), children[vertex].begin(), children[vertex].end());
+    }
+
+    for (uint32_t vertex : detached) {
+      previous.insert(std::make_pair(vertex, std::make_pair(tree.distance[vertex],
+                                                            tree.firstHop[vertex])));
+      tree.distance[vertex] = INFINITE_DISTANCE;
+      tree.parent[vertex] = NO_VERTEX;
+      tree.firstHop[vertex] = nfd::INVALID_FACEID;
+    }
+
+    // reattach through the remaining edges
+    for (uint32_t vertex : detached) {
+      for (const auto& in : m_inEdges[vertex]) {
+        if (!isDetached[in.first]) {
+          relax(tree, in.first, in.second, queue, &previous);
+        }
+      }
+    }
+    propagate(tree, queue, &previous);
+  }
+
+  // added edges can only shorten paths
+  for (const auto& i : added) {
+    relax(tree, i.first, i.second, queue, &previous);
+  }
+  propagate(tree, queue, &previous);
+}
+
+ShortestPathTrees::NextHops
+ShortestPathTrees::getNextHops(const Tree& tree, size_t prefix, const PreviousState* previous) const
+{
+  NextHops nextHops;
+  for (uint32_t origin : m_origins[prefix]) {
+    if (origin == tree.source)
+      continue;
+
+    uint32_t distance = tree.distance[origin];
+    nfd::FaceId face = tree.firstHop[origin];
+    if (previous != nullptr) {
+      auto state = previous->find(origin);
+      if (state != previous->end()) {
+        std::tie(distance, face) = state->second;
+      }
+    }
+    if (distance == INFINITE_DISTANCE || face == nfd::INVALID_FACEID)
+      continue;
+
+    auto nextHop = nextHops.insert(std::make_pair(face, distance));
+    nextHop.first->second = std::min(nextHop.first->second, distance);
+  }
+  return nextHops;
+}
+
+size_t
+ShortestPathTrees::installNextHops(const Tree& tree, size_t prefix, const NextHops& oldNextHops,
+                                   const NextHops& newNextHops) const
+{
+  Ptr<Node> node = NodeList::GetNode(tree.node);
+  Ptr<L3Protocol> l3 = node->GetObject<L3Protocol>();
+  const Name& name = *m_prefixes[prefix];
+  size_t nChanges = 0;
+
+  for (const auto& nextHop : oldNextHops) {
+    if (newNextHops.count(nextHop.first) == 0) {
+      NS_LOG_DEBUG("Node " << tree.node << ": route del " << name << " via " << nextHop.first);
+      FibHelper::RemoveRoute(node, name, l3->getFaceById(nextHop.first));
+      nChanges++;
+    }
+  }
+
+  for (const auto& nextHop : newNextHops) {
+    auto oldNextHop = oldNextHops.find(nextHop.first);
+    if (oldNextHop == oldNextHops.end() || oldNextHop->second != nextHop.second) {
+      NS_LOG_DEBUG("Node " << tree.node << ": route add " << name << " via " << nextHop.first
+                   << " metric " << nextHop.second);
+      FibHelper::AddRoute(node, name, l3->getFaceById(nextHop.first),
+                          static_cast<int32_t>(nextHop.second));
+      nChanges++;
+    }
+  }
+  return nChanges;
+}
+
+} // namespace ndn
+} // namespace ns3
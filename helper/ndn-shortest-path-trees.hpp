@@ -0,0 +1,148 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_SHORTEST_PATH_TREES_H
+#define NDN_SHORTEST_PATH_TREES_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/model/ndn-face.hpp"
+
+#include <map>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Shortest path trees of all nodes over the GlobalRouter graph, updated incrementally
+ *
+ * Used by GlobalRoutingHelper::RecalculateRoutes.  calculate() computes the tree of every
+ * (local) node and installs routes to all origins, like GlobalRoutingHelper::CalculateRoutes.
+ * update() compares the GlobalRouter graph with the graph of the last calculation (edges
+ * removed by LinkControlHelper::FailLink, added by UpLink, face metric changes) and repairs
+ * only the affected parts of the trees:
+ *
+ * - for a removed tree edge, the subtree below it is detached and reattached through the
+ *   remaining edges;
+ * - an added (or cheaper) edge improves distances from its endpoint on.
+ *
+ * Only prefixes of origins whose distance or first hop has changed are revisited, and only
+ * next hops that differ are added to or removed from the FIBs.
+ *
+ * Every tree keeps distance, parent and first hop of all graph vertices, so memory grows with
+ * the square of the number of nodes.
+ */
+class ShortestPathTrees {
+public:
+  /**
+   * @brief Compute trees of all local nodes and install routes to all origins
+   */
+  void
+  calculate();
+
+  /**
+   * @brief Update trees and routes to the current graph
+   * @returns number of next hops added to or removed from the FIBs
+   */
+  size_t
+  update();
+
+private:
+  struct Edge
+  {
+    uint32_t target;
+    nfd::FaceId face; ///< INVALID_FACEID for edges from channels
+    uint32_t weight;
+  };
+
+  typedef std::vector<std::vector<Edge>> Graph;
+
+  struct Tree
+  {
+    uint32_t node;   ///< id of the node in NodeList
+    uint32_t source; ///< vertex of the node
+    std::vector<uint32_t> distance;
+    std::vector<uint32_t> parent;
+    std::vector<nfd::FaceId> firstHop;
+  };
+
+  /// distance and first hop of a vertex before an update
+  typedef std::unordered_map<uint32_t, std::pair<uint32_t, nfd::FaceId>> PreviousState;
+
+  typedef std::priority_queue<std::pair<uint32_t, uint32_t>,
+                              std::vector<std::pair<uint32_t, uint32_t>>,
+                              std::greater<std::pair<uint32_t, uint32_t>>> Queue;
+
+  /// next hop face => cost
+  typedef std::map<nfd::FaceId, uint32_t> NextHops;
+
+private:
+  /**
+   * @brief Read the graph from GlobalRouters of nodes and channels (vertices are router ids)
+   */
+  static Graph
+  readGraph();
+
+  void
+  setGraph(Graph graph);
+
+  /**
+   * @brief Relax @p edge from @p from; remember previous state of the target in @p previous
+   */
+  static void
+  relax(Tree& tree, uint32_t from, const Edge& edge, Queue& queue, PreviousState* previous);
+
+  /**
+   * @brief Dijkstra's algorithm from the vertices in @p queue
+   */
+  void
+  propagate(Tree& tree, Queue& queue, PreviousState* previous) const;
+
+  void
+  updateTree(Tree& tree, const std::vector<std::pair<uint32_t, Edge>>& removed,
+             const std::vector<std::pair<uint32_t, Edge>>& added, PreviousState& previous) const;
+
+  /**
+   * @brief Next hops towards origins of @p prefix, with distances of vertices in @p previous
+   *        overriding the current ones (if given)
+   */
+  NextHops
+  getNextHops(const Tree& tree, size_t prefix, const PreviousState* previous) const;
+
+  size_t
+  installNextHops(const Tree& tree, size_t prefix, const NextHops& oldNextHops,
+                  const NextHops& newNextHops) const;
+
+private:
+  Graph m_graph;
+  std::vector<std::vector<std::pair<uint32_t, Edge>>> m_inEdges; ///< target => (source, edge)
+  std::vector<Tree> m_trees;
+
+  std::vector<shared_ptr<const Name>> m_prefixes;
+  std::vector<std::vector<uint32_t>> m_origins;    ///< prefix => vertices
+  std::vector<std::vector<size_t>> m_originated;   ///< vertex => prefixes
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_SHORTEST_PATH_TREES_H
@@ -29,7 +29,10 @@
 #include "utils/ndn-time.hpp"
 #include "utils/dummy-keychain.hpp"
 #include "model/cs/ndn-content-store.hpp"
+#include "helper/ndn-mpi-helper.hpp"
+#include "helper/ndn-cs-snapshot-helper.hpp"
 
+#include <chrono>
 #include <limits>
 #include <map>
 #include <boost/lexical_cast.hpp>
@@ -47,6 +50,7 @@ StackHelper::StackHelper()
   , m_isFaceManagerDisabled(false)
   , m_isStatusServerDisabled(false)
   , m_isStrategyChoiceManagerDisabled(false)
+  , m_isManagementLazy(false)
 {
   setCustomNdnCxxClocks();
 
@@ -137,13 +141,25 @@ void StackHelper::setOpMIPS(bool turnOn)
   }
 }
 
+void
+StackHelper::setCsSnapshot(const std::string& file)
+{
+  m_csSnapshot = make_shared<CsSnapshotHelper>(file);
+}
+
 Ptr<FaceContainer>
 StackHelper::Install(const NodeContainer& c) const
 {
+  auto begin = std::chrono::steady_clock::now();
+
   Ptr<FaceContainer> faces = Create<FaceContainer>();
   for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i) {
     faces->AddAll(Install(*i));
   }
+
+  std::chrono::duration<double, std::milli> setupTime = std::chrono::steady_clock::now() - begin;
+  NS_LOG_INFO("Installed NDN stack on " << c.GetN() << " nodes in " << setupTime.count()
+              << " ms (" << (c.GetN() > 0 ? setupTime.count() / c.GetN() : 0.0) << " ms/node)");
   return faces;
 }
 
@@ -156,6 +172,8 @@ StackHelper::InstallAll() const
 Ptr<FaceContainer>
 StackHelper::Install(Ptr<Node> node) const
 {
+  auto begin = std::chrono::steady_clock::now();
+
   Ptr<FaceContainer> faces = Create<FaceContainer>();
 
   if (node->GetObject<L3Protocol>() != 0) {
@@ -182,6 +200,10 @@ StackHelper::Install(Ptr<Node> node) const
     ndn->getConfig().put("ndnSIM.disable_strategy_choice_manager", true);
   }
 
+  if (m_isManagementLazy) {
+    ndn->getConfig().put("ndnSIM.lazy_management", true);
+  }
+
   ndn->getConfig().put("tables.cs_max_packets", (m_maxCsSize == 0) ? 1 : m_maxCsSize);
 
   //OON
@@ -209,6 +231,13 @@ StackHelper::Install(Ptr<Node> node) const
     faces->Add(this->createAndRegisterFace(node, ndn, device));
   }
 
+  if (m_csSnapshot != nullptr && MpiHelper::IsLocal(node)) {
+    m_csSnapshot->Restore(node);
+  }
+
+  std::chrono::duration<double, std::milli> setupTime = std::chrono::steady_clock::now() - begin;
+  NS_LOG_INFO("Node " << node->GetId() << ": NDN stack installed in " << setupTime.count()
+              << " ms");
   return faces;
 }
 
@@ -336,7 +365,7 @@ StackHelper::createAndRegisterFace(Ptr<Node> node, Ptr<L3Protocol> ndn, Ptr<NetD
     face = DefaultNetDeviceCallback(node, ndn, device);
   }
 
-  if (m_needSetDefaultRoutes) {
+  if (m_needSetDefaultRoutes && MpiHelper::IsLocal(node)) {
     // default route with lowest priority possible
     FibHelper::AddRoute(node, "/", face, std::numeric_limits<int32_t>::max());
   }
@@ -367,5 +396,11 @@ StackHelper::disableStatusServer()
   m_isStatusServerDisabled = true;
 }
 
+void
+StackHelper::enableLazyManagement()
+{
+  m_isManagementLazy = true;
+}
+
 } // namespace ndn
 } // namespace ns3
@@ -39,6 +39,7 @@ namespace ndn {
 
 class NetDeviceFace;
 class L3Protocol;
+class CsSnapshotHelper;
 
 /**
  * @ingroup ndn
@@ -178,10 +179,19 @@ public:
 
   /**
    * \brief Set flag indicating necessity to install default routes in FIB
+   *
+   * In a distributed (MPI) simulation, default routes are installed only on nodes simulated by
+   * the current rank.
    */
   void
   SetDefaultRoutes(bool needSet);
 
+  /**
+   * \brief Get KeyChain used to sign management commands of all nodes
+   *
+   * The KeyChain uses dummy PIB and TPM and holds no per-node state, so one instance per
+   * process (MPI rank) is shared by the nodes that process simulates.
+   */
   static KeyChain&
   getKeyChain();
 
@@ -239,6 +249,34 @@ public:
   void
   disableStatusServer();
 
+  /**
+   * \brief Create NFD management objects only when they are needed
+   *
+   * FibManager, FaceManager, StrategyChoiceManager, StatusServer and their command validator
+   * are created when the first management Interest reaches /localhost/nfd on the node.
+   * Until then, FibHelper and StrategyChoiceHelper (and the routes GlobalRoutingHelper and
+   * StackHelper install through them) update the node's tables directly.  The RIB manager
+   * is started together with the other managers: the first prefix registration of an
+   * ndn-cxx application starts it, but times out, and has to be retried.
+   * This shortens setup of large topologies in which most nodes are never managed.
+   *
+   * Setup time of each node is reported in the ndn.StackHelper log (level INFO).
+   */
+  void
+  enableLazyManagement();
+
+  /**
+   * \brief Restore content stores from a snapshot saved with CsSnapshotHelper
+   *
+   * Content store of each node is restored when the stack is installed on the node, so the
+   * simulation starts with warm caches.  The content store (NFD's or an ndnSIM 1.0 one) and its
+   * size should be set up as in the run that saved the snapshot.
+   *
+   * \throw CsSnapshotHelper::Error the snapshot cannot be loaded
+   */
+  void
+  setCsSnapshot(const std::string& file);
+
 private:
   shared_ptr<NetDeviceFace>
   DefaultNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn, Ptr<NetDevice> netDevice) const;
@@ -253,6 +291,7 @@ private:
   bool m_isFaceManagerDisabled;
   bool m_isStatusServerDisabled;
   bool m_isStrategyChoiceManagerDisabled;
+  bool m_isManagementLazy;
 
 public:
   void
@@ -265,6 +304,7 @@ private:
 
   bool m_needSetDefaultRoutes;
   size_t m_maxCsSize;
+  shared_ptr<CsSnapshotHelper> m_csSnapshot;
   size_t m_maxMIPS;
 
   typedef std::list<std::pair<TypeId, NetDeviceFaceCreateCallback>> NetDeviceCallbackList;
@@ -23,6 +23,8 @@
 
 #include "ndn-stack-helper.hpp"
 
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
 namespace ns3 {
 namespace ndn {
 
@@ -32,6 +34,22 @@ void
 StrategyChoiceHelper::sendCommand(const ControlParameters& parameters, Ptr<Node> node)
 {
   NS_LOG_DEBUG("Strategy choice command was initialized");
+
+  Ptr<L3Protocol> L3protocol = node->GetObject<L3Protocol>();
+  if (!L3protocol->isManagementInitialized()) {
+    // lazy management: update the strategy choice table directly, as StrategyChoiceManager
+    // would for a valid command
+    nfd::StrategyChoice& strategyChoice = L3protocol->getForwarder()->getStrategyChoice();
+    if (!strategyChoice.hasStrategy(parameters.getStrategy()) ||
+        !strategyChoice.insert(parameters.getName(), parameters.getStrategy())) {
+      NS_LOG_WARN("Cannot set strategy " << parameters.getStrategy() << " for "
+                  << parameters.getName() << " on node " << node->GetId());
+      return;
+    }
+    NS_LOG_DEBUG("Forwarding strategy installed in node " << node->GetId());
+    return;
+  }
+
   Block encodedParameters(parameters.wireEncode());
 
   Name commandName("/localhost/nfd/strategy-choice");
@@ -40,7 +58,6 @@ StrategyChoiceHelper::sendCommand(const ControlParameters& parameters, Ptr<Node>
 
   shared_ptr<Interest> command(make_shared<Interest>(commandName));
   StackHelper::getKeyChain().sign(*command);
-  Ptr<L3Protocol> L3protocol = node->GetObject<L3Protocol>();
   auto strategyChoiceManager = L3protocol->getStrategyChoiceManager();
   strategyChoiceManager->onStrategyChoiceRequest(*command);
   NS_LOG_DEBUG("Forwarding strategy installed in node " << node->GetId());
@@ -23,6 +23,8 @@
 #include "../../utils/trie/lru-policy.hpp"
 #include "../../utils/trie/fifo-policy.hpp"
 #include "../../utils/trie/lfu-policy.hpp"
+#include "../../utils/trie/bucket-lfu-policy.hpp"
+#include "../../utils/trie/lru-k-policy.hpp"
 #include "../../utils/trie/multi-policy.hpp"
 #include "../../utils/trie/aggregate-stats-policy.hpp"
 
@@ -63,10 +65,22 @@ template class ContentStoreImpl<fifo_policy_traits>;
  **/
 template class ContentStoreImpl<lfu_policy_traits>;
 
+/**
+ * @brief ContentStore with LFU cache replacement policy with constant-time operations
+ **/
+template class ContentStoreImpl<bucket_lfu_policy_traits>;
+
+/**
+ * @brief ContentStore with LRU-2 cache replacement policy
+ **/
+template class ContentStoreImpl<lru_2_policy_traits>;
+
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, lru_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, random_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, fifo_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, lfu_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, bucket_lfu_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, lru_2_policy_traits);
 
 typedef multi_policy_traits<boost::mpl::vector2<lru_policy_traits, aggregate_stats_policy_traits>>
   LruWithCountsTraits;
@@ -114,6 +128,19 @@ class Random : public ContentStoreImpl<random_policy_traits> {
  */
 class Lfu : public ContentStoreImpl<lfu_policy_traits> {
 };
+
+/**
+ * \brief Content Store implementing Least Frequently Used cache replacement policy with
+ *        constant-time operations
+ */
+class BucketLfu : public ContentStoreImpl<bucket_lfu_policy_traits> {
+};
+
+/**
+ * \brief Content Store implementing LRU-2 cache replacement policy
+ */
+class Lru2 : public ContentStoreImpl<lru_2_policy_traits> {
+};
 #endif
 
 } // namespace cs
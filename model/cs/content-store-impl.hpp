@@ -77,6 +77,8 @@ private:
 /**
  * @ingroup ndn-cs
  * @brief Base implementation of NDN content store
+ *
+ * Entries are kept in a path-compressed trie of their names (ndnSIM::compressed_trie).
  */
 template<class Policy>
 class ContentStoreImpl
@@ -85,12 +87,12 @@ class ContentStoreImpl
       trie_with_policy<Name,
                        ndnSIM::smart_pointer_payload_traits<EntryImpl<ContentStoreImpl<Policy>>,
                                                             Entry>,
-                       Policy> {
+                       Policy, ndnSIM::compressed_trie> {
 public:
   typedef ndnSIM::
     trie_with_policy<Name, ndnSIM::smart_pointer_payload_traits<EntryImpl<ContentStoreImpl<Policy>>,
                                                                 Entry>,
-                     Policy> super;
+                     Policy, ndnSIM::compressed_trie> super;
 
   typedef EntryImpl<ContentStoreImpl<Policy>> entry;
 
@@ -125,6 +127,9 @@ public:
 
   virtual Ptr<Entry> Next(Ptr<Entry>);
 
+  virtual void
+  ForEachInEvictionOrder(const EntryVisitor& visitor);
+
   const typename super::policy_container&
   GetPolicy() const
   {
@@ -331,6 +336,16 @@ ContentStoreImpl<Policy>::Next(Ptr<Entry> from)
     return item->payload();
 }
 
+template<class Policy>
+void
+ContentStoreImpl<Policy>::ForEachInEvictionOrder(const EntryVisitor& visitor)
+{
+  for (typename super::policy_container::const_iterator item = this->getPolicy().begin();
+       item != this->getPolicy().end(); item++) {
+    visitor(item->payload()->GetData(), Time::Max());
+  }
+}
+
 } // namespace cs
 } // namespace ndn
 } // namespace ns3
@@ -23,6 +23,8 @@
 #include "../../utils/trie/lru-policy.hpp"
 #include "../../utils/trie/fifo-policy.hpp"
 #include "../../utils/trie/lfu-policy.hpp"
+#include "../../utils/trie/bucket-lfu-policy.hpp"
+#include "../../utils/trie/lru-k-policy.hpp"
 
 #define NS_OBJECT_ENSURE_REGISTERED_TEMPL(type, templ)                                             \
   static struct X##type##templ##RegistrationClass {                                                \
@@ -61,11 +63,23 @@ template class ContentStoreWithFreshness<fifo_policy_traits>;
  **/
 template class ContentStoreWithFreshness<lfu_policy_traits>;
 
+/**
+ * @brief ContentStore with freshness and LFU cache replacement policy with constant-time operations
+ **/
+template class ContentStoreWithFreshness<bucket_lfu_policy_traits>;
+
+/**
+ * @brief ContentStore with freshness and LRU-2 cache replacement policy
+ **/
+template class ContentStoreWithFreshness<lru_2_policy_traits>;
+
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithFreshness, lru_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithFreshness, random_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithFreshness, fifo_policy_traits);
 
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithFreshness, lfu_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithFreshness, bucket_lfu_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithFreshness, lru_2_policy_traits);
 
 #ifdef DOXYGEN
 // /**
@@ -92,6 +106,19 @@ class Freshness::Random : public ContentStoreWithFreshness<random_policy_traits>
 class Freshness::Lfu : public ContentStoreWithFreshness<lfu_policy_traits> {
 };
 
+/**
+ * \brief Content Store with freshness implementing Least Frequently Used cache replacement policy
+ *        with constant-time operations
+ */
+class Freshness::BucketLfu : public ContentStoreWithFreshness<bucket_lfu_policy_traits> {
+};
+
+/**
+ * \brief Content Store with freshness implementing LRU-2 cache replacement policy
+ */
+class Freshness::Lru2 : public ContentStoreWithFreshness<lru_2_policy_traits> {
+};
+
 #endif
 
 } // namespace cs
@@ -34,6 +34,10 @@ namespace cs {
 /**
  * @ingroup ndn-cs
  * @brief Special content store realization that honors Freshness parameter in Data packets
+ *
+ * With a positive ExpiryGranularity, expiration times are rounded up to its multiples, so that
+ * items expiring within the same interval are removed together by a single event, at the cost
+ * of keeping them up to ExpiryGranularity longer.
  */
 template<class Policy>
 class ContentStoreWithFreshness
@@ -58,6 +62,12 @@ public:
   virtual inline bool
   Add(shared_ptr<const Data> data);
 
+  virtual inline void
+  ForEachInEvictionOrder(const ContentStore::EntryVisitor& visitor);
+
+  virtual inline bool
+  Restore(shared_ptr<const Data> data, Time timeToExpire);
+
 private:
   inline void
   CleanExpired();
@@ -65,6 +75,12 @@ private:
   inline void
   RescheduleCleaning();
 
+  inline void
+  SetExpiryGranularity(Time granularity);
+
+  inline Time
+  GetExpiryGranularity() const;
+
 private:
   static LogComponent g_log; ///< @brief Logging variable
 
@@ -89,6 +105,17 @@ ContentStoreWithFreshness<Policy>::GetTypeId()
                         .SetParent<super>()
                         .template AddConstructor<ContentStoreWithFreshness<Policy>>()
 
+                        .AddAttribute("ExpiryGranularity",
+                                      "Expiration times are rounded up to multiples of this "
+                                      "interval, so that entries are removed in batches (0 "
+                                      "means exact expiration)",
+                                      TimeValue(Seconds(0)),
+                                      MakeTimeAccessor(&ContentStoreWithFreshness<Policy>::
+                                                         SetExpiryGranularity,
+                                                       &ContentStoreWithFreshness<Policy>::
+                                                         GetExpiryGranularity),
+                                      MakeTimeChecker())
+
     // trace stuff here
     ;
 
@@ -108,6 +135,51 @@ ContentStoreWithFreshness<Policy>::Add(shared_ptr<const Data> data)
   return true;
 }
 
+template<class Policy>
+inline void
+ContentStoreWithFreshness<Policy>::ForEachInEvictionOrder(const ContentStore::EntryVisitor&
+                                                            visitor)
+{
+  for (typename super::policy_container::const_iterator item = this->getPolicy().begin();
+       item != this->getPolicy().end(); item++) {
+    Time timeToExpire = Time::Max();
+    if (item->payload()->GetData()->getFreshnessPeriod() > time::milliseconds::zero()) {
+      timeToExpire =
+        freshness_policy_container::policy_base::get_freshness(&(*item)) - Simulator::Now();
+    }
+    visitor(item->payload()->GetData(), timeToExpire);
+  }
+}
+
+template<class Policy>
+inline bool
+ContentStoreWithFreshness<Policy>::Restore(shared_ptr<const Data> data, Time timeToExpire)
+{
+  if (timeToExpire <= Time(0)) {
+    return false; // would be removed right away
+  }
+
+  if (!super::Add(data)) {
+    return false;
+  }
+
+  typename super::super::iterator item = this->find_exact(data->getName());
+  if (item != this->end() && data->getFreshnessPeriod() > time::milliseconds::zero()) {
+    // Add has set expiration from FreshnessPeriod; re-sort the item by the requested time
+    typedef typename freshness_policy_container::policy_base::policy_container freshness_set;
+    freshness_set& freshness = this->getPolicy().template get<freshness_policy_container>();
+
+    freshness.erase(freshness.iterator_to(*item));
+    freshness_policy_container::policy_base::get_freshness(item) =
+      this->getPolicy().template get<freshness_policy_container>().get_expiry_bucket(
+        Simulator::Now() + timeToExpire);
+    freshness.insert(*item);
+  }
+
+  RescheduleCleaning();
+  return true;
+}
+
 template<class Policy>
 inline void
 ContentStoreWithFreshness<Policy>::RescheduleCleaning()
@@ -150,17 +222,20 @@ ContentStoreWithFreshness<Policy>::CleanExpired()
   // with freshness: " << freshness.size ());
   Time now = Simulator::Now();
 
-  while (!freshness.empty()) {
-    typename freshness_policy_container::iterator entry = freshness.begin();
+  // stale records are at the beginning; unlink all of them from the freshness policy at once
+  std::vector<typename super::iterator> stale;
+  typename freshness_policy_container::iterator entry = freshness.begin();
+  for (; entry != freshness.end()
+         && freshness_policy_container::policy_base::get_freshness(&(*entry)) <= now;
+       entry++) {
+    stale.push_back(&(*entry));
+  }
+  freshness.erase(freshness.begin(), entry);
 
-    if (freshness_policy_container::policy_base::get_freshness(&(*entry))
-        <= now) // is the record stale?
-    {
-      super::erase(&(*entry));
-    }
-    else
-      break; // nothing else to do. All later records will not be stale
+  for (typename super::iterator item : stale) {
+    super::erase(item); // freshness policy skips unlinked items
   }
+  NS_LOG_DEBUG(stale.size() << " stale entries removed");
   // NS_LOG_LOGIC ("<< Cleaning: Total number of items:" << this->getPolicy ().size () << ", items
   // with freshness: " << freshness.size ());
 
@@ -168,6 +243,20 @@ ContentStoreWithFreshness<Policy>::CleanExpired()
   RescheduleCleaning();
 }
 
+template<class Policy>
+inline void
+ContentStoreWithFreshness<Policy>::SetExpiryGranularity(Time granularity)
+{
+  this->getPolicy().template get<freshness_policy_container>().set_granularity(granularity);
+}
+
+template<class Policy>
+inline Time
+ContentStoreWithFreshness<Policy>::GetExpiryGranularity() const
+{
+  return this->getPolicy().template get<freshness_policy_container>().get_granularity();
+}
+
 template<class Policy>
 void
 ContentStoreWithFreshness<Policy>::Print(std::ostream& os) const
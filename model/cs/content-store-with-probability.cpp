@@ -23,6 +23,8 @@
 #include "../../utils/trie/lru-policy.hpp"
 #include "../../utils/trie/fifo-policy.hpp"
 #include "../../utils/trie/lfu-policy.hpp"
+#include "../../utils/trie/bucket-lfu-policy.hpp"
+#include "../../utils/trie/lru-k-policy.hpp"
 
 #define NS_OBJECT_ENSURE_REGISTERED_TEMPL(type, templ)                                             \
   static struct X##type##templ##RegistrationClass {                                                \
@@ -61,11 +63,24 @@ template class ContentStoreWithProbability<fifo_policy_traits>;
  **/
 template class ContentStoreWithProbability<lfu_policy_traits>;
 
+/**
+ * @brief ContentStore with probability and LFU cache replacement policy with constant-time
+ *        operations
+ **/
+template class ContentStoreWithProbability<bucket_lfu_policy_traits>;
+
+/**
+ * @brief ContentStore with probability and LRU-2 cache replacement policy
+ **/
+template class ContentStoreWithProbability<lru_2_policy_traits>;
+
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithProbability, lru_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithProbability, random_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithProbability, fifo_policy_traits);
 
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithProbability, lfu_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithProbability, bucket_lfu_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithProbability, lru_2_policy_traits);
 
 #ifdef DOXYGEN
 // /**
@@ -92,6 +107,19 @@ class Probability::Random : public ContentStoreWithProbability<random_policy_tra
 class Probability::Lfu : public ContentStoreWithProbability<lfu_policy_traits> {
 };
 
+/**
+ * \brief Content Store with probability implementing Least Frequently Used cache replacement policy
+ *        with constant-time operations
+ */
+class Probability::BucketLfu : public ContentStoreWithProbability<bucket_lfu_policy_traits> {
+};
+
+/**
+ * \brief Content Store with probability implementing LRU-2 cache replacement policy
+ */
+class Probability::Lru2 : public ContentStoreWithProbability<lru_2_policy_traits> {
+};
+
 #endif
 
 } // namespace cs
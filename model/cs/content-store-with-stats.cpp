@@ -23,6 +23,8 @@
 #include "../../utils/trie/lru-policy.hpp"
 #include "../../utils/trie/fifo-policy.hpp"
 #include "../../utils/trie/lfu-policy.hpp"
+#include "../../utils/trie/bucket-lfu-policy.hpp"
+#include "../../utils/trie/lru-k-policy.hpp"
 
 #define NS_OBJECT_ENSURE_REGISTERED_TEMPL(type, templ)                                             \
   static struct X##type##templ##RegistrationClass {                                                \
@@ -61,11 +63,23 @@ template class ContentStoreWithStats<fifo_policy_traits>;
  **/
 template class ContentStoreWithStats<lfu_policy_traits>;
 
+/**
+ * @brief ContentStore with stats and LFU cache replacement policy with constant-time operations
+ **/
+template class ContentStoreWithStats<bucket_lfu_policy_traits>;
+
+/**
+ * @brief ContentStore with stats and LRU-2 cache replacement policy
+ **/
+template class ContentStoreWithStats<lru_2_policy_traits>;
+
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithStats, lru_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithStats, random_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithStats, fifo_policy_traits);
 
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithStats, lfu_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithStats, bucket_lfu_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithStats, lru_2_policy_traits);
 
 #ifdef DOXYGEN
 // /**
@@ -92,6 +106,19 @@ class Stats::Random : public ContentStoreWithStats<random_policy_traits> {
 class Stats::Lfu : public ContentStoreWithStats<lfu_policy_traits> {
 };
 
+/**
+ * \brief Content Store with stats implementing Least Frequently Used cache replacement policy with
+ *        constant-time operations
+ */
+class Stats::BucketLfu : public ContentStoreWithStats<bucket_lfu_policy_traits> {
+};
+
+/**
+ * \brief Content Store with stats implementing LRU-2 cache replacement policy
+ */
+class Stats::Lru2 : public ContentStoreWithStats<lru_2_policy_traits> {
+};
+
 #endif
 
 } // namespace cs
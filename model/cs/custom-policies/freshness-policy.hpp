@@ -93,6 +93,7 @@ struct freshness_policy_traits {
       type(Base& base)
         : base_(base)
         , max_size_(100)
+        , granularity_(0)
       {
       }
 
@@ -107,7 +108,8 @@ struct freshness_policy_traits {
       {
         time::milliseconds freshness = item->payload()->GetData()->getFreshnessPeriod();
         if (freshness > time::milliseconds::zero()) {
-          get_freshness(item) = Simulator::Now() + MilliSeconds(freshness.count());
+          get_freshness(item) =
+            get_expiry_bucket(Simulator::Now() + MilliSeconds(freshness.count()));
 
           // push item only if freshness is non zero. otherwise, this payload is not
           // controlled by the policy.
@@ -128,9 +130,10 @@ struct freshness_policy_traits {
       inline void
       erase(typename parent_trie::iterator item)
       {
-        time::milliseconds freshness = item->payload()->GetData()->getFreshnessPeriod();
-        if (freshness > time::milliseconds::zero()) {
-          // erase only if freshness is positive (otherwise an item is not in the policy)
+        // an item is not in the policy if its freshness is not positive or if it has been
+        // removed together with other expired items
+        if (static_cast<typename policy_container::value_traits::hook_type*>(
+              policy_container::value_traits::to_node_ptr(*item))->is_linked()) {
           policy_container::erase(policy_container::s_iterator_to(*item));
         }
       }
@@ -153,6 +156,37 @@ struct freshness_policy_traits {
         return max_size_;
       }
 
+      /**
+       * @brief Round expiration times up to multiples of @p granularity
+       *
+       * Items that expire within the same interval get the same expiration time and are
+       * removed together.  Zero (default) keeps exact expiration times.
+       */
+      inline void
+      set_granularity(Time granularity)
+      {
+        granularity_ = granularity;
+      }
+
+      inline Time
+      get_granularity() const
+      {
+        return granularity_;
+      }
+
+      /**
+       * @brief Expiration time of an item that should expire at @p time
+       */
+      inline Time
+      get_expiry_bucket(Time time) const
+      {
+        if (!granularity_.IsStrictlyPositive()) {
+          return time;
+        }
+        int64_t step = granularity_.GetTimeStep();
+        return TimeStep((time.GetTimeStep() + step - 1) / step * step);
+      }
+
     private:
       type()
         : base_(*((Base*)0)){};
@@ -160,6 +194,7 @@ struct freshness_policy_traits {
     private:
       Base& base_;
       size_t max_size_;
+      Time granularity_;
     };
   };
 };
@@ -52,6 +52,20 @@ ContentStore::~ContentStore()
 {
 }
 
+void
+ContentStore::ForEachInEvictionOrder(const EntryVisitor& visitor)
+{
+  for (Ptr<cs::Entry> entry = Begin(); entry != End(); entry = Next(entry)) {
+    visitor(entry->GetData(), Time::Max());
+  }
+}
+
+bool
+ContentStore::Restore(shared_ptr<const Data> data, Time timeToExpire)
+{
+  return Add(data);
+}
+
 namespace cs {
 
 //////////////////////////////////////////////////////////////////////
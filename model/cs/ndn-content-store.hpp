@@ -24,8 +24,10 @@
 
 #include "ns3/object.h"
 #include "ns3/ptr.h"
+#include "ns3/nstime.h"
 #include "ns3/traced-callback.h"
 
+#include <functional>
 #include <tuple>
 
 namespace ns3 {
@@ -168,6 +170,30 @@ public:
    */
   virtual Ptr<cs::Entry> Next(Ptr<cs::Entry>) = 0;
 
+  typedef std::function<void(shared_ptr<const Data>, Time)> EntryVisitor;
+
+  /**
+   * @brief Call @p visitor for every entry, the next to be evicted by the replacement policy
+   *        first, together with the time left until the content store removes the entry as
+   *        expired (Time::Max () if it never does)
+   *
+   * Restoring the entries in this order into an empty content store of the same type recreates
+   * the eviction order (frequencies of LFU are not preserved).  The default implementation
+   * enumerates entries with Begin and Next, in no particular order.
+   */
+  virtual void
+  ForEachInEvictionOrder(const EntryVisitor& visitor);
+
+  /**
+   * @brief Add @p data that should expire after @p timeToExpire, regardless of its
+   *        FreshnessPeriod
+   *
+   * Used to restore a saved content store.  The default implementation ignores
+   * @p timeToExpire and calls Add.
+   */
+  virtual bool
+  Restore(shared_ptr<const Data> data, Time timeToExpire);
+
   ////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////
@@ -66,7 +66,7 @@ GlobalRouter::GetL3Protocol() const
 }
 
 void
-GlobalRouter::AddLocalPrefix(shared_ptr<Name> prefix)
+GlobalRouter::AddLocalPrefix(shared_ptr<const Name> prefix)
 {
   m_localPrefixes.push_back(prefix);
 }
@@ -77,6 +77,37 @@ GlobalRouter::AddIncidency(shared_ptr<Face> face, Ptr<GlobalRouter> gr)
   m_incidencies.push_back(std::make_tuple(this, face, gr));
 }
 
+/**
+ * @brief Move edges over @p face from @p from to @p to
+ */
+static bool
+moveIncidencies(GlobalRouter::IncidencyList& from, GlobalRouter::IncidencyList& to,
+                const shared_ptr<Face>& face)
+{
+  bool isMoved = false;
+  for (auto i = from.begin(); i != from.end();) {
+    auto next = std::next(i);
+    if (std::get<1>(*i) == face) {
+      to.splice(to.end(), from, i);
+      isMoved = true;
+    }
+    i = next;
+  }
+  return isMoved;
+}
+
+bool
+GlobalRouter::DisableIncidency(shared_ptr<Face> face)
+{
+  return moveIncidencies(m_incidencies, m_disabledIncidencies, face);
+}
+
+bool
+GlobalRouter::EnableIncidency(shared_ptr<Face> face)
+{
+  return moveIncidencies(m_disabledIncidencies, m_incidencies, face);
+}
+
 GlobalRouter::IncidencyList&
 GlobalRouter::GetIncidencies()
 {
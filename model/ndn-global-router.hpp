@@ -54,7 +54,7 @@ public:
   /**
    * @brief List of locally exported prefixes
    */
-  typedef std::list<shared_ptr<Name>> LocalPrefixList;
+  typedef std::list<shared_ptr<const Name>> LocalPrefixList;
 
   /**
    * \brief Interface ID
@@ -83,10 +83,10 @@ public:
 
   /**
    * @brief Add new locally exported prefix
-   * @param prefix Prefix
+   * @param prefix Prefix, preferably interned (nfd::internName) to be shared with the FIBs
    */
   void
-  AddLocalPrefix(shared_ptr<Name> prefix);
+  AddLocalPrefix(shared_ptr<const Name> prefix);
 
   /**
    * @brief Add edge to the node
@@ -96,8 +96,24 @@ public:
   void
   AddIncidency(shared_ptr<Face> face, Ptr<GlobalRouter> ndn);
 
+  /**
+   * @brief Exclude edges over @p face from route calculations, e.g., when the link fails
+   * @returns true if any edge has been excluded
+   */
+  bool
+  DisableIncidency(shared_ptr<Face> face);
+
+  /**
+   * @brief Include edges over @p face, excluded by DisableIncidency, in route calculations again
+   * @returns true if any edge has been included
+   */
+  bool
+  EnableIncidency(shared_ptr<Face> face);
+
   /**
    * @brief Get list of edges that are connected to this node
+   *
+   * Edges excluded with DisableIncidency are not in the list.
    */
   IncidencyList&
   GetIncidencies();
@@ -125,6 +141,7 @@ private:
   Ptr<L3Protocol> m_ndn;
   LocalPrefixList m_localPrefixes;
   IncidencyList m_incidencies;
+  IncidencyList m_disabledIncidencies;
 
   static uint32_t m_idCounter;
 };
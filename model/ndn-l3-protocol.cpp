@@ -95,10 +95,18 @@ L3Protocol::GetTypeId(void)
   return tid;
 }
 
-class L3Protocol::Impl {
-private:
-  Impl()
-  {
+/**
+ * @brief Get the initial NFD config, shared by all nodes
+ *
+ * The text is parsed when the first node is created; every node starts with a copy of the
+ * parsed tree, which helpers then adjust (see L3Protocol::getConfig).
+ */
+static const nfd::ConfigSection&
+getInitialConfig()
+{
+  static nfd::ConfigSection initial;
+  static bool isParsed = false;
+  if (!isParsed) {
     // Do not modify initial config file. Use helpers to set specific NFD parameters
     std::string initialConfig =
       "general\n"
@@ -149,7 +157,18 @@ private:
       "\n";
 
     std::istringstream input(initialConfig);
-    boost::property_tree::read_info(input, m_config);
+    boost::property_tree::read_info(input, initial);
+    isParsed = true;
+  }
+  return initial;
+}
+
+class L3Protocol::Impl {
+private:
+  Impl()
+    : m_config(getInitialConfig())
+    , m_areManagersInitialized(false)
+  {
   }
 
   friend class L3Protocol;
@@ -165,6 +184,7 @@ private:
   shared_ptr< ::ndn::Face> m_face;
 
   nfd::ConfigSection m_config;
+  bool m_areManagersInitialized;
 
   Ptr<ContentStore> m_csFromNdnSim;
   Ptr<ContentStore> m_opFromNdnSim;
@@ -188,8 +208,10 @@ L3Protocol::initialize()
 
   initializeManagement();
 
-  if (!this->getConfig().get<bool>("ndnSIM.disable_rib_manager", false)) {
-    Simulator::ScheduleWithContext(m_node->GetId(), Seconds(0), &L3Protocol::initializeRibManager, this);
+  // with lazy management, the RIB manager is started together with the other managers,
+  // because registering with NFD would create them right away
+  if (!this->getConfig().get<bool>("ndnSIM.lazy_management", false)) {
+    scheduleRibManager();
   }
 
   m_impl->m_forwarder->getFaceTable().addReserved(make_shared<nfd::NullFace>(), nfd::FACEID_NULL);
@@ -222,12 +244,91 @@ private:
 void
 L3Protocol::initializeManagement()
 {
-  auto& keyChain = StackHelper::getKeyChain();
   auto& forwarder = m_impl->m_forwarder;
   using namespace nfd;
 
   m_impl->m_internalFace = make_shared<InternalFace>();
 
+  bool isLazy = this->getConfig().get<bool>("ndnSIM.lazy_management", false);
+  if (!isLazy) {
+    createManagers();
+  }
+
+  // The config is walked once.  With lazy management, the managers do not exist yet, so their
+  // sections are skipped here and applied when the managers are created.
+  ConfigFile config((IgnoreSections(isLazy ?
+                                    std::vector<std::string>{"general", "log", "authorizations",
+                                                             "face_system", "rib", "ndnSIM"} :
+                                    std::vector<std::string>{"general", "log", "rib", "ndnSIM"})));
+
+  TablesConfigSection tablesConfig(forwarder->getCs(),
+                                   forwarder->getPit(),
+                                   forwarder->getFib(),
+                                   forwarder->getStrategyChoice(),
+                                   forwarder->getMeasurements());
+  tablesConfig.setConfigFile(config);
+
+  if (!isLazy) {
+    setManagersConfigFile(config);
+  }
+
+  forwarder->getFaceTable().addReserved(m_impl->m_internalFace, FACEID_INTERNAL_FACE);
+
+  // apply config
+  config.parse(m_impl->m_config, false, "ndnSIM.conf");
+
+  tablesConfig.ensureTablesAreConfigured();
+
+  // add FIB entry for NFD Management Protocol
+  shared_ptr<fib::Entry> entry = forwarder->getFib().insert("/localhost/nfd").first;
+  entry->addNextHop(m_impl->m_internalFace, 0);
+
+  if (isLazy) {
+    m_impl->m_internalFace->setFilterInitializer(bind(&L3Protocol::initializeManagers, this));
+  }
+}
+
+void
+L3Protocol::initializeManagers()
+{
+  if (m_impl->m_areManagersInitialized) {
+    return;
+  }
+
+  createManagers();
+
+  // apply the management sections of the config, which initializeManagement has skipped
+  nfd::ConfigFile config;
+  setManagersConfigFile(config);
+  config.parse(getConfigSections({"authorizations", "face_system"}), false, "ndnSIM.conf");
+
+  scheduleRibManager();
+}
+
+nfd::ConfigSection
+L3Protocol::getConfigSections(std::initializer_list<std::string> sectionNames)
+{
+  nfd::ConfigSection sections;
+  for (const std::string& sectionName : sectionNames) {
+    auto section = m_impl->m_config.get_child_optional(sectionName);
+    if (section) {
+      sections.add_child(sectionName, *section);
+    }
+  }
+  return sections;
+}
+
+void
+L3Protocol::createManagers()
+{
+  m_impl->m_areManagersInitialized = true;
+
+  auto& keyChain = StackHelper::getKeyChain();
+  auto& forwarder = m_impl->m_forwarder;
+  using namespace nfd;
+
+  NS_LOG_DEBUG("Creating management objects on node " << m_node->GetId());
+
   m_impl->m_fibManager = make_shared<FibManager>(std::ref(forwarder->getFib()),
                                                  bind(&Forwarder::getFace, forwarder.get(), _1),
                                                  m_impl->m_internalFace, keyChain);
@@ -256,30 +357,25 @@ L3Protocol::initializeManagement()
                                                        ref(*forwarder),
                                                        keyChain);
   }
+}
 
-  ConfigFile config((IgnoreSections({"general", "log", "rib", "ndnSIM"})));
-
-  TablesConfigSection tablesConfig(forwarder->getCs(),
-                                   forwarder->getPit(),
-                                   forwarder->getFib(),
-                                   forwarder->getStrategyChoice(),
-                                   forwarder->getMeasurements());
-  tablesConfig.setConfigFile(config);
-
+void
+L3Protocol::setManagersConfigFile(nfd::ConfigFile& config)
+{
   m_impl->m_internalFace->getValidator().setConfigFile(config);
 
-  forwarder->getFaceTable().addReserved(m_impl->m_internalFace, FACEID_INTERNAL_FACE);
-
-  m_impl->m_faceManager->setConfigFile(config);
-
-  // apply config
-  config.parse(m_impl->m_config, false, "ndnSIM.conf");
-
-  tablesConfig.ensureTablesAreConfigured();
+  if (m_impl->m_faceManager != nullptr) {
+    m_impl->m_faceManager->setConfigFile(config);
+  }
+}
 
-  // add FIB entry for NFD Management Protocol
-  shared_ptr<fib::Entry> entry = forwarder->getFib().insert("/localhost/nfd").first;
-  entry->addNextHop(m_impl->m_internalFace, 0);
+void
+L3Protocol::scheduleRibManager()
+{
+  if (this->getConfig().get<bool>("ndnSIM.disable_rib_manager", false)) {
+    return;
+  }
+  Simulator::ScheduleWithContext(m_node->GetId(), Seconds(0), &L3Protocol::initializeRibManager, this);
 }
 
 void
@@ -291,23 +387,11 @@ L3Protocol::initializeRibManager()
   m_impl->m_ribManager = make_shared<rib::RibManager>(*(m_impl->m_face),
                                                       StackHelper::getKeyChain());
 
-  ConfigFile config([] (const std::string& filename, const std::string& sectionName,
-                        const ConfigSection& section, bool isDryRun) {
-      // Ignore "log" and sections belonging to NFD,
-      // but raise an error if we're missing a handler for a "rib" section.
-      if (sectionName != "rib" || sectionName == "log") {
-        // do nothing
-      }
-      else {
-        // missing NRD section
-        ConfigFile::throwErrorOnUnknownSection(filename, sectionName, section, isDryRun);
-      }
-    });
-
+  // initializeManagement has already walked the config and skipped the "rib" section,
+  // so only that section is applied here
+  ConfigFile config;
   m_impl->m_ribManager->setConfigFile(config);
-
-  // apply config
-  config.parse(m_impl->m_config, false, "ndnSIM.conf");
+  config.parse(getConfigSections({"rib"}), false, "ndnSIM.conf");
 
   m_impl->m_ribManager->registerWithNfd();
 
@@ -323,15 +407,23 @@ L3Protocol::getForwarder()
 shared_ptr<nfd::FibManager>
 L3Protocol::getFibManager()
 {
+  initializeManagers();
   return m_impl->m_fibManager;
 }
 
 shared_ptr<nfd::StrategyChoiceManager>
 L3Protocol::getStrategyChoiceManager()
 {
+  initializeManagers();
   return m_impl->m_strategyChoiceManager;
 }
 
+bool
+L3Protocol::isManagementInitialized() const
+{
+  return m_impl->m_areManagersInitialized;
+}
+
 nfd::ConfigSection&
 L3Protocol::getConfig()
 {
@@ -37,6 +37,7 @@ namespace nfd {
 class Forwarder;
 class FibManager;
 class StrategyChoiceManager;
+class ConfigFile;
 typedef boost::property_tree::ptree ConfigSection;
 namespace pit {
 class Entry;
@@ -101,16 +102,28 @@ public:
 
   /**
    * \brief Get smart pointer to nfd::FibManager, used by node's NFD
+   *
+   * Creates management objects if they have not been created yet
    */
   shared_ptr<nfd::FibManager>
   getFibManager();
 
   /**
    * \brief Get smart pointer to nfd::StrategyChoiceManager, used by node's NFD
+   *
+   * Creates management objects if they have not been created yet
    */
   shared_ptr<nfd::StrategyChoiceManager>
   getStrategyChoiceManager();
 
+  /**
+   * \brief Check whether management objects have been created
+   *
+   * Always true unless the stack was installed with StackHelper::enableLazyManagement
+   */
+  bool
+  isManagementInitialized() const;
+
   /**
    * \brief Add face to NDN stack
    *
@@ -179,6 +192,21 @@ private:
   void
   initializeManagement();
 
+  void
+  initializeManagers();
+
+  void
+  createManagers();
+
+  void
+  setManagersConfigFile(nfd::ConfigFile& config);
+
+  nfd::ConfigSection
+  getConfigSections(std::initializer_list<std::string> sectionNames);
+
+  void
+  scheduleRibManager();
+
   void
   initializeRibManager();
 
@@ -23,10 +23,13 @@
 #include "ns3/ndnSIM/helper/ndn-stack-helper.hpp"
 #include "ns3/ndnSIM/helper/ndn-app-helper.hpp"
 #include "ns3/ndnSIM/helper/ndn-global-routing-helper.hpp"
+#include "ns3/ndnSIM/helper/ndn-mpi-helper.hpp"
+#include "ns3/ndnSIM/helper/ndn-cs-snapshot-helper.hpp"
 // #include "ns3/ndnSIM/helper/ndn-ip-faces-helper.hpp"
 // #include "ns3/ndnSIM/helper/ndn-link-control-helper.hpp"
 
 #include "ns3/ndnSIM/utils/topology/annotated-topology-reader.hpp"
+#include "ns3/ndnSIM/utils/topology/topology-partitioner.hpp"
 #include "ns3/ndnSIM/utils/topology/rocketfuel-map-reader.hpp"
 #include "ns3/ndnSIM/utils/topology/rocketfuel-weights-reader.hpp"
 #include "ns3/ndnSIM/utils/tracers/l2-rate-tracer.hpp"
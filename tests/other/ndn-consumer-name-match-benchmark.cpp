@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-consumer-name-match-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <chrono>
+#include <random>
+
+namespace ns3 {
+
+/**
+ * Measures the per-chunk cost of matching received Data packets to the segments that a
+ * MultimediaConsumer has in flight.
+ *
+ * The previous implementation converted every Data name to a URI and compared it with the
+ * concatenated segment URLs; the current one matches the Data name against pre-built segment
+ * names.  Every chunk belongs to one of the segments in flight, chosen at random.
+ *
+ *     ./waf --run "ndn-consumer-name-match-benchmark --chunks=1000000 --in-flight=4"
+ */
+class ConsumerNameMatchBenchmark
+{
+public:
+  ConsumerNameMatchBenchmark()
+    : m_baseUrl("/itec/bbb/")
+    , m_nChunks(1000000)
+    , m_nInFlight(1)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  template<typename MatchFn>
+  double
+  measure(MatchFn match, uint64_t& nMatched);
+
+private:
+  std::string m_baseUrl;
+  uint32_t m_nChunks;
+  uint32_t m_nInFlight;
+
+  std::vector<std::string> m_segmentUrls;     ///< media URIs of the segments in flight
+  std::vector<ndn::Name> m_segmentNames;      ///< the same segments as names
+  std::vector<shared_ptr<ndn::Data>> m_chunks; ///< received chunks, in the order of arrival
+};
+
+template<typename MatchFn>
+double
+ConsumerNameMatchBenchmark::measure(MatchFn match, uint64_t& nMatched)
+{
+  nMatched = 0;
+
+  auto begin = std::chrono::steady_clock::now();
+  for (const shared_ptr<ndn::Data>& data : m_chunks) {
+    if (match(*data)) {
+      ++nMatched;
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double>(end - begin).count();
+}
+
+int
+ConsumerNameMatchBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("chunks", "Number of received Data packets", m_nChunks);
+  cmd.AddValue("in-flight", "Number of segments downloaded at the same time", m_nInFlight);
+  cmd.Parse(argc, argv);
+
+  if (m_nInFlight == 0 || m_nChunks == 0) {
+    std::cerr << "Need at least one segment in flight (--in-flight > 0) and one chunk (--chunks > 0)"
+              << std::endl;
+    return 1;
+  }
+
+  for (uint32_t i = 0; i < m_nInFlight; ++i) {
+    m_segmentUrls.push_back("bunny_2s_8000kbit/bunny_2s" + std::to_string(i + 1) + ".m4s");
+    m_segmentNames.push_back(ndn::Name(m_baseUrl + m_segmentUrls.back()));
+  }
+
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<uint32_t> segmentDist(0, m_nInFlight - 1);
+  for (uint32_t i = 0; i < m_nChunks; ++i) {
+    ndn::Name name = m_segmentNames[segmentDist(rng)];
+    name.appendSequenceNumber(i % 1000);
+    m_chunks.push_back(make_shared<ndn::Data>(name));
+  }
+
+  std::cout << "Implementation\tRealTime(s)\tChunks/s\tns/chunk\tMatched\n";
+
+  uint64_t nMatched = 0;
+  double uriTime = measure([this] (const ndn::Data& data) {
+      std::string interestName = data.getName().toUri();
+      for (const std::string& url : m_segmentUrls) {
+        if (boost::starts_with(interestName, m_baseUrl + url)) {
+          return true;
+        }
+      }
+      return false;
+    }, nMatched);
+  std::cout << "toUri\t" << uriTime << "\t" << m_nChunks / uriTime
+            << "\t" << uriTime * 1e9 / m_nChunks << "\t" << nMatched << "\n";
+
+  double nameTime = measure([this] (const ndn::Data& data) {
+      for (const ndn::Name& name : m_segmentNames) {
+        if (name.isPrefixOf(data.getName())) {
+          return true;
+        }
+      }
+      return false;
+    }, nMatched);
+  std::cout << "isPrefixOf\t" << nameTime << "\t" << m_nChunks / nameTime
+            << "\t" << nameTime * 1e9 / m_nChunks << "\t" << nMatched << "\n";
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::ConsumerNameMatchBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
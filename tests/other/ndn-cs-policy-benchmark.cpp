@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-cs-policy-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <boost/algorithm/string.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+namespace ns3 {
+
+/**
+ * Measures hit ratio and operation rate of the replacement policies of ndnSIM content stores.
+ *
+ * Every request looks up an Interest for one of the catalog items, chosen with a Zipf
+ * distribution, and adds the Data packet on a miss, as a caching router would.  All policies
+ * replay the same sequence of requests.
+ *
+ *     ./waf --run "ndn-cs-policy-benchmark --catalog=100000 --cache=1000 --alpha=0.8"
+ *     ./waf --run "ndn-cs-policy-benchmark --policies=Lfu,BucketLfu"
+ */
+class CsPolicyBenchmark
+{
+public:
+  CsPolicyBenchmark()
+    : m_policies("Lru,Fifo,Random,Lfu,BucketLfu,Lru2")
+    , m_nItems(10000)
+    , m_cacheSize(100)
+    , m_alpha(0.8)
+    , m_nRequests(1000000)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  /**
+   * @brief Indexes of the requested items, following Zipf distribution with parameter m_alpha
+   */
+  std::vector<uint32_t>
+  generateRequests() const;
+
+private:
+  std::string m_policies;
+  uint32_t m_nItems;
+  uint32_t m_cacheSize;
+  double m_alpha;
+  uint32_t m_nRequests;
+};
+
+std::vector<uint32_t>
+CsPolicyBenchmark::generateRequests() const
+{
+  std::vector<double> cdf(m_nItems);
+  double sum = 0;
+  for (uint32_t i = 0; i < m_nItems; ++i) {
+    sum += 1.0 / std::pow(i + 1, m_alpha);
+    cdf[i] = sum;
+  }
+
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<double> uniform(0, sum);
+  std::vector<uint32_t> requests(m_nRequests);
+  for (uint32_t& request : requests) {
+    request = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+    request = std::min(request, m_nItems - 1);
+  }
+  return requests;
+}
+
+int
+CsPolicyBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("policies", "Comma-separated list of ns3::ndn::cs:: content stores", m_policies);
+  cmd.AddValue("catalog", "Number of distinct Data packets", m_nItems);
+  cmd.AddValue("cache", "Content store size in packets", m_cacheSize);
+  cmd.AddValue("alpha", "Parameter of Zipf distribution of requests", m_alpha);
+  cmd.AddValue("requests", "Number of requests", m_nRequests);
+  cmd.Parse(argc, argv);
+
+  std::vector<shared_ptr<Interest>> interests;
+  std::vector<shared_ptr<Data>> data;
+  for (uint32_t i = 0; i < m_nItems; ++i) {
+    Name name("/benchmark/cs");
+    name.appendNumber(i);
+    interests.push_back(make_shared<Interest>(name));
+    data.push_back(make_shared<Data>(name));
+  }
+  std::vector<uint32_t> requests = generateRequests();
+
+  std::vector<std::string> policies;
+  boost::split(policies, m_policies, boost::is_any_of(","));
+
+  std::cout << "Policy\tHitRatio\tOps/s\n";
+  for (const std::string& policy : policies) {
+    ObjectFactory factory("ns3::ndn::cs::" + policy);
+    factory.Set("MaxSize", UintegerValue(m_cacheSize));
+    Ptr<ndn::ContentStore> cs = factory.Create<ndn::ContentStore>();
+
+    size_t nHits = 0;
+    auto begin = std::chrono::steady_clock::now();
+    for (uint32_t request : requests) {
+      if (cs->Lookup(interests[request]) != nullptr) {
+        ++nHits;
+      }
+      else {
+        cs->Add(data[request]);
+      }
+    }
+    double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    std::cout << policy << "\t" << static_cast<double>(nHits) / requests.size() << "\t"
+              << requests.size() / time << "\n";
+  }
+
+  Simulator::Destroy();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::CsPolicyBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-cs-trie-memory.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/utils/trie/trie-with-policy.hpp"
+#include "ns3/ndnSIM/utils/trie/lru-policy.hpp"
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+
+#include <chrono>
+
+namespace ns3 {
+
+/**
+ * Measures memory per entry and lookup rate of the tries used by ndnSIM content stores.
+ *
+ * The trie is filled with names of DASH segment chunks,
+ * /prefix/video/bunny_2s_1500kbit/bunny_2s<segment>.m4s/<chunk>, and every name is then
+ * looked up once.  Names are created before measuring, so only the memory of the trie itself
+ * is reported.  The resident size of a process rarely shrinks, so every run measures one trie:
+ *
+ *     ./waf --run "ndn-cs-trie-memory --trie=compressed --entries=1000000"
+ *     ./waf --run "ndn-cs-trie-memory --trie=trie --entries=1000000"
+ */
+class CsTrieMemoryBenchmark
+{
+public:
+  CsTrieMemoryBenchmark()
+    : m_trie("compressed")
+    , m_nEntries(1000000)
+    , m_nChunksPerSegment(100)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  template<template<typename, typename, typename> class Trie>
+  void
+  measure(const std::vector<Name>& names);
+
+private:
+  std::string m_trie;
+  uint32_t m_nEntries;
+  uint32_t m_nChunksPerSegment;
+};
+
+template<template<typename, typename, typename> class Trie>
+void
+CsTrieMemoryBenchmark::measure(const std::vector<Name>& names)
+{
+  // the payload is not owned by the trie, any non-null pointer will do
+  typedef ndnSIM::trie_with_policy<Name, ndnSIM::pointer_payload_traits<const Name>,
+                                   ndnSIM::lru_policy_traits, Trie> Cache;
+
+  int64_t memBefore = MemUsage::Get();
+  auto begin = std::chrono::steady_clock::now();
+  std::unique_ptr<Cache> cache(new Cache);
+  cache->getPolicy().set_max_size(0); // unlimited
+  for (const Name& name : names) {
+    cache->insert(name, &name);
+  }
+  double insertTime =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+  int64_t memTrie = MemUsage::Get() - memBefore;
+
+  size_t nFound = 0;
+  begin = std::chrono::steady_clock::now();
+  for (const Name& name : names) {
+    nFound += cache->find_exact(name) != cache->end();
+  }
+  double lookupTime =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  std::cout << "Trie\tEntries\tBytes/entry\tInserts/s\tLookups/s\tFound\n";
+  std::cout << m_trie << "\t" << names.size() << "\t"
+            << static_cast<double>(memTrie) / names.size() << "\t" << names.size() / insertTime
+            << "\t" << names.size() / lookupTime << "\t" << nFound << "\n";
+}
+
+int
+CsTrieMemoryBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("trie", "Trie implementation: compressed or trie", m_trie);
+  cmd.AddValue("entries", "Number of cached chunks", m_nEntries);
+  cmd.AddValue("chunks", "Number of chunks per DASH segment", m_nChunksPerSegment);
+  cmd.Parse(argc, argv);
+
+  std::vector<Name> names;
+  names.reserve(m_nEntries);
+  Name representation("/prefix/video/bunny_2s_1500kbit");
+  for (uint32_t i = 0; i < m_nEntries; ++i) {
+    Name name(representation);
+    name.append(ndn::name::Component("bunny_2s" + std::to_string(i / m_nChunksPerSegment)
+                                     + ".m4s"));
+    name.appendNumber(i % m_nChunksPerSegment);
+    names.push_back(name);
+  }
+
+  if (m_trie == "compressed") {
+    measure<ndnSIM::compressed_trie>(names);
+  }
+  else if (m_trie == "trie") {
+    measure<ndnSIM::trie>(names);
+  }
+  else {
+    std::cerr << "Unknown trie " << m_trie << std::endl;
+    return 1;
+  }
+
+  Simulator::Destroy();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::CsTrieMemoryBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
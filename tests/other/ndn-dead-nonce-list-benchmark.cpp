@@ -0,0 +1,166 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-dead-nonce-list-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/table/dead-nonce-list.hpp"
+#include "ns3/ndnSIM/NFD/core/city-hash.hpp"
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/identity.hpp>
+
+#include <chrono>
+#include <random>
+
+namespace ns3 {
+
+// index of the previous DeadNonceList implementation
+typedef boost::multi_index_container<
+  uint64_t,
+  boost::multi_index::indexed_by<
+    boost::multi_index::sequenced<>,
+    boost::multi_index::hashed_non_unique<boost::multi_index::identity<uint64_t>>
+  >
+> LegacyIndex;
+
+static uint64_t
+makeLegacyEntry(const Name& name, uint32_t nonce)
+{
+  Block nameWire = name.wireEncode();
+  return CityHash64WithSeed(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size(),
+                            static_cast<uint64_t>(nonce));
+}
+
+/**
+ * Measures memory per entry and lookup rate of nfd::DeadNonceList.
+ *
+ * Nonces are added at a constant rate for a number of lifetimes, so that the list adapts its
+ * capacity to the requested number of entries.  The same number of hashes is then inserted
+ * into the index used by the previous implementation for comparison.
+ *
+ *     ./waf --run "ndn-dead-nonce-list-benchmark --entries=1000000 --lookups=10000000"
+ */
+class DeadNonceListBenchmark
+{
+public:
+  DeadNonceListBenchmark()
+    : m_nEntries(100000)
+    , m_nLookups(10000000)
+    , m_nLifetimes(60)
+    , m_name("/benchmark/dead-nonce-list")
+    , m_lastNonce(0)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  void
+  addBatch(nfd::DeadNonceList* dnl, size_t batchSize, Time interval);
+
+private:
+  uint32_t m_nEntries;
+  uint32_t m_nLookups;
+  uint32_t m_nLifetimes;
+  Name m_name;
+  uint32_t m_lastNonce;
+};
+
+void
+DeadNonceListBenchmark::addBatch(nfd::DeadNonceList* dnl, size_t batchSize, Time interval)
+{
+  for (size_t i = 0; i < batchSize; ++i) {
+    dnl->add(m_name, ++m_lastNonce);
+  }
+  Simulator::Schedule(interval, &DeadNonceListBenchmark::addBatch, this, dnl, batchSize, interval);
+}
+
+int
+DeadNonceListBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("entries", "Number of Nonces added per lifetime", m_nEntries);
+  cmd.AddValue("lookups", "Number of lookups", m_nLookups);
+  cmd.AddValue("lifetimes", "Number of lifetimes to simulate before measuring", m_nLifetimes);
+  cmd.Parse(argc, argv);
+
+  const size_t nBatchesPerLifetime = 50;
+  const Time lifetime = Seconds(6);
+
+  int64_t memBefore = MemUsage::Get();
+  std::unique_ptr<nfd::DeadNonceList> dnl(new nfd::DeadNonceList);
+  Simulator::ScheduleNow(&DeadNonceListBenchmark::addBatch, this, dnl.get(),
+                         m_nEntries / nBatchesPerLifetime, lifetime / nBatchesPerLifetime);
+  Simulator::Stop(lifetime * m_nLifetimes);
+  Simulator::Run();
+  int64_t memDnl = MemUsage::Get() - memBefore;
+  size_t nStored = dnl->size();
+
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<uint32_t> nonceDist(1, m_lastNonce * 2);
+  size_t nFound = 0;
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < m_nLookups; ++i) {
+    nFound += dnl->has(m_name, nonceDist(rng));
+  }
+  double dnlTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  std::cout << "Implementation\tEntries\tBytes/entry\tLookups/s\tFound\n";
+  std::cout << "ring+table\t" << nStored << "\t" << static_cast<double>(memDnl) / nStored
+            << "\t" << m_nLookups / dnlTime << "\t" << nFound << "\n";
+
+  Simulator::Destroy();
+  dnl.reset();
+
+  memBefore = MemUsage::Get();
+  LegacyIndex legacy;
+  for (size_t i = 0; i < nStored; ++i) {
+    legacy.push_back(makeLegacyEntry(m_name, m_lastNonce - i));
+  }
+  int64_t memLegacy = MemUsage::Get() - memBefore;
+
+  nFound = 0;
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < m_nLookups; ++i) {
+    nFound += legacy.get<1>().count(makeLegacyEntry(m_name, nonceDist(rng)));
+  }
+  double legacyTime =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  std::cout << "multi_index\t" << nStored << "\t" << static_cast<double>(memLegacy) / nStored
+            << "\t" << m_nLookups / legacyTime << "\t" << nFound << "\n";
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::DeadNonceListBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
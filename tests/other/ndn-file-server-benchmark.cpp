@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-file-server-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/apps/ndn-fake-fileserver.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <random>
+
+namespace ns3 {
+
+/**
+ * Measures how many chunk Interests per second a FakeFileServer answers.
+ *
+ * The server is given a catalog of equally sized virtual files, and Interests for random chunks
+ * of random files are passed to its OnInterest() directly, so that the rate does not depend on
+ * the links.  Only the public interface of the server is used, so the same program can measure
+ * earlier revisions of the server.
+ *
+ *     ./waf --run "ndn-file-server-benchmark --files=1000 --file-size=1000000 --interests=1000000"
+ */
+class FileServerBenchmark
+{
+public:
+  FileServerBenchmark()
+    : m_nFiles(1000)
+    , m_fileSize(1000000)
+    , m_nInterests(1000000)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  void
+  measure(Ptr<ndn::FakeFileServer> server);
+
+private:
+  uint32_t m_nFiles;
+  uint32_t m_fileSize;
+  uint32_t m_nInterests;
+};
+
+void
+FileServerBenchmark::measure(Ptr<ndn::FakeFileServer> server)
+{
+  // chunks carry less than the MTU of 1500 bytes, so all of these chunks exist
+  uint32_t nChunks = m_fileSize / 1500;
+
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<uint32_t> fileDist(0, m_nFiles - 1);
+  std::uniform_int_distribution<uint32_t> chunkDist(1, std::max<uint32_t>(nChunks, 1));
+
+  std::vector<shared_ptr<ndn::Interest>> interests;
+  interests.reserve(m_nInterests);
+  for (uint32_t i = 0; i < m_nInterests; ++i) {
+    Name name("/bench");
+    name.append("file" + std::to_string(fileDist(rng)));
+    name.appendSequenceNumber(chunkDist(rng));
+    interests.push_back(make_shared<ndn::Interest>(name));
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  for (const shared_ptr<ndn::Interest>& interest : interests) {
+    server->OnInterest(interest);
+  }
+  double wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  std::cout << "Files\tFileSize\tInterests\tSeconds\tInterests/s\n";
+  std::cout << m_nFiles << "\t" << m_fileSize << "\t" << m_nInterests << "\t" << wallTime << "\t"
+            << m_nInterests / wallTime << "\n";
+}
+
+int
+FileServerBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("files", "Number of files served", m_nFiles);
+  cmd.AddValue("file-size", "Size of every file in bytes", m_fileSize);
+  cmd.AddValue("interests", "Number of chunk Interests", m_nInterests);
+  cmd.Parse(argc, argv);
+
+  std::string metaDataFile = "ndn-file-server-benchmark.csv";
+  std::ofstream csv(metaDataFile.c_str());
+  for (uint32_t i = 0; i < m_nFiles; ++i) {
+    csv << "file" << i << "," << m_fileSize << "\n";
+  }
+  csv.close();
+
+  NodeContainer nodes;
+  nodes.Create(2);
+
+  PointToPointHelper p2p;
+  p2p.Install(nodes.Get(0), nodes.Get(1));
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  ndn::AppHelper serverHelper("ns3::ndn::FakeFileServer");
+  serverHelper.SetPrefix("/bench");
+  serverHelper.SetAttribute("MetaDataFile", StringValue(metaDataFile));
+  ApplicationContainer apps = serverHelper.Install(nodes.Get(1));
+  Ptr<ndn::FakeFileServer> server = DynamicCast<ndn::FakeFileServer>(apps.Get(0));
+
+  Simulator::Schedule(Seconds(1.0), &FileServerBenchmark::measure, this, server);
+  Simulator::Stop(Seconds(2.0));
+  Simulator::Run();
+  Simulator::Destroy();
+
+  std::remove(metaDataFile.c_str());
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::FileServerBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
@@ -0,0 +1,111 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-name-interning-memory.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/point-to-point-layout-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/core/name-interner.hpp"
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+
+namespace ns3 {
+
+/**
+ * Reports the memory used by FIBs populated with global routing, with and without
+ * name interning.
+ *
+ * Every node of a --size x --size grid announces its own prefix, so after
+ * CalculateRoutes every node has a FIB entry (and a name tree entry) for the prefix of
+ * every other node.  With interning, the FIB entries of all forwarders share one instance
+ * of each prefix; name tree entries keep their own copy.
+ *
+ *     ./waf --run "ndn-name-interning-memory --size=40 --intern=0"
+ *     ./waf --run "ndn-name-interning-memory --size=40 --intern=1"
+ */
+class NameInterningMemoryReport
+{
+public:
+  NameInterningMemoryReport()
+    : m_size(30)
+    , m_isInterning(true)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  uint32_t m_size;
+  bool m_isInterning;
+};
+
+int
+NameInterningMemoryReport::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("size", "Grid size; the topology has size*size nodes", m_size);
+  cmd.AddValue("intern", "Share prefixes among all forwarders", m_isInterning);
+  cmd.Parse(argc, argv);
+
+  nfd::setNameInterning(m_isInterning);
+
+  PointToPointHelper p2p;
+  PointToPointGridHelper grid(m_size, m_size, p2p);
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    ndnGlobalRoutingHelper.AddOrigin(Name("/node").appendNumber((*node)->GetId()).toUri(),
+                                     *node);
+  }
+
+  int64_t before = MemUsage::Get();
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+  int64_t routesSize = MemUsage::Get() - before;
+
+  size_t nFibEntries = 0;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    nFibEntries += (*node)->GetObject<ndn::L3Protocol>()->getForwarder()->getFib().size();
+  }
+
+  std::cout << "Interning\tNodes\tFibEntries\tInternedNames\tRoutesBytes\tBytes/FibEntry\n";
+  std::cout << (m_isInterning ? "on" : "off") << "\t" << NodeList::GetNNodes() << "\t"
+            << nFibEntries << "\t" << nfd::getNInternedNames() << "\t" << routesSize << "\t"
+            << static_cast<double>(routesSize) / nFibEntries << "\n";
+
+  Simulator::Destroy();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::NameInterningMemoryReport report;
+  return report.run(argc, argv);
+}
@@ -0,0 +1,169 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-route-reconvergence.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/point-to-point-layout-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <chrono>
+#include <random>
+
+namespace ns3 {
+
+/**
+ * Compares the time to reconverge FIBs after a link failure or recovery with
+ * GlobalRoutingHelper::RecalculateRoutes against the time of a full CalculateRoutes without
+ * incremental updates (Dijkstra from every node), which is what a scenario had to run after
+ * every link change before.
+ *
+ * Every node of a --size x --size grid announces its own prefix.  After the initial
+ * calculation, --flaps random links are failed and brought up again, one at a time, and routes
+ * are recalculated after every change.
+ *
+ *     for size in 10 20 30 40; do ./waf --run "ndn-route-reconvergence --size=$size"; done
+ */
+class RouteReconvergenceBenchmark
+{
+public:
+  RouteReconvergenceBenchmark()
+    : m_size(20)
+    , m_nFlaps(100)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  typedef std::chrono::duration<double, std::milli> Milliseconds;
+
+  template<typename F>
+  static double
+  measure(const F& f)
+  {
+    auto begin = std::chrono::steady_clock::now();
+    f();
+    return Milliseconds(std::chrono::steady_clock::now() - begin).count();
+  }
+
+private:
+  uint32_t m_size;
+  uint32_t m_nFlaps;
+};
+
+/**
+ * Remove the routes installed by CalculateRoutes from all FIBs
+ */
+static void
+eraseNodeRoutes()
+{
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    nfd::Fib& fib = (*node)->GetObject<ndn::L3Protocol>()->getForwarder()->getFib();
+    std::vector<Name> prefixes;
+    for (const nfd::fib::Entry& entry : fib) {
+      if (Name("/node").isPrefixOf(entry.getPrefix())) {
+        prefixes.push_back(entry.getPrefix());
+      }
+    }
+    for (const Name& prefix : prefixes) {
+      fib.erase(prefix);
+    }
+  }
+}
+
+int
+RouteReconvergenceBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("size", "Grid size; the topology has size*size nodes", m_size);
+  cmd.AddValue("flaps", "Number of link failures (each followed by a recovery)", m_nFlaps);
+  cmd.Parse(argc, argv);
+
+  PointToPointHelper p2p;
+  PointToPointGridHelper grid(m_size, m_size, p2p);
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    ndnGlobalRoutingHelper.AddOrigin(Name("/node").appendNumber((*node)->GetId()).toUri(),
+                                     *node);
+  }
+
+  std::vector<std::pair<Ptr<Node>, Ptr<Node>>> links;
+  for (ChannelList::Iterator channel = ChannelList::Begin(); channel != ChannelList::End();
+       channel++) {
+    if ((*channel)->GetNDevices() == 2) {
+      links.push_back(std::make_pair((*channel)->GetDevice(0)->GetNode(),
+                                     (*channel)->GetDevice(1)->GetNode()));
+    }
+  }
+
+  if (links.empty() || m_nFlaps == 0) {
+    std::cerr << "Need at least one link (--size > 1) and one flap (--flaps > 0)" << std::endl;
+    Simulator::Destroy();
+    return 1;
+  }
+
+  // the full calculation is the legacy one, then the FIBs are populated again with
+  // incremental updates enabled, which keeps the shortest path trees for RecalculateRoutes
+  ndn::GlobalRoutingHelper::EnableIncrementalUpdates(false);
+  double fullTime = measure(&ndn::GlobalRoutingHelper::CalculateRoutes);
+  eraseNodeRoutes();
+
+  ndn::GlobalRoutingHelper::EnableIncrementalUpdates();
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+
+  std::mt19937 random(1);
+  double failTime = 0;
+  double upTime = 0;
+  for (uint32_t i = 0; i < m_nFlaps; i++) {
+    const auto& link = links[random() % links.size()];
+
+    ndn::LinkControlHelper::FailLink(link.first, link.second);
+    failTime += measure(&ndn::GlobalRoutingHelper::RecalculateRoutes);
+
+    ndn::LinkControlHelper::UpLink(link.first, link.second);
+    upTime += measure(&ndn::GlobalRoutingHelper::RecalculateRoutes);
+  }
+
+  std::cout << "Nodes\tLinks\tFull(ms)\tAfterFailure(ms)\tAfterRecovery(ms)\tSpeedup\n";
+  std::cout << NodeList::GetNNodes() << "\t" << links.size() << "\t" << fullTime << "\t"
+            << failTime / m_nFlaps << "\t" << upTime / m_nFlaps << "\t"
+            << fullTime * 2 * m_nFlaps / (failTime + upTime) << "\n";
+
+  Simulator::Destroy();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::RouteReconvergenceBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
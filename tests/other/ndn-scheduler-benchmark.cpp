@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-scheduler-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/core/scheduler.hpp"
+
+#include <chrono>
+#include <random>
+
+namespace ns3 {
+
+/// @cond include_hidden
+
+template<>
+struct EventMemberImplObjTraits<std::function<void()>> {
+  typedef std::function<void()> T;
+  static T&
+  GetReference(T& p)
+  {
+    return p;
+  }
+};
+
+/// @endcond
+
+// the previous nfd::scheduler implementation
+namespace legacy {
+
+typedef std::shared_ptr<ns3::EventId> EventId;
+
+EventId
+schedule(const nfd::time::nanoseconds& after, const std::function<void()>& event)
+{
+  ns3::EventId id = Simulator::Schedule(NanoSeconds(after.count()),
+                                        &std::function<void()>::operator(), event);
+  return std::make_shared<ns3::EventId>(id);
+}
+
+void
+cancel(EventId& eventId)
+{
+  if (eventId != nullptr) {
+    Simulator::Remove(*eventId);
+    eventId.reset();
+  }
+}
+
+} // namespace legacy
+
+/**
+ * Measures schedule+cancel throughput of nfd::scheduler against the previous implementation,
+ * which allocated a shared_ptr<EventId> per event and cancelled through Simulator::Remove.
+ *
+ * The workload resembles PIT timers: every event is scheduled within a window of pending events,
+ * and most of them are cancelled before they fire.
+ *
+ *     ./waf --run "ndn-scheduler-benchmark --events=1000000 --cancel-ratio=0.9"
+ */
+class SchedulerBenchmark
+{
+public:
+  SchedulerBenchmark()
+    : m_nEvents(1000000)
+    , m_cancelRatio(0.9)
+    , m_window(10000)
+    , m_nFired(0)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  template<typename EventId, typename ScheduleFn, typename CancelFn>
+  double
+  measure(ScheduleFn schedule, CancelFn cancel);
+
+  void
+  onEvent()
+  {
+    ++m_nFired;
+  }
+
+private:
+  uint32_t m_nEvents;
+  double m_cancelRatio;
+  uint32_t m_window;
+  uint64_t m_nFired;
+};
+
+template<typename EventId, typename ScheduleFn, typename CancelFn>
+double
+SchedulerBenchmark::measure(ScheduleFn schedule, CancelFn cancel)
+{
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> delayDist(1000, 4000);
+  std::bernoulli_distribution shouldCancel(m_cancelRatio);
+
+  std::vector<EventId> window(m_window);
+  std::vector<bool> isCancellable(m_window);
+  m_nFired = 0;
+
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < m_nEvents; ++i) {
+    size_t slot = i % m_window;
+    if (isCancellable[slot]) {
+      cancel(window[slot]);
+    }
+    window[slot] = schedule(nfd::time::milliseconds(delayDist(rng)),
+                            std::bind(&SchedulerBenchmark::onEvent, this));
+    isCancellable[slot] = shouldCancel(rng);
+  }
+  Simulator::Run();
+  auto end = std::chrono::steady_clock::now();
+
+  Simulator::Destroy();
+  return std::chrono::duration<double>(end - begin).count();
+}
+
+int
+SchedulerBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("events", "Number of scheduled events", m_nEvents);
+  cmd.AddValue("cancel-ratio", "Fraction of events cancelled before they fire", m_cancelRatio);
+  cmd.AddValue("window", "Number of events pending at the same time", m_window);
+  cmd.Parse(argc, argv);
+
+  std::cout << "Implementation\tRealTime(s)\tEvents/s\tFired\n";
+
+  double legacyTime = measure<legacy::EventId>(&legacy::schedule, &legacy::cancel);
+  std::cout << "legacy\t" << legacyTime << "\t" << m_nEvents / legacyTime
+            << "\t" << m_nFired << "\n";
+
+  double pooledTime = measure<nfd::scheduler::EventId>(&nfd::scheduler::schedule,
+                                                       &nfd::scheduler::cancel);
+  std::cout << "pooled\t" << pooledTime << "\t" << m_nEvents / pooledTime
+            << "\t" << m_nFired << "\n";
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::SchedulerBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
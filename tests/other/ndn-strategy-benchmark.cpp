@@ -0,0 +1,253 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-strategy-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/measurements-arena.hpp"
+
+#include <chrono>
+
+namespace ns3 {
+
+/**
+ * Measures the Interest forwarding rate of a strategy on a high fan-out router.
+ *
+ *   consumer_0 ..                   .. producer_0
+ *                 \               /
+ *   consumer_i ---- ( router ) ---- producer_j
+ *                 /               \
+ *   consumer_N ..                   .. producer_M
+ *
+ * Every consumer requests its own prefix under /bench, and every producer serves /bench,
+ * so the router keeps per-prefix measurements for each consumer and chooses among
+ * all producers.  The simulated traffic does not depend on the strategy implementation,
+ * so the wall-clock rate reported here can be compared across revisions.
+ *
+ * Before the simulation, the per-prefix measurement access pattern of the strategies is
+ * replayed on one Measurements entry per consumer, once with the measurements stored as
+ * StrategyInfo on each entry (as the strategies did before MeasurementsArena) and once in a
+ * MeasurementsArena, and both rates are printed side by side.
+ *
+ *     ./waf --run "ndn-strategy-benchmark --strategy=ncc --consumers=100 --producers=32"
+ *     ./waf --run "ndn-strategy-benchmark --strategy=access --consumers=100 --producers=32"
+ */
+class StrategyBenchmark
+{
+public:
+  StrategyBenchmark()
+    : m_strategy("ncc")
+    , m_nConsumers(100)
+    , m_nProducers(32)
+    , m_frequency(1000)
+    , m_duration(10)
+    , m_nRounds(10000)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  void
+  compareMeasurementsStorage();
+
+private:
+  std::string m_strategy;
+  uint32_t m_nConsumers;
+  uint32_t m_nProducers;
+  double m_frequency;
+  double m_duration;
+  uint32_t m_nRounds;
+};
+
+namespace {
+
+/// per-prefix measurements, similar in size to AccessStrategy::MtInfo
+struct PrefixMeasurements
+{
+  PrefixMeasurements()
+    : lastNexthop(0)
+    , nSamples(0)
+    , rtt(0)
+  {
+  }
+
+  uint64_t lastNexthop;
+  uint64_t nSamples;
+  double rtt;
+};
+
+/// the same measurements placed on measurements::Entry as StrategyInfo
+class PrefixMeasurementsInfo : public nfd::fw::StrategyInfo, public PrefixMeasurements
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 9000;
+  }
+};
+
+void
+updateMeasurements(PrefixMeasurements& m, uint64_t nexthop)
+{
+  m.lastNexthop = nexthop;
+  ++m.nSamples;
+  m.rtt += (nexthop - m.rtt) / m.nSamples;
+}
+
+} // namespace
+
+void
+StrategyBenchmark::compareMeasurementsStorage()
+{
+  nfd::NameTree nameTree;
+  nfd::Measurements measurements(nameTree);
+  std::vector<std::shared_ptr<nfd::measurements::Entry>> entries;
+  for (uint32_t i = 0; i < m_nConsumers; ++i) {
+    entries.push_back(measurements.get(Name("/bench").appendNumber(i)));
+  }
+
+  // each round looks up (creating on first use) and updates measurements of every prefix
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t round = 0; round < m_nRounds; ++round) {
+    for (const auto& entry : entries) {
+      updateMeasurements(*entry->getOrCreateStrategyInfo<PrefixMeasurementsInfo>(), round);
+    }
+  }
+  double strategyInfoTime =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  nfd::MeasurementsArena<PrefixMeasurements> arena;
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t round = 0; round < m_nRounds; ++round) {
+    for (const auto& entry : entries) {
+      updateMeasurements(*arena.insert(*entry).first, round);
+    }
+  }
+  double arenaTime =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  double nLookups = static_cast<double>(m_nRounds) * entries.size();
+  std::cout << "Prefixes\tLookups\tStrategyInfo lookups/s\tArena lookups/s\tSpeedup\n";
+  std::cout << entries.size() << "\t" << nLookups << "\t"
+            << nLookups / strategyInfoTime << "\t" << nLookups / arenaTime << "\t"
+            << strategyInfoTime / arenaTime << "\n\n";
+}
+
+int
+StrategyBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("strategy", "Strategy on the router: ncc or access", m_strategy);
+  cmd.AddValue("consumers", "Number of consumers, each with its own prefix", m_nConsumers);
+  cmd.AddValue("producers", "Number of producers, i.e. nexthops of the router", m_nProducers);
+  cmd.AddValue("frequency", "Interests per second sent by each consumer", m_frequency);
+  cmd.AddValue("duration", "Simulated seconds", m_duration);
+  cmd.AddValue("rounds", "Rounds of the measurements storage comparison", m_nRounds);
+  cmd.Parse(argc, argv);
+
+  Name strategyName;
+  if (m_strategy == "ncc") {
+    strategyName = "/localhost/nfd/strategy/ncc";
+  }
+  else if (m_strategy == "access") {
+    strategyName = "/localhost/nfd/strategy/access";
+  }
+  else {
+    std::cerr << "Unknown strategy " << m_strategy << std::endl;
+    return 1;
+  }
+
+  this->compareMeasurementsStorage();
+
+  Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Gbps"));
+  Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+  Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("1000"));
+
+  Ptr<Node> router = CreateObject<Node>();
+  NodeContainer consumers;
+  consumers.Create(m_nConsumers);
+  NodeContainer producers;
+  producers.Create(m_nProducers);
+
+  PointToPointHelper p2p;
+  for (NodeContainer::Iterator i = consumers.Begin(); i != consumers.End(); ++i) {
+    p2p.Install(*i, router);
+  }
+  for (NodeContainer::Iterator i = producers.Begin(); i != producers.End(); ++i) {
+    p2p.Install(router, *i);
+  }
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  ndn::StrategyChoiceHelper::Install(router, "/bench", strategyName);
+
+  const Name prefix("/bench");
+  for (NodeContainer::Iterator i = consumers.Begin(); i != consumers.End(); ++i) {
+    ndn::FibHelper::AddRoute(*i, prefix, router, 1);
+  }
+  for (NodeContainer::Iterator i = producers.Begin(); i != producers.End(); ++i) {
+    ndn::FibHelper::AddRoute(router, prefix, *i, 1);
+  }
+
+  ndn::AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetAttribute("Frequency", DoubleValue(m_frequency));
+  for (uint32_t i = 0; i < m_nConsumers; ++i) {
+    consumerHelper.SetPrefix(Name(prefix).appendNumber(i).toUri());
+    consumerHelper.Install(consumers.Get(i));
+  }
+
+  ndn::AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetPrefix(prefix.toUri());
+  producerHelper.SetAttribute("PayloadSize", StringValue("100"));
+  producerHelper.Install(producers);
+
+  Simulator::Stop(Seconds(m_duration));
+  auto begin = std::chrono::steady_clock::now();
+  Simulator::Run();
+  double wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  const nfd::ForwarderCounters& counters =
+    router->GetObject<ndn::L3Protocol>()->getForwarder()->getCounters();
+  uint64_t nInInterests = counters.getNInInterests();
+
+  std::cout << "Strategy\tConsumers\tProducers\tInterests\tSeconds\tInterests/s\n";
+  std::cout << m_strategy << "\t" << m_nConsumers << "\t" << m_nProducers << "\t"
+            << nInInterests << "\t" << wallTime << "\t" << nInInterests / wallTime << "\n";
+
+  Simulator::Destroy();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::StrategyBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
@@ -0,0 +1,124 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-strategy-memory.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/strategy-registry.hpp"
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+
+#include <chrono>
+
+namespace ns3 {
+
+/**
+ * Reports the per-node memory of the NDN stack and of every registered strategy.
+ *
+ * The stack is installed on --nodes unconnected nodes.  Strategies are instantiated only
+ * when a prefix selects them, so the baseline contains only the default strategy; with
+ * --eager, all registered strategies are installed on every node, as NFD does at startup.
+ * Then every registered strategy is selected for its own prefix on all nodes; the growth of
+ * the resident set, less the growth caused by a strategy choice entry alone, is the cost of
+ * one instance of the strategy.
+ *
+ *     ./waf --run "ndn-strategy-memory --nodes=5000"
+ *     ./waf --run "ndn-strategy-memory --nodes=5000 --eager=1"
+ */
+class StrategyMemoryReport
+{
+public:
+  StrategyMemoryReport()
+    : m_nNodes(5000)
+    , m_isEager(false)
+  {
+  }
+
+  int
+  run(int argc, char* argv[]);
+
+private:
+  /// per-node growth of the resident set since @p before, in bytes
+  double
+  perNode(int64_t before) const;
+
+private:
+  uint32_t m_nNodes;
+  bool m_isEager;
+};
+
+double
+StrategyMemoryReport::perNode(int64_t before) const
+{
+  return static_cast<double>(MemUsage::Get() - before) / m_nNodes;
+}
+
+int
+StrategyMemoryReport::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("nodes", "Number of nodes", m_nNodes);
+  cmd.AddValue("eager", "Install all registered strategies on every node", m_isEager);
+  cmd.Parse(argc, argv);
+
+  NodeContainer nodes;
+  nodes.Create(m_nNodes);
+
+  int64_t before = MemUsage::Get();
+  auto begin = std::chrono::steady_clock::now();
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+  if (m_isEager) {
+    for (NodeContainer::Iterator i = nodes.Begin(); i != nodes.End(); ++i) {
+      nfd::fw::installStrategies(*(*i)->GetObject<ndn::L3Protocol>()->getForwarder());
+    }
+  }
+
+  std::chrono::duration<double> startupTime = std::chrono::steady_clock::now() - begin;
+  std::cout << "Stack\t" << (m_isEager ? "eager" : "lazy") << "\t" << m_nNodes << " nodes\t"
+            << startupTime.count() << " s\t" << perNode(before) << " bytes/node\n";
+
+  // cost of a strategy choice entry for an already installed strategy
+  before = MemUsage::Get();
+  ndn::StrategyChoiceHelper::InstallAll("/memory/default", "/localhost/nfd/strategy/best-route");
+  double entryCost = perNode(before);
+
+  std::cout << "Strategy\tBytes/node\n";
+  uint32_t index = 0;
+  for (const Name& strategyName : nfd::fw::listRegisteredStrategies()) {
+    before = MemUsage::Get();
+    ndn::StrategyChoiceHelper::InstallAll(Name("/memory").appendNumber(index++), strategyName);
+    std::cout << strategyName << "\t" << perNode(before) - entryCost << "\n";
+  }
+
+  Simulator::Destroy();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::StrategyMemoryReport report;
+  return report.run(argc, argv);
+}
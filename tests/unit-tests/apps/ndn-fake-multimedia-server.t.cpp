@@ -0,0 +1,196 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "apps/ndn-fake-multimedia-server.hpp"
+
+#include "../tests-common.hpp"
+
+#include "ns3/net-device.h"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * \brief FakeMultimediaServer which lets the tests parse segment names directly
+ */
+class SegmentNameServer : public FakeMultimediaServer
+{
+public:
+  static TypeId
+  GetTypeId()
+  {
+    static TypeId tid = TypeId("ns3::ndn::SegmentNameServer")
+      .SetGroupName("Ndn")
+      .SetParent<FakeMultimediaServer>()
+      .AddConstructor<SegmentNameServer>();
+    return tid;
+  }
+
+  bool
+  parse(const std::string& segmentName, uint32_t& repIndex, uint32_t& segmentNr) const
+  {
+    return ParseSegmentName(segmentName.data(), segmentName.data() + segmentName.size(), repIndex,
+                            segmentNr);
+  }
+
+  FileCatalogEntry
+  getSegmentEntry(const Name& interestName)
+  {
+    FileCatalogEntry file;
+    GetSegmentEntry(interestName, file);
+    return file;
+  }
+};
+
+class FakeMultimediaServerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  FakeMultimediaServerFixture()
+    : m_metaDataFile(boost::filesystem::path(TEST_CONFIG_PATH) / "fake-multimedia-server.csv")
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+    std::ofstream os(m_metaDataFile.string().c_str());
+    os << "segmentDuration=2" << std::endl
+       << "numberOfSegments=10" << std::endl
+       << "reprId,screenWidth,screenHeight,bitrate" << std::endl
+       << "low,320,240,100" << std::endl
+       << "a_seg_1,640,480,200" << std::endl
+       << "7,1920,1080,400" << std::endl;
+  }
+
+  ~FakeMultimediaServerFixture()
+  {
+    boost::filesystem::remove(m_metaDataFile);
+  }
+
+  /**
+   * \brief Start a SegmentNameServer for /prefix, which reads the representations from the meta
+   * data file
+   */
+  Ptr<SegmentNameServer>
+  startServer(uint16_t mtu = 1500)
+  {
+    createTopology({
+        {"1", "2"},
+      });
+    getNode("2")->GetDevice(0)->SetMtu(mtu);
+
+    Ptr<SegmentNameServer> server = CreateObject<SegmentNameServer>();
+    server->SetAttribute("Prefix", StringValue("/prefix"));
+    server->SetAttribute("MetaDataFile", StringValue(m_metaDataFile.string()));
+    getNode("2")->AddApplication(server);
+    server->SetStartTime(Seconds(0.0));
+    server->SetStopTime(Seconds(2.0));
+
+    Simulator::Stop(Seconds(1.0));
+    Simulator::Run();
+
+    return server;
+  }
+
+private:
+  boost::filesystem::path m_metaDataFile;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AppsNdnFakeMultimediaServer, FakeMultimediaServerFixture)
+
+BOOST_AUTO_TEST_CASE(ParseSegmentName)
+{
+  Ptr<SegmentNameServer> server = startServer();
+
+  uint32_t repIndex = 0;
+  uint32_t segmentNr = 0;
+
+  BOOST_CHECK(server->parse("repr_low_seg_0.264", repIndex, segmentNr));
+  BOOST_CHECK_EQUAL(repIndex, 0);
+  BOOST_CHECK_EQUAL(segmentNr, 0);
+
+  BOOST_CHECK(server->parse("repr_low_seg_9.264", repIndex, segmentNr));
+  BOOST_CHECK_EQUAL(repIndex, 0);
+  BOOST_CHECK_EQUAL(segmentNr, 9);
+
+  // the representation id may contain "_seg_", the segment number is the one before ".264"
+  BOOST_CHECK(server->parse("repr_a_seg_1_seg_3.264", repIndex, segmentNr));
+  BOOST_CHECK_EQUAL(repIndex, 1);
+  BOOST_CHECK_EQUAL(segmentNr, 3);
+
+  BOOST_CHECK(server->parse("repr_7_seg_5.264", repIndex, segmentNr));
+  BOOST_CHECK_EQUAL(repIndex, 2);
+  BOOST_CHECK_EQUAL(segmentNr, 5);
+
+  // "repr_a_seg_1.264" is segment 1 of representation "a", which does not exist
+  BOOST_CHECK(!server->parse("repr_a_seg_1.264", repIndex, segmentNr));
+
+  // segment numbers beyond numberOfSegments, also those which do not fit into an integer
+  BOOST_CHECK(!server->parse("repr_low_seg_10.264", repIndex, segmentNr));
+  BOOST_CHECK(!server->parse("repr_low_seg_4294967296.264", repIndex, segmentNr));
+  BOOST_CHECK(!server->parse("repr_low_seg_99999999999999999999999.264", repIndex, segmentNr));
+
+  // malformed names
+  BOOST_CHECK(!server->parse("repr_low_seg_.264", repIndex, segmentNr));
+  BOOST_CHECK(!server->parse("repr_low_seg_-1.264", repIndex, segmentNr));
+  BOOST_CHECK(!server->parse("repr_low_seg_1.mp4", repIndex, segmentNr));
+  BOOST_CHECK(!server->parse("repr_low_1.264", repIndex, segmentNr));
+  BOOST_CHECK(!server->parse("low_seg_1.264", repIndex, segmentNr));
+  BOOST_CHECK(!server->parse("repr__seg_1.264", repIndex, segmentNr));
+  BOOST_CHECK(!server->parse("repr_", repIndex, segmentNr));
+  BOOST_CHECK(!server->parse("", repIndex, segmentNr));
+
+  // failed parsing leaves the results alone
+  BOOST_CHECK_EQUAL(repIndex, 2);
+  BOOST_CHECK_EQUAL(segmentNr, 5);
+}
+
+BOOST_AUTO_TEST_CASE(SegmentPayloadSize)
+{
+  Ptr<SegmentNameServer> server = startServer();
+
+  FileCatalogEntry segment = server->getSegmentEntry("/prefix/repr_a_seg_1_seg_3.264/%00%01");
+  BOOST_CHECK_EQUAL(segment.fileSize, 200 / 8 * 2 * 1024);
+  BOOST_CHECK_GT(segment.maxPayloadSize, 0);
+  BOOST_CHECK_LT(segment.maxPayloadSize, 1500);
+  BOOST_CHECK_EQUAL(segment.lastSeqNo, segment.fileSize / segment.maxPayloadSize);
+
+  FileCatalogEntry other = server->getSegmentEntry("/prefix/repr_low_seg_10.264/%00%01");
+  BOOST_CHECK_EQUAL(other.fileSize, -1);
+  BOOST_CHECK_GT(other.maxPayloadSize, 0);
+}
+
+BOOST_AUTO_TEST_CASE(MtuWithoutRoomForPayload)
+{
+  Ptr<SegmentNameServer> server = startServer(20);
+
+  // the payload size neither wraps around nor becomes 0
+  FileCatalogEntry segment = server->getSegmentEntry("/prefix/repr_low_seg_0.264/%00%01");
+  BOOST_CHECK_EQUAL(segment.maxPayloadSize, 1);
+  BOOST_CHECK_EQUAL(segment.lastSeqNo, segment.fileSize);
+
+  FileCatalogEntry other = server->getSegmentEntry("/prefix/video.unknown/%00%01");
+  BOOST_CHECK_EQUAL(other.maxPayloadSize, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,302 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "apps/ndn-file-consumer.hpp"
+#include "apps/ndn-file-consumer-cbr.hpp"
+#include "apps/ndn-fileserver.hpp"
+#include "apps/ndn-file-info.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include "../tests-common.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <deque>
+#include <fstream>
+#include <iterator>
+
+namespace ns3 {
+namespace ndn {
+
+class MissingFileFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  void
+  requestMissingFile(const std::string& skipManifest)
+  {
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+
+    createTopology({
+        {"1", "2"},
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1},
+      });
+
+    addApps({
+        {"1", "ns3::ndn::FileConsumer",
+            {{"FileToRequest", "/prefix/missing.file"}, {"SkipManifest", skipManifest}},
+            "0s", "10s"},
+        {"2", "ns3::ndn::FileServer",
+            {{"Prefix", "/prefix"}, {"ContentDirectory", "/nonexistent-content-directory"},
+             {"FileInfoInChunks", "true"}},
+            "0s", "10s"}
+      });
+
+    Simulator::Stop(Seconds(10.0));
+    Simulator::Run();
+  }
+};
+
+/**
+ * \brief Downloads a list of files, prefetching the next one once every chunk of the current
+ * one has been requested
+ */
+class PrefetchingFileConsumer : public FileConsumerCbr
+{
+public:
+  static TypeId
+  GetTypeId()
+  {
+    static TypeId tid = TypeId("ns3::ndn::PrefetchingFileConsumer")
+      .SetGroupName("Ndn")
+      .SetParent<FileConsumerCbr>()
+      .AddConstructor<PrefetchingFileConsumer>();
+    return tid;
+  }
+
+  std::deque<Name> filesToPrefetch;
+  std::vector<Name> receivedFiles;
+  std::vector<bool> wasNextFileRequested; ///< whether the next file was requested before the current one completed
+
+protected:
+  virtual void
+  OnAllChunksRequested()
+  {
+    if (!filesToPrefetch.empty())
+    {
+      PrefetchFile(filesToPrefetch.front());
+      filesToPrefetch.pop_front();
+    }
+  }
+
+  virtual void
+  OnFileReceived(unsigned status, unsigned length)
+  {
+    bool wasFinished = m_finishedDownloadingFile;
+    FileConsumerCbr::OnFileReceived(status, length);
+    if (wasFinished)
+      return;
+
+    receivedFiles.push_back(m_interestName);
+
+    if (!m_prefetchedFiles.empty())
+    {
+      wasNextFileRequested.push_back(m_prefetchedFiles.front().hasRequestedManifest);
+      StartPrefetchedFile();
+    }
+  }
+};
+
+class ContentFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  ContentFixture()
+    : m_contentDirectory(boost::filesystem::path(TEST_CONFIG_PATH) / "file-consumer-content")
+    , m_nManifestInterests(0)
+  {
+    boost::filesystem::remove_all(m_contentDirectory);
+    boost::filesystem::create_directories(m_contentDirectory);
+
+    // files of about 35 chunks each
+    for (char file = 'a'; file <= 'c'; file++)
+    {
+      std::ofstream os((m_contentDirectory / std::string(1, file)).string().c_str(), std::ios_base::binary);
+      os << std::string(50000, file);
+    }
+  }
+
+  ~ContentFixture()
+  {
+    boost::filesystem::remove_all(m_contentDirectory);
+  }
+
+  /**
+   * \brief Create a topology where node 2 serves the files under /prefix, with file info in chunks
+   */
+  void
+  createServer()
+  {
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("100"));
+
+    createTopology({
+        {"1", "2"},
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1},
+      });
+
+    addApps({
+        {"2", "ns3::ndn::FileServer",
+            {{"Prefix", "/prefix"}, {"ContentDirectory", m_contentDirectory.string()},
+             {"FileInfoInChunks", "true"}},
+            "0s", "20s"}
+      });
+
+    getNode("2")->GetApplication(0)->TraceConnectWithoutContext("ReceivedInterests",
+      MakeCallback(&ContentFixture::onServerInterest, this));
+  }
+
+  Ptr<PrefetchingFileConsumer>
+  downloadFiles(const std::string& skipManifest)
+  {
+    createServer();
+
+    Ptr<PrefetchingFileConsumer> consumer = CreateObject<PrefetchingFileConsumer>();
+    consumer->SetAttribute("FileToRequest", StringValue("/prefix/a"));
+    consumer->SetAttribute("SkipManifest", StringValue(skipManifest));
+    consumer->filesToPrefetch = {"/prefix/b", "/prefix/c"};
+    getNode("1")->AddApplication(consumer);
+    consumer->SetStartTime(Seconds(0.0));
+    consumer->SetStopTime(Seconds(20.0));
+
+    Simulator::Stop(Seconds(20.0));
+    Simulator::Run();
+
+    return consumer;
+  }
+
+private:
+  void
+  onServerInterest(shared_ptr<const Interest> interest, Ptr<App>, shared_ptr<Face>)
+  {
+    if (interest->getName().get(-1) == name::Component("manifest"))
+      m_nManifestInterests++;
+  }
+
+protected:
+  boost::filesystem::path m_contentDirectory;
+  int m_nManifestInterests;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AppsNdnFileConsumer, MissingFileFixture)
+
+BOOST_AUTO_TEST_CASE(MissingFileWithManifest)
+{
+  requestMissingFile("false");
+
+  // the manifest tells that the file does not exist, nothing is requested after it
+  BOOST_CHECK_EQUAL(getFace("2", "1")->getFaceStatus().getNInInterests(), 1);
+  BOOST_CHECK_EQUAL(getFace("1", "2")->getFaceStatus().getNInDatas(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(MissingFileWithSkipManifest)
+{
+  requestMissingFile("true");
+
+  // the file info of the (empty) first chunk tells that the file does not exist,
+  // so the first chunk is not requested again
+  BOOST_CHECK_EQUAL(getFace("2", "1")->getFaceStatus().getNInInterests(), 1);
+  BOOST_CHECK_EQUAL(getFace("1", "2")->getFaceStatus().getNInDatas(), 1);
+}
+
+static void
+checkPrefetchedFiles(Ptr<PrefetchingFileConsumer> consumer)
+{
+  // every prefetched file has been completed and handed over
+  std::vector<Name> expectedFiles = {"/prefix/a", "/prefix/b", "/prefix/c"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(consumer->receivedFiles.begin(), consumer->receivedFiles.end(),
+                                expectedFiles.begin(), expectedFiles.end());
+  BOOST_CHECK(consumer->filesToPrefetch.empty());
+
+  // the next file was being downloaded while the current one was still in progress
+  BOOST_REQUIRE_EQUAL(consumer->wasNextFileRequested.size(), 2);
+  BOOST_CHECK(consumer->wasNextFileRequested[0]);
+  BOOST_CHECK(consumer->wasNextFileRequested[1]);
+}
+
+BOOST_AUTO_TEST_CASE(FileInfo)
+{
+  long fileSize = 0;
+  uint32_t maxPayloadSize = 0;
+
+  Data chunk("/prefix/file/%01");
+  BOOST_CHECK(!GetFileInfo(chunk, fileSize, maxPayloadSize));
+
+  AddFileInfo(chunk, 5000, 1000);
+  StackHelper::getKeyChain().sign(chunk);
+  BOOST_REQUIRE(GetFileInfo(Data(chunk.wireEncode()), fileSize, maxPayloadSize));
+  BOOST_CHECK_EQUAL(fileSize, 5000);
+  BOOST_CHECK_EQUAL(maxPayloadSize, 1000);
+  BOOST_CHECK_EQUAL(chunk.getFinalBlockId().toSequenceNumber(), 5);
+
+  // a missing file is marked by its own TLV, not by a file size
+  Data missingChunk("/prefix/missing/%01");
+  AddFileInfo(missingChunk, -1, 1000);
+  StackHelper::getKeyChain().sign(missingChunk);
+  BOOST_CHECK(missingChunk.getMetaInfo().findAppMetaInfo(FileSizeTlvType) == nullptr);
+  BOOST_CHECK(missingChunk.getMetaInfo().findAppMetaInfo(FileMissingTlvType) != nullptr);
+  BOOST_REQUIRE(GetFileInfo(Data(missingChunk.wireEncode()), fileSize, maxPayloadSize));
+  BOOST_CHECK_EQUAL(fileSize, -1);
+  BOOST_CHECK_EQUAL(maxPayloadSize, 1000);
+}
+
+BOOST_FIXTURE_TEST_CASE(ExistingFileWithSkipManifest, ContentFixture)
+{
+  createServer();
+
+  std::string outFile = (m_contentDirectory / "a.out").string();
+  addApps({
+      {"1", "ns3::ndn::FileConsumer",
+          {{"FileToRequest", "/prefix/a"}, {"SkipManifest", "true"}, {"WriteOutfile", outFile}},
+          "0s", "20s"}
+    });
+
+  Simulator::Stop(Seconds(20.0));
+  Simulator::Run();
+
+  // the file size and the number of chunks are learned from the file info in the chunks only
+  BOOST_CHECK_EQUAL(m_nManifestInterests, 0);
+
+  std::ifstream is(outFile.c_str(), std::ios_base::binary);
+  std::string content((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+  BOOST_CHECK(content == std::string(50000, 'a'));
+}
+
+BOOST_FIXTURE_TEST_CASE(PrefetchWithManifest, ContentFixture)
+{
+  checkPrefetchedFiles(downloadFiles("false"));
+}
+
+BOOST_FIXTURE_TEST_CASE(PrefetchWithSkipManifest, ContentFixture)
+{
+  checkPrefetchedFiles(downloadFiles("true"));
+  BOOST_CHECK_EQUAL(m_nManifestInterests, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,235 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "helper/ndn-app-helper.hpp"
+
+#include "../tests-common.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <map>
+
+namespace ns3 {
+namespace ndn {
+
+class MultimediaFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  struct PlayedSegment
+  {
+    unsigned int segmentNr;
+    Time time;
+    unsigned int freezeTime;
+    unsigned int bufferLevel;
+  };
+
+  MultimediaFixture()
+    : m_metaDataFile(boost::filesystem::path(TEST_CONFIG_PATH) / "multimedia-consumer.csv")
+  {
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("100"));
+
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+  }
+
+  ~MultimediaFixture()
+  {
+    boost::filesystem::remove(m_metaDataFile);
+  }
+
+  /**
+   * \brief Stream a video of 2 second segments of about 18 chunks each
+   */
+  void
+  stream(uint32_t nSegments, const std::string& maxSegmentsInFlight,
+         const std::string& maxBufferedSeconds, const std::string& startUpDelay)
+  {
+    {
+      std::ofstream os(m_metaDataFile.string().c_str());
+      os << "segmentDuration=2" << std::endl
+         << "numberOfSegments=" << nSegments << std::endl
+         << "reprId,screenWidth,screenHeight,bitrate" << std::endl
+         << "1,1920,1080,100" << std::endl;
+    }
+
+    createTopology({
+        {"1", "2"},
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1},
+      });
+
+    addApps({
+        {"2", "ns3::ndn::FakeMultimediaServer",
+            {{"Prefix", "/prefix"}, {"MetaDataFile", m_metaDataFile.string()},
+             {"MPDFileName", "video.mpd"}},
+            "0s", "100s"}
+      });
+
+    AppHelper consumerHelper("ns3::ndn::FileConsumerCbr::MultimediaConsumer");
+    consumerHelper.SetAttribute("MpdFileToRequest", StringValue("/prefix/video.mpd"));
+    consumerHelper.SetAttribute("AdaptationLogic", StringValue("dash::player::AlwaysLowestAdaptationLogic"));
+    consumerHelper.SetAttribute("StartRepresentationId", StringValue("lowest"));
+    consumerHelper.SetAttribute("MaxSegmentsInFlight", StringValue(maxSegmentsInFlight));
+    consumerHelper.SetAttribute("MaxBufferedSeconds", StringValue(maxBufferedSeconds));
+    consumerHelper.SetAttribute("StartUpDelay", StringValue(startUpDelay));
+    Ptr<Application> consumer = consumerHelper.Install(getNode("1")).Get(0);
+    consumer->SetStartTime(Seconds(0.0));
+    consumer->SetStopTime(Seconds(100.0));
+
+    consumer->TraceConnectWithoutContext("TransmittedInterests",
+                                         MakeCallback(&MultimediaFixture::onInterest, this));
+    consumer->TraceConnectWithoutContext("ReceivedDatas",
+                                         MakeCallback(&MultimediaFixture::onData, this));
+    consumer->TraceConnectWithoutContext("PlayerTracer",
+                                         MakeCallback(&MultimediaFixture::onPlayed, this));
+
+    Simulator::Stop(Seconds(100.0));
+    Simulator::Run();
+  }
+
+private:
+  /**
+   * \return number of the segment that name (of a chunk) belongs to, -1 for other files
+   */
+  static int
+  getSegmentNr(const Name& name)
+  {
+    std::string file = name.getPrefix(-1).toUri();
+    size_t pos = file.find("_seg_");
+    if (pos == std::string::npos)
+      return -1;
+    return std::stoi(file.substr(pos + 5));
+  }
+
+  void
+  onInterest(shared_ptr<const Interest> interest, Ptr<App>, shared_ptr<Face>)
+  {
+    int segmentNr = getSegmentNr(interest->getName());
+    if (segmentNr >= 0)
+      firstInterestTimes.insert(std::make_pair(segmentNr, Simulator::Now()));
+  }
+
+  void
+  onData(shared_ptr<const Data> data, Ptr<App>, shared_ptr<Face>)
+  {
+    int segmentNr = getSegmentNr(data->getName());
+    if (segmentNr >= 0)
+      lastDataTimes[segmentNr] = Simulator::Now();
+  }
+
+  void
+  onPlayed(Ptr<App>, unsigned int segmentNr, std::string, unsigned int, unsigned int freezeTime,
+           unsigned int bufferLevel, std::vector<std::string>)
+  {
+    playedSegments.push_back({segmentNr, Simulator::Now(), freezeTime, bufferLevel});
+  }
+
+public:
+  std::map<int, Time> firstInterestTimes;
+  std::map<int, Time> lastDataTimes;
+  std::vector<PlayedSegment> playedSegments;
+
+private:
+  boost::filesystem::path m_metaDataFile;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AppsNdnMultimediaConsumer, MultimediaFixture)
+
+static void
+checkAllPlayed(const std::vector<MultimediaFixture::PlayedSegment>& playedSegments,
+               uint32_t nSegments)
+{
+  BOOST_REQUIRE_EQUAL(playedSegments.size(), nSegments);
+  for (size_t i = 1; i < playedSegments.size(); i++) {
+    BOOST_CHECK_GT(playedSegments[i].segmentNr, playedSegments[i - 1].segmentNr);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(OneSegmentInFlight)
+{
+  stream(5, "1", "30", "0.1");
+
+  checkAllPlayed(playedSegments, 5);
+
+  // every segment is requested after the previous one has been completed
+  BOOST_REQUIRE_EQUAL(firstInterestTimes.size(), 5);
+  for (int segmentNr = 1; segmentNr < 5; segmentNr++) {
+    BOOST_CHECK_GE(firstInterestTimes[segmentNr], lastDataTimes[segmentNr - 1]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SeveralSegmentsInFlight)
+{
+  stream(5, "2", "30", "0.1");
+
+  // prefetched segments are completed and handed over to the player
+  checkAllPlayed(playedSegments, 5);
+
+  // the next segment is requested while the previous one is still in progress
+  BOOST_REQUIRE_EQUAL(firstInterestTimes.size(), 5);
+  int nPrefetched = 0;
+  for (int segmentNr = 1; segmentNr < 5; segmentNr++) {
+    if (firstInterestTimes[segmentNr] < lastDataTimes[segmentNr - 1])
+      nPrefetched++;
+  }
+  BOOST_CHECK_GT(nPrefetched, 0);
+}
+
+BOOST_AUTO_TEST_CASE(FullBufferResumesDownload)
+{
+  // the buffer holds two segments, all ten could be downloaded in less than a second
+  stream(10, "1", "4", "0.1");
+
+  checkAllPlayed(playedSegments, 10);
+  for (const PlayedSegment& played : playedSegments) {
+    BOOST_CHECK_LE(played.bufferLevel, 4);
+  }
+
+  // downloads wait until playback drains the buffer ...
+  BOOST_REQUIRE_EQUAL(firstInterestTimes.size(), 10);
+  BOOST_CHECK_GT(firstInterestTimes[9], Seconds(8.0));
+
+  // ... and resume in time, so that playback never stalls after it started
+  for (size_t i = 1; i < playedSegments.size(); i++) {
+    BOOST_CHECK_EQUAL(playedSegments[i].freezeTime, 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(StalledPlaybackResumes)
+{
+  // playback starts right after the MPD has been parsed, i.e., with an empty buffer
+  stream(3, "1", "30", "0");
+
+  checkAllPlayed(playedSegments, 3);
+
+  // the stalled playback continues as soon as the first segment has been buffered, rather than
+  // with the next playback attempt; the stall does not abort the segment, which has no dependencies
+  BOOST_REQUIRE_EQUAL(lastDataTimes.count(playedSegments[0].segmentNr), 1);
+  BOOST_CHECK_EQUAL(playedSegments[0].time, lastDataTimes[playedSegments[0].segmentNr]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,374 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "helper/ndn-cs-snapshot-helper.hpp"
+#include "helper/ndn-stack-helper.hpp"
+#include "model/ndn-l3-protocol.hpp"
+#include "model/cs/ndn-content-store.hpp"
+#include "utils/ndn-binary-file.hpp"
+
+#include "fw/forwarder.hpp"
+#include "table/cs.hpp"
+
+#include "../tests-common.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <limits>
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(HelperNdnCsSnapshotHelper, ScenarioHelperWithCleanupFixture)
+
+static std::vector<Name>
+getCachedNames(Ptr<Node> node)
+{
+  std::vector<Name> names;
+  node->GetObject<L3Protocol>()->GetObject<ContentStore>()->ForEachInEvictionOrder(
+    [&] (shared_ptr<const Data> data, Time) { names.push_back(data->getName()); });
+  return names;
+}
+
+static std::vector<const nfd::cs::Entry*>
+getNfdCsEntries(Ptr<Node> node)
+{
+  std::vector<const nfd::cs::Entry*> entries;
+  node->GetObject<L3Protocol>()->getForwarder()->getCs().getPolicy()->forEachInEvictionOrder(
+    [&] (const nfd::cs::Entry& entry) { entries.push_back(&entry); });
+  return entries;
+}
+
+static std::vector<Name>
+getNfdCsNames(Ptr<Node> node)
+{
+  std::vector<Name> names;
+  for (const nfd::cs::Entry* entry : getNfdCsEntries(node)) {
+    names.push_back(entry->getName());
+  }
+  return names;
+}
+
+static shared_ptr<Data>
+makeData(const Name& name, time::milliseconds freshnessPeriod = time::milliseconds(-1))
+{
+  auto data = make_shared<Data>(name);
+  if (freshnessPeriod >= time::milliseconds::zero()) {
+    data->setFreshnessPeriod(freshnessPeriod);
+  }
+  StackHelper::getKeyChain().sign(*data);
+  return data;
+}
+
+static void
+runUntil(Time time)
+{
+  Simulator::Stop(time - Simulator::Now());
+  Simulator::Run();
+}
+
+BOOST_AUTO_TEST_CASE(SaveAndRestore)
+{
+  const std::string file = "cs-snapshot.t.bin";
+
+  std::vector<Name> savedNames;
+  {
+    ScenarioHelper warmup;
+    warmup.createTopology({
+        {"1", "2"}
+      });
+
+    warmup.addRoutes({
+        {"1", "2", "/prefix", 1}
+      });
+
+    warmup.addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "10"}},
+            "0s", "0.95s"},
+        {"2", "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", "100"}},
+            "0s", "100s"}
+      });
+
+    CsSnapshotHelper::SaveAt(Seconds(2.0), file);
+    Simulator::Stop(Seconds(2.001));
+    Simulator::Run();
+
+    savedNames = getCachedNames(warmup.getNode("1"));
+    Simulator::Destroy();
+    Names::Clear();
+  }
+  BOOST_REQUIRE_GT(savedNames.size(), 0);
+
+  // same topology in a new simulation, with cold caches
+  createTopology({
+      {"1", "2"}
+    });
+  BOOST_CHECK_EQUAL(getCachedNames(getNode("1")).size(), 0);
+
+  CsSnapshotHelper snapshot(file);
+  BOOST_CHECK_EQUAL(snapshot.Restore(getNode("1")), savedNames.size());
+
+  std::vector<Name> restoredNames = getCachedNames(getNode("1"));
+  BOOST_CHECK_EQUAL_COLLECTIONS(restoredNames.begin(), restoredNames.end(),
+                                savedNames.begin(), savedNames.end());
+
+  std::remove(file.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(NfdCs)
+{
+  const std::string file = "cs-snapshot-nfd.t.bin";
+
+  {
+    NodeContainer nodes;
+    nodes.Create(1);
+    StackHelper stackHelper;
+    stackHelper.setOpMIPS(true); // NFD's CS with the priority-fifo policy
+    stackHelper.Install(nodes);
+
+    nfd::Cs& cs = nodes.Get(0)->GetObject<L3Protocol>()->getForwarder()->getCs();
+    cs.insert(*makeData("/B"));
+    cs.insert(*makeData("/A", time::seconds(10)));
+    cs.insert(*makeData("/C", time::seconds(10)), true);
+    cs.insert(*makeData("/D", time::seconds(1)));
+
+    // /D has become stale at 1s
+    runUntil(Seconds(2.0));
+    std::vector<Name> savedNames = getNfdCsNames(nodes.Get(0));
+    std::vector<Name> expectedNames = {"/C", "/D", "/B", "/A"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(savedNames.begin(), savedNames.end(),
+                                  expectedNames.begin(), expectedNames.end());
+
+    CsSnapshotHelper::Save(file);
+    Simulator::Destroy();
+    Names::Clear();
+  }
+
+  NodeContainer nodes;
+  nodes.Create(1);
+  StackHelper stackHelper;
+  stackHelper.setOpMIPS(true);
+  stackHelper.setCsSnapshot(file);
+  stackHelper.Install(nodes);
+
+  std::vector<const nfd::cs::Entry*> entries = getNfdCsEntries(nodes.Get(0));
+  BOOST_REQUIRE_EQUAL(entries.size(), 4);
+  BOOST_CHECK_EQUAL(entries[0]->getName(), "/C");
+  BOOST_CHECK(entries[0]->isUnsolicited());
+  BOOST_CHECK_EQUAL(entries[1]->getName(), "/D");
+  BOOST_CHECK(!entries[1]->isUnsolicited());
+  BOOST_CHECK(entries[1]->isStale());
+  BOOST_CHECK_EQUAL(entries[2]->getName(), "/B");
+  BOOST_CHECK(entries[2]->getStaleTime() == time::steady_clock::TimePoint::max());
+  BOOST_CHECK_EQUAL(entries[3]->getName(), "/A");
+  BOOST_CHECK(!entries[3]->isStale());
+  // /A had 8s of its 10s FreshnessPeriod left when it was saved
+  BOOST_CHECK(entries[3]->getStaleTime() == time::steady_clock::now() + time::seconds(8));
+
+  runUntil(Seconds(7.0));
+  std::vector<Name> names = getNfdCsNames(nodes.Get(0));
+  std::vector<Name> expectedNames = {"/C", "/D", "/B", "/A"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(names.begin(), names.end(),
+                                expectedNames.begin(), expectedNames.end());
+
+  // priority-fifo moves /A to the stale queue at its restored stale time
+  runUntil(Seconds(9.0));
+  names = getNfdCsNames(nodes.Get(0));
+  expectedNames = {"/C", "/D", "/A", "/B"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(names.begin(), names.end(),
+                                expectedNames.begin(), expectedNames.end());
+
+  std::remove(file.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(ContentStoreWithFreshness)
+{
+  const std::string file = "cs-snapshot-freshness.t.bin";
+
+  {
+    NodeContainer nodes;
+    nodes.Create(1);
+    StackHelper stackHelper;
+    stackHelper.setOpMIPS(true);
+    stackHelper.SetOldContentStore("ns3::ndn::cs::Freshness::Lru");
+    stackHelper.Install(nodes);
+
+    Ptr<ContentStore> cs = nodes.Get(0)->GetObject<L3Protocol>()->GetObject<ContentStore>();
+    cs->Add(makeData("/fresh", time::seconds(10)));
+    cs->Add(makeData("/forever"));
+
+    runUntil(Seconds(2.0));
+    CsSnapshotHelper::Save(file);
+    Simulator::Destroy();
+    Names::Clear();
+  }
+
+  NodeContainer nodes;
+  nodes.Create(1);
+  StackHelper stackHelper;
+  stackHelper.setOpMIPS(true);
+  stackHelper.SetOldContentStore("ns3::ndn::cs::Freshness::Lru");
+  stackHelper.setCsSnapshot(file);
+  stackHelper.Install(nodes);
+
+  std::vector<Name> names = getCachedNames(nodes.Get(0));
+  std::vector<Name> expectedNames = {"/fresh", "/forever"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(names.begin(), names.end(),
+                                expectedNames.begin(), expectedNames.end());
+
+  // /fresh had 8s left when it was saved
+  runUntil(Seconds(7.5));
+  BOOST_CHECK_EQUAL(getCachedNames(nodes.Get(0)).size(), 2);
+
+  runUntil(Seconds(8.5));
+  names = getCachedNames(nodes.Get(0));
+  expectedNames = {"/forever"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(names.begin(), names.end(),
+                                expectedNames.begin(), expectedNames.end());
+
+  std::remove(file.c_str());
+}
+
+static void
+writeSnapshot(const std::string& file, const std::function<void(std::ostream&)>& writeBody)
+{
+  std::ofstream os(file.c_str(), std::ios_base::out | std::ios_base::binary);
+  writeValue<uint32_t>(os, 0x4e435331);
+  writeValue<uint32_t>(os, 1);
+  writeBody(os);
+}
+
+static void
+writeWire(std::ostream& os, const Block& wire, uint32_t size)
+{
+  writeValue<uint32_t>(os, size);
+  os.write(reinterpret_cast<const char*>(wire.wire()), std::min<size_t>(size, wire.size()));
+}
+
+BOOST_AUTO_TEST_CASE(DamagedSnapshot)
+{
+  const std::string file = "cs-snapshot-damaged.t.bin";
+  Block data = makeData("/A")->wireEncode();
+
+  std::remove(file.c_str());
+  BOOST_CHECK_THROW(CsSnapshotHelper snapshot(file), CsSnapshotHelper::Error);
+
+  // control: a valid snapshot with one entry
+  writeSnapshot(file, [&] (std::ostream& os) {
+      writeValue<uint32_t>(os, 1);
+      writeWire(os, data, data.size());
+      writeValue<uint32_t>(os, 1);
+      writeValue<uint32_t>(os, 0);
+      writeValue<uint32_t>(os, 1);
+      writeValue<uint32_t>(os, 0);
+      writeValue<uint8_t>(os, 0);
+      writeValue<int64_t>(os, 0);
+    });
+  BOOST_CHECK_NO_THROW(CsSnapshotHelper snapshot(file));
+
+  // another version
+  {
+    std::ofstream os(file.c_str(), std::ios_base::out | std::ios_base::binary);
+    writeValue<uint32_t>(os, 0x4e435331);
+    writeValue<uint32_t>(os, 2);
+  }
+  BOOST_CHECK_THROW(CsSnapshotHelper snapshot(file), CsSnapshotHelper::Error);
+
+  // truncated after the header
+  writeSnapshot(file, [] (std::ostream&) {});
+  BOOST_CHECK_THROW(CsSnapshotHelper snapshot(file), CsSnapshotHelper::Error);
+
+  // huge count of Data packets
+  writeSnapshot(file, [] (std::ostream& os) {
+      writeValue<uint32_t>(os, std::numeric_limits<uint32_t>::max());
+    });
+  BOOST_CHECK_THROW(CsSnapshotHelper snapshot(file), CsSnapshotHelper::Error);
+
+  // huge size of a Data packet
+  writeSnapshot(file, [&] (std::ostream& os) {
+      writeValue<uint32_t>(os, 1);
+      writeWire(os, data, std::numeric_limits<uint32_t>::max());
+      writeValue<uint32_t>(os, 0);
+    });
+  BOOST_CHECK_THROW(CsSnapshotHelper snapshot(file), CsSnapshotHelper::Error);
+
+  // truncated TLV
+  writeSnapshot(file, [&] (std::ostream& os) {
+      writeValue<uint32_t>(os, 1);
+      writeWire(os, data, data.size() - 1);
+      writeValue<uint32_t>(os, 0);
+    });
+  BOOST_CHECK_THROW(CsSnapshotHelper snapshot(file), CsSnapshotHelper::Error);
+
+  // TLV that is not a Data packet
+  Block name = Name("/A").wireEncode();
+  writeSnapshot(file, [&] (std::ostream& os) {
+      writeValue<uint32_t>(os, 1);
+      writeWire(os, name, name.size());
+      writeValue<uint32_t>(os, 0);
+    });
+  BOOST_CHECK_THROW(CsSnapshotHelper snapshot(file), CsSnapshotHelper::Error);
+
+  // huge count of nodes
+  writeSnapshot(file, [&] (std::ostream& os) {
+      writeValue<uint32_t>(os, 0);
+      writeValue<uint32_t>(os, std::numeric_limits<uint32_t>::max());
+      writeValue<uint32_t>(os, 0);
+      writeValue<uint32_t>(os, 0);
+    });
+  BOOST_CHECK_THROW(CsSnapshotHelper snapshot(file), CsSnapshotHelper::Error);
+
+  // huge count of entries
+  writeSnapshot(file, [&] (std::ostream& os) {
+      writeValue<uint32_t>(os, 0);
+      writeValue<uint32_t>(os, 1);
+      writeValue<uint32_t>(os, 0);
+      writeValue<uint32_t>(os, std::numeric_limits<uint32_t>::max());
+    });
+  BOOST_CHECK_THROW(CsSnapshotHelper snapshot(file), CsSnapshotHelper::Error);
+
+  // entry that refers to a Data packet that does not exist
+  writeSnapshot(file, [&] (std::ostream& os) {
+      writeValue<uint32_t>(os, 1);
+      writeWire(os, data, data.size());
+      writeValue<uint32_t>(os, 1);
+      writeValue<uint32_t>(os, 0);
+      writeValue<uint32_t>(os, 1);
+      writeValue<uint32_t>(os, 1);
+      writeValue<uint8_t>(os, 0);
+      writeValue<int64_t>(os, 0);
+    });
+  BOOST_CHECK_THROW(CsSnapshotHelper snapshot(file), CsSnapshotHelper::Error);
+
+  // StackHelper reports the error when the snapshot is set
+  StackHelper stackHelper;
+  BOOST_CHECK_THROW(stackHelper.setCsSnapshot(file), CsSnapshotHelper::Error);
+
+  std::remove(file.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -37,6 +37,9 @@
 
 #include <boost/filesystem.hpp>
 
+#include <set>
+#include <tuple>
+
 namespace ns3 {
 namespace ndn {
 
@@ -146,6 +149,273 @@ BOOST_AUTO_TEST_CASE(CalculateRouteCase2)
   }
 }
 
+BOOST_AUTO_TEST_CASE(RecalculateRoutes)
+{
+  ofstream file1(TEST_TOPO_TXT.string().c_str());
+  file1 << "router\n\n"
+        << "#node city  y x mpi-partition\n"
+        << "A3  NA  1 1 1\n"
+        << "B3  NA  80  -40 1\n"
+        << "C3  NA  80  40  1\n\n"
+        << "link\n\n"
+        << "# from  to  capacity  metric  delay queue\n"
+        << "A3      B3  10Mbps    1 1ms 100\n"
+        << "A3      C3  10Mbps    10  1ms 100\n"
+        << "B3      C3  10Mbps    1 1ms 100\n";
+  file1.close();
+
+  AnnotatedTopologyReader topologyReader("");
+  topologyReader.SetFileName(TEST_TOPO_TXT.string().c_str());
+  topologyReader.Read();
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  topologyReader.ApplyOspfMetric();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+  ndnGlobalRoutingHelper.AddOrigins("/prefix", Names::Find<Node>("C3"));
+
+  ndn::GlobalRoutingHelper::EnableIncrementalUpdates();
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+
+  // names of neighbors of A3 that are next hops for /prefix, with costs
+  auto getNextHops = [] {
+    std::map<std::string, uint64_t> nextHops;
+    auto ndn = Names::Find<Node>("A3")->GetObject<ndn::L3Protocol>();
+    auto entry = ndn->getForwarder()->getFib().findExactMatch("/prefix");
+    if (entry == nullptr)
+      return nextHops;
+    for (auto& nextHop : entry->getNextHops()) {
+      auto face = dynamic_pointer_cast<ndn::NetDeviceFace>(nextHop.getFace());
+      BOOST_REQUIRE(face != nullptr);
+      auto channel = face->GetNetDevice()->GetChannel();
+      Ptr<Node> other = channel->GetDevice(0)->GetNode();
+      if (other == Names::Find<Node>("A3"))
+        other = channel->GetDevice(1)->GetNode();
+      nextHops[Names::FindName(other)] = nextHop.getCost();
+    }
+    return nextHops;
+  };
+
+  BOOST_CHECK((getNextHops() == std::map<std::string, uint64_t>{{"B3", 2}}));
+
+  LinkControlHelper::FailLinkByName("A3", "B3");
+  ndn::GlobalRoutingHelper::RecalculateRoutes();
+  BOOST_CHECK((getNextHops() == std::map<std::string, uint64_t>{{"C3", 10}}));
+
+  LinkControlHelper::UpLinkByName("A3", "B3");
+  ndn::GlobalRoutingHelper::RecalculateRoutes();
+  BOOST_CHECK((getNextHops() == std::map<std::string, uint64_t>{{"B3", 2}}));
+
+  ndn::GlobalRoutingHelper::EnableIncrementalUpdates(false);
+}
+
+BOOST_AUTO_TEST_CASE(DamagedRouteCache)
+{
+  ofstream file1(TEST_TOPO_TXT.string().c_str());
+  file1 << "router\n\n"
+        << "#node city  y x mpi-partition\n"
+        << "A4  NA  1 1 1\n"
+        << "B4  NA  80  -40 1\n"
+        << "C4  NA  80  40  1\n\n"
+        << "link\n\n"
+        << "# from  to  capacity  metric  delay queue\n"
+        << "A4      B4  10Mbps    1 1ms 100\n"
+        << "A4      C4  10Mbps    10  1ms 100\n"
+        << "B4      C4  10Mbps    1 1ms 100\n";
+  file1.close();
+
+  const boost::filesystem::path cacheDirectory =
+    boost::filesystem::path(TEST_CONFIG_PATH) / "route-cache";
+  boost::filesystem::remove_all(cacheDirectory);
+  boost::filesystem::create_directories(cacheDirectory);
+
+  AnnotatedTopologyReader topologyReader("");
+  topologyReader.SetFileName(TEST_TOPO_TXT.string().c_str());
+  topologyReader.Read();
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  topologyReader.ApplyOspfMetric();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+  ndnGlobalRoutingHelper.AddOrigins("/prefix", Names::Find<Node>("C4"));
+
+  ndn::GlobalRoutingHelper::SetRouteCacheDirectory(cacheDirectory.string());
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+
+  // the calculation above has saved the only file in the cache directory
+  std::vector<boost::filesystem::path> cacheFiles(boost::filesystem::directory_iterator(cacheDirectory),
+                                                  boost::filesystem::directory_iterator());
+  BOOST_REQUIRE_EQUAL(cacheFiles.size(), 1);
+  const std::string cacheFile = cacheFiles.front().string();
+
+  // magic, version and topology hash, which must match for the rest of the file to be read
+  std::string header(sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint64_t), '\0');
+  {
+    ifstream is(cacheFile.c_str(), std::ios_base::binary);
+    is.read(&header[0], header.size());
+    BOOST_REQUIRE(is);
+  }
+
+  auto fib = [] () -> nfd::Fib& {
+    return Names::Find<Node>("A4")->GetObject<ndn::L3Protocol>()->getForwarder()->getFib();
+  };
+
+  // write the header followed by damaged content, remove the route from A4,
+  // and check that it comes back from a new calculation
+  auto checkDamagedCache = [&] (const std::string& content) {
+    {
+      ofstream os(cacheFile.c_str(), std::ios_base::binary | std::ios_base::trunc);
+      os << header << content;
+    }
+
+    shared_ptr<nfd::fib::Entry> entry = fib().findExactMatch("/prefix");
+    BOOST_REQUIRE(entry != nullptr);
+    fib().erase(*entry);
+
+    BOOST_CHECK_NO_THROW(ndn::GlobalRoutingHelper::CalculateRoutes());
+    BOOST_CHECK(fib().findExactMatch("/prefix") != nullptr);
+  };
+
+  auto encode = [] (uint32_t value) {
+    return std::string(reinterpret_cast<const char*>(&value), sizeof(value));
+  };
+
+  // prefix count much larger than the file
+  checkDamagedCache(encode(0xFFFFFFFF));
+
+  // prefix size larger than the file
+  checkDamagedCache(encode(1) + encode(0x7FFFFFFF));
+
+  // truncated Name TLV
+  checkDamagedCache(encode(1) + encode(3) + std::string("\x07\x05\x08", 3));
+
+  // TLV of another type than Name
+  checkDamagedCache(encode(1) + encode(2) + std::string("\x06\x00", 2) + encode(0));
+
+  // route count much larger than the file
+  checkDamagedCache(encode(0) + encode(0xFFFFFFFF));
+
+  // stale cache: route through a face that does not exist
+  const Block& prefixWire = Name("/prefix").wireEncode();
+  checkDamagedCache(encode(1) + encode(prefixWire.size()) +
+                    std::string(reinterpret_cast<const char*>(prefixWire.wire()), prefixWire.size()) +
+                    encode(1) + encode(Names::Find<Node>("A4")->GetId()) + encode(0) +
+                    encode(9999) + encode(1));
+
+  ndn::GlobalRoutingHelper::SetRouteCacheDirectory("");
+  boost::filesystem::remove_all(cacheDirectory);
+}
+
+BOOST_AUTO_TEST_CASE(RouteCacheHit)
+{
+  ofstream file1(TEST_TOPO_TXT.string().c_str());
+  file1 << "router\n\n"
+        << "#node city  y x mpi-partition\n"
+        << "A5  NA  1 1 1\n"
+        << "B5  NA  80  -40 1\n"
+        << "C5  NA  80  40  1\n\n"
+        << "link\n\n"
+        << "# from  to  capacity  metric  delay queue\n"
+        << "A5      B5  10Mbps    1 1ms 100\n"
+        << "A5      C5  10Mbps    10  1ms 100\n"
+        << "B5      C5  10Mbps    1 1ms 100\n";
+  file1.close();
+
+  const boost::filesystem::path cacheDirectory =
+    boost::filesystem::path(TEST_CONFIG_PATH) / "route-cache";
+  boost::filesystem::remove_all(cacheDirectory);
+  boost::filesystem::create_directories(cacheDirectory);
+
+  AnnotatedTopologyReader topologyReader("");
+  topologyReader.SetFileName(TEST_TOPO_TXT.string().c_str());
+  topologyReader.Read();
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  topologyReader.ApplyOspfMetric();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+  ndnGlobalRoutingHelper.AddOrigins("/prefix", Names::Find<Node>("C5"));
+
+  typedef std::set<std::tuple<std::string, Name, nfd::FaceId, uint64_t>> Routes;
+  auto getRoutes = [] {
+    Routes routes;
+    for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+      const nfd::Fib& fib = (*node)->GetObject<ndn::L3Protocol>()->getForwarder()->getFib();
+      for (const nfd::fib::Entry& entry : fib) {
+        for (const nfd::fib::NextHop& nextHop : entry.getNextHops()) {
+          routes.insert(std::make_tuple(Names::FindName(*node), entry.getPrefix(),
+                                        nextHop.getFace()->getId(), nextHop.getCost()));
+        }
+      }
+    }
+    return routes;
+  };
+
+  auto eraseRoutes = [] {
+    for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+      (*node)->GetObject<ndn::L3Protocol>()->getForwarder()->getFib().erase("/prefix");
+    }
+  };
+
+  ndn::GlobalRoutingHelper::SetRouteCacheDirectory(cacheDirectory.string());
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+  Routes calculatedRoutes = getRoutes();
+
+  std::vector<boost::filesystem::path> cacheFiles(boost::filesystem::directory_iterator(cacheDirectory),
+                                                  boost::filesystem::directory_iterator());
+  BOOST_REQUIRE_EQUAL(cacheFiles.size(), 1);
+  const std::string cacheFile = cacheFiles.front().string();
+
+  // the same topology installs the same FIBs from the cache
+  eraseRoutes();
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+  BOOST_CHECK(getRoutes() == calculatedRoutes);
+
+  // the routes come from the file only: replace them with a route Dijkstra would not produce
+  shared_ptr<nfd::fib::Entry> entryA5 = Names::Find<Node>("A5")->GetObject<ndn::L3Protocol>()
+                                          ->getForwarder()->getFib().findExactMatch("/prefix");
+  BOOST_REQUIRE(entryA5 != nullptr && !entryA5->getNextHops().empty());
+  nfd::FaceId faceIdA5 = entryA5->getNextHops().front().getFace()->getId();
+
+  auto encode = [] (uint32_t value) {
+    return std::string(reinterpret_cast<const char*>(&value), sizeof(value));
+  };
+  {
+    std::string header(sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint64_t), '\0');
+    ifstream is(cacheFile.c_str(), std::ios_base::binary);
+    is.read(&header[0], header.size());
+    BOOST_REQUIRE(is);
+    is.close();
+
+    const Block& prefixWire = Name("/cached").wireEncode();
+    ofstream os(cacheFile.c_str(), std::ios_base::binary | std::ios_base::trunc);
+    os << header << encode(1) << encode(prefixWire.size())
+       << std::string(reinterpret_cast<const char*>(prefixWire.wire()), prefixWire.size())
+       << encode(1) << encode(Names::Find<Node>("A5")->GetId()) << encode(0)
+       << encode(faceIdA5) << encode(7);
+  }
+
+  eraseRoutes();
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+  BOOST_CHECK((getRoutes() ==
+               Routes{std::make_tuple("A5", Name("/cached"), faceIdA5, 7),
+                      std::make_tuple("A5", Name("/localhost/nfd"), nfd::FACEID_INTERNAL_FACE, 0),
+                      std::make_tuple("B5", Name("/localhost/nfd"), nfd::FACEID_INTERNAL_FACE, 0),
+                      std::make_tuple("C5", Name("/localhost/nfd"), nfd::FACEID_INTERNAL_FACE, 0)}));
+
+  ndn::GlobalRoutingHelper::SetRouteCacheDirectory("");
+  boost::filesystem::remove_all(cacheDirectory);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
@@ -0,0 +1,76 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/cs/ndn-content-store.hpp"
+
+#include "ns3/nstime.h"
+#include "ns3/object-factory.h"
+#include "ns3/simulator.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(ModelNdnContentStoreWithFreshness, CleanupFixture)
+
+static void
+addData(Ptr<ContentStore> cs, std::string name, int64_t freshnessMs)
+{
+  auto data = make_shared<Data>(name);
+  data->setFreshnessPeriod(time::milliseconds(freshnessMs));
+  cs->Add(data);
+}
+
+static void
+checkSize(Ptr<ContentStore> cs, uint32_t expectedSize)
+{
+  BOOST_CHECK_EQUAL(cs->GetSize(), expectedSize);
+}
+
+BOOST_AUTO_TEST_CASE(ExactExpiry)
+{
+  ObjectFactory factory("ns3::ndn::cs::Freshness::Lru");
+  Ptr<ContentStore> cs = factory.Create<ContentStore>();
+
+  Simulator::Schedule(Seconds(0.0), &addData, cs, "/a", 300);
+  Simulator::Schedule(Seconds(0.1), &addData, cs, "/b", 700);
+  Simulator::Schedule(Seconds(0.4), &checkSize, cs, 1);
+  Simulator::Schedule(Seconds(0.9), &checkSize, cs, 0);
+  Simulator::Run();
+}
+
+BOOST_AUTO_TEST_CASE(BatchedExpiry)
+{
+  ObjectFactory factory("ns3::ndn::cs::Freshness::Lru");
+  factory.Set("ExpiryGranularity", TimeValue(Seconds(1)));
+  Ptr<ContentStore> cs = factory.Create<ContentStore>();
+
+  Simulator::Schedule(Seconds(0.0), &addData, cs, "/a", 300);
+  Simulator::Schedule(Seconds(0.1), &addData, cs, "/b", 700);
+  // both expire at 1s
+  Simulator::Schedule(Seconds(0.9), &checkSize, cs, 2);
+  Simulator::Schedule(Seconds(1.1), &checkSize, cs, 0);
+  Simulator::Run();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
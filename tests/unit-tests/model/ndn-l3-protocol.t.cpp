@@ -19,6 +19,9 @@
 
 #include "helper/ndn-scenario-helper.hpp"
 #include "helper/ndn-app-helper.hpp"
+#include "helper/ndn-strategy-choice-helper.hpp"
+
+#include "fw/forwarder.hpp"
 
 #include <ndn-cxx/face.hpp>
 
@@ -149,6 +152,54 @@ BOOST_AUTO_TEST_CASE(DisabledStatusServer)
 
 BOOST_AUTO_TEST_SUITE_END() // ManagerCheck
 
+BOOST_AUTO_TEST_CASE(LazyManagement)
+{
+  enableLazyManagement();
+  createTopology({
+      {"1", "2"},
+        });
+
+  // helpers configure the tables without creating the managers
+  addRoutes({
+      {"1", "2", "/prefix", 1},
+        });
+  StrategyChoiceHelper::Install(getNode("1"), "/prefix", "/localhost/nfd/strategy/multicast");
+
+  Ptr<L3Protocol> l3protocol1 = getNode("1")->GetObject<L3Protocol>();
+  Ptr<L3Protocol> l3protocol2 = getNode("2")->GetObject<L3Protocol>();
+  shared_ptr<nfd::Forwarder> forwarder1 = l3protocol1->getForwarder();
+  BOOST_REQUIRE(forwarder1->getFib().findExactMatch("/prefix") != nullptr);
+  BOOST_CHECK(forwarder1->getFib().findExactMatch("/prefix")->hasNextHop(getFace("1", "2")));
+  BOOST_CHECK(Name("/localhost/nfd/strategy/multicast")
+              .isPrefixOf(forwarder1->getStrategyChoice().findEffectiveStrategy("/prefix")
+                          .getName()));
+
+  Simulator::Stop(Seconds(0.5));
+  Simulator::Run();
+
+  // nothing has asked for management yet, not even the RIB manager
+  BOOST_CHECK(!l3protocol1->isManagementInitialized());
+  BOOST_CHECK(!l3protocol2->isManagementInitialized());
+
+  // the first management Interest creates the managers of its node only
+  bool hasStatus = false;
+  FactoryCallbackApp::Install(getNode("1"), [&hasStatus] () -> shared_ptr<void> {
+      return make_shared<TesterApp>([&hasStatus] (::ndn::Face& face) {
+          face.expressInterest(Name("/localhost/nfd/status"),
+                               [&hasStatus] (const Interest&, Data&) { hasStatus = true; },
+                               std::bind([]{}));
+        });
+    })
+    .Start(Seconds(0.6));
+
+  Simulator::Stop(Seconds(1.0));
+  Simulator::Run();
+
+  BOOST_CHECK(hasStatus);
+  BOOST_CHECK(l3protocol1->isManagementInitialized());
+  BOOST_CHECK(!l3protocol2->isManagementInitialized());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // ModelNdnL3Protocol
 
 } // namespace ndn
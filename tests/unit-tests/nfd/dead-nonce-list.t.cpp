@@ -0,0 +1,46 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "table/dead-nonce-list.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(NfdDeadNonceList, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(ComponentOrder)
+{
+  const uint32_t nonce1 = 0x53b4eaa8;
+
+  // names whose components hash to the same XOR must not share entries
+  nfd::DeadNonceList dnl;
+  dnl.add(Name("ndn:/a/b"), nonce1);
+  dnl.add(Name("ndn:/x/x/y"), nonce1);
+  BOOST_CHECK_EQUAL(dnl.has(Name("ndn:/a/b"), nonce1), true);
+  BOOST_CHECK_EQUAL(dnl.has(Name("ndn:/b/a"), nonce1), false);
+  BOOST_CHECK_EQUAL(dnl.has(Name("ndn:/x/x/y"), nonce1), true);
+  BOOST_CHECK_EQUAL(dnl.has(Name("ndn:/y"), nonce1), false);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
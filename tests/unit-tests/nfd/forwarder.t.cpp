@@ -0,0 +1,66 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "fw/forwarder.hpp"
+#include "NFD/core/scheduler.hpp"
+#include "NFD/tests/daemon/face/dummy-face.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(NfdForwarder, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(InterestLoopWithShortLifetime)
+{
+  nfd::Forwarder forwarder;
+  auto face1 = make_shared<nfd::tests::DummyFace>();
+  auto face2 = make_shared<nfd::tests::DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+
+  // cause an Interest sent out of face2 to loop back into face1 after a delay
+  face2->onSendInterest.connect([&face1] (const Interest& interest) {
+      nfd::scheduler::schedule(time::milliseconds(170), [&face1, interest] { face1->receiveInterest(interest); });
+    });
+
+  shared_ptr<nfd::fib::Entry> fibEntry = forwarder.getFib().insert(Name("ndn:/A")).first;
+  fibEntry->addNextHop(face2, 0);
+
+  // receive an Interest
+  Interest interest("ndn:/A/1");
+  interest.setNonce(82101183);
+  interest.setInterestLifetime(time::milliseconds(50));
+  nfd::scheduler::schedule(time::milliseconds(1), [&face1, interest] { face1->receiveInterest(interest); });
+
+  Simulator::Stop(Seconds(1));
+  Simulator::Run();
+
+  // interest is forwarded only once, as long as Nonce is in Dead Nonce List
+  BOOST_CHECK_EQUAL(face2->m_sentInterests.size(), 1);
+
+  // Dead Nonce List lookups reused the hash cached on the name tree entry
+  BOOST_CHECK_GT(static_cast<uint64_t>(forwarder.getCounters().getNDeadNonceListHashReuses()), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
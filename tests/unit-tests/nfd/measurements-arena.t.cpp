@@ -0,0 +1,122 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "table/measurements-arena.hpp"
+#include "table/measurements.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(NfdMeasurementsArena, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(InsertFind)
+{
+  nfd::NameTree nameTree;
+  nfd::Measurements measurements(nameTree);
+  nfd::MeasurementsArena<int> arena;
+
+  std::shared_ptr<nfd::measurements::Entry> entryA = measurements.get("/A");
+  std::shared_ptr<nfd::measurements::Entry> entryB = measurements.get("/B");
+  BOOST_CHECK(arena.find(*entryA) == nullptr);
+
+  std::pair<int*, bool> insertA = arena.insert(*entryA);
+  BOOST_CHECK(insertA.second);
+  *insertA.first = 3506;
+  std::pair<int*, bool> insertB = arena.insert(*entryB);
+  BOOST_CHECK(insertB.second);
+  *insertB.first = 9164;
+  BOOST_CHECK_NE(entryA->getPrefixId(), entryB->getPrefixId());
+  BOOST_CHECK_EQUAL(arena.size(), 2);
+
+  std::pair<int*, bool> insertA2 = arena.insert(*entryA);
+  BOOST_CHECK(!insertA2.second);
+  BOOST_CHECK_EQUAL(insertA2.first, insertA.first);
+  BOOST_REQUIRE(arena.find(*entryB) != nullptr);
+  BOOST_CHECK_EQUAL(*arena.find(*entryB), 9164);
+}
+
+BOOST_AUTO_TEST_CASE(Release)
+{
+  nfd::NameTree nameTree;
+  nfd::Measurements measurements(nameTree);
+  nfd::MeasurementsArena<int> arena;
+
+  std::shared_ptr<nfd::measurements::Entry> entryA = measurements.get("/A");
+  *arena.insert(*entryA).first = 2080;
+  size_t prefixIdA = entryA->getPrefixId();
+
+  // clearing StrategyInfo returns the prefix id
+  entryA->clearStrategyInfo();
+  BOOST_CHECK(arena.find(*entryA) == nullptr);
+  BOOST_CHECK_EQUAL(arena.size(), 0);
+
+  // a reused prefix id starts with default measurements
+  std::shared_ptr<nfd::measurements::Entry> entryB = measurements.get("/B");
+  std::pair<int*, bool> insertB = arena.insert(*entryB);
+  BOOST_CHECK_EQUAL(entryB->getPrefixId(), prefixIdA);
+  BOOST_CHECK_EQUAL(*insertB.first, 0);
+
+  // destroying the entry returns the prefix id
+  nfd::measurements::Entry* entryC = new nfd::measurements::Entry("/C");
+  arena.insert(*entryC);
+  BOOST_CHECK_EQUAL(arena.size(), 2);
+  delete entryC;
+  BOOST_CHECK_EQUAL(arena.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ArenaDestroyedFirst)
+{
+  nfd::NameTree nameTree;
+  nfd::Measurements measurements(nameTree);
+  std::shared_ptr<nfd::measurements::Entry> entryA = measurements.get("/A");
+
+  std::unique_ptr<nfd::MeasurementsArena<int>> arena(new nfd::MeasurementsArena<int>);
+  arena->insert(*entryA);
+  arena.reset();
+
+  // the entry no longer refers to the arena
+  nfd::MeasurementsArena<int> arena2;
+  BOOST_CHECK(arena2.find(*entryA) == nullptr);
+  BOOST_CHECK(arena2.insert(*entryA).second);
+  BOOST_CHECK_NO_THROW(entryA->clearStrategyInfo());
+}
+
+BOOST_AUTO_TEST_CASE(ClearThroughHost)
+{
+  nfd::NameTree nameTree;
+  nfd::Measurements measurements(nameTree);
+  nfd::MeasurementsArena<int> arena;
+
+  std::shared_ptr<nfd::measurements::Entry> entryA = measurements.get("/A");
+  arena.insert(*entryA);
+
+  // StrategyChoice and other generic code only see a StrategyInfoHost
+  nfd::StrategyInfoHost& host = *entryA;
+  host.clearStrategyInfo();
+  BOOST_CHECK(arena.find(*entryA) == nullptr);
+  BOOST_CHECK_EQUAL(arena.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
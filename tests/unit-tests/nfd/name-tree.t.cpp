@@ -0,0 +1,48 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "table/name-tree.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(NfdNameTree, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(OrderedHash)
+{
+  using nfd::name_tree::computeOrderedHash;
+
+  BOOST_CHECK_EQUAL(computeOrderedHash(Name("/")), static_cast<size_t>(0));
+  BOOST_CHECK_NE(computeOrderedHash(Name("/a/b")), computeOrderedHash(Name("/b/a")));
+  BOOST_CHECK_NE(computeOrderedHash(Name("/x/x/y")), computeOrderedHash(Name("/y")));
+
+  // entries chain the hash from their parent
+  nfd::NameTree nt;
+  Name prefix("/nohello/world/ndn/research");
+  shared_ptr<nfd::name_tree::Entry> npe = nt.lookup(prefix);
+  BOOST_CHECK_EQUAL(npe->getOrderedHash(), computeOrderedHash(prefix));
+  BOOST_CHECK_EQUAL(npe->getParent()->getOrderedHash(), computeOrderedHash(prefix.getPrefix(-1)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "table/strategy-info-host.hpp"
+#include "table/measurements.hpp"
+#include "fw/forwarder.hpp"
+
+#include "NFD/tests/daemon/fw/dummy-strategy.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::StrategyInfoHost;
+
+static int g_SlotInfoA_count = 0;
+
+// SlotInfoA and SlotInfoB both use the default slot 0
+class SlotInfoA : public nfd::fw::StrategyInfo
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 1;
+  }
+
+  SlotInfoA(int id)
+    : m_id(id)
+  {
+    ++g_SlotInfoA_count;
+  }
+
+  virtual
+  ~SlotInfoA()
+  {
+    --g_SlotInfoA_count;
+  }
+
+  int m_id;
+};
+
+class SlotInfoB : public nfd::fw::StrategyInfo
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 3;
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(NfdStrategyInfoHost, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(SlotClash)
+{
+  StrategyInfoHost host;
+  g_SlotInfoA_count = 0;
+
+  SlotInfoA* info = host.getOrCreateStrategyInfo<SlotInfoA>(4120);
+  BOOST_CHECK(host.getStrategyInfo<SlotInfoB>() == nullptr);
+  BOOST_CHECK(!host.eraseStrategyInfo<SlotInfoB>());
+  BOOST_CHECK_THROW(host.insertStrategyInfo<SlotInfoB>(), StrategyInfoHost::Error);
+  BOOST_CHECK_THROW(host.getOrCreateStrategyInfo<SlotInfoB>(), StrategyInfoHost::Error);
+
+  // the existing item is untouched
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<SlotInfoA>(), info);
+  BOOST_CHECK_EQUAL(info->m_id, 4120);
+  BOOST_CHECK_EQUAL(g_SlotInfoA_count, 1);
+
+  // the slot can be reused once it's cleared
+  host.eraseStrategyInfo<SlotInfoA>();
+  BOOST_CHECK(host.insertStrategyInfo<SlotInfoB>().second);
+  BOOST_CHECK(host.getStrategyInfo<SlotInfoA>() == nullptr);
+  BOOST_CHECK_EQUAL(g_SlotInfoA_count, 0);
+}
+
+BOOST_AUTO_TEST_CASE(MeasurementsEntry)
+{
+  nfd::NameTree nameTree;
+  nfd::Measurements measurements(nameTree);
+
+  std::shared_ptr<nfd::measurements::Entry> entry = measurements.get("/A");
+  SlotInfoA* info = entry->getOrCreateStrategyInfo<SlotInfoA>(1);
+  BOOST_CHECK(entry->getStrategyInfo<SlotInfoB>() == nullptr);
+  BOOST_CHECK_THROW(entry->getOrCreateStrategyInfo<SlotInfoB>(), StrategyInfoHost::Error);
+  BOOST_CHECK_EQUAL(entry->getStrategyInfo<SlotInfoA>(), info);
+
+  entry->clearStrategyInfo();
+  BOOST_CHECK(entry->getOrCreateStrategyInfo<SlotInfoB>() != nullptr);
+  BOOST_CHECK(entry->getStrategyInfo<SlotInfoA>() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(StrategyChange)
+{
+  nfd::Forwarder forwarder;
+  Name nameP("ndn:/strategy/P");
+  Name nameQ("ndn:/strategy/Q");
+  nfd::StrategyChoice& table = forwarder.getStrategyChoice();
+  nfd::Measurements& measurements = forwarder.getMeasurements();
+  table.install(std::make_shared<nfd::tests::DummyStrategy>(std::ref(forwarder), nameP));
+  table.install(std::make_shared<nfd::tests::DummyStrategy>(std::ref(forwarder), nameQ));
+
+  BOOST_CHECK(table.insert("ndn:/", nameP));
+  measurements.get("ndn:/A/B")->getOrCreateStrategyInfo<SlotInfoA>(1);
+  measurements.get("ndn:/A/C")->getOrCreateStrategyInfo<SlotInfoA>(2);
+
+  BOOST_CHECK(table.insert("ndn:/A/B", nameP));
+  BOOST_CHECK(table.insert("ndn:/A", nameQ));
+  // { '/'=>P, '/A'=>Q, '/A/B'=>P }: only /A/C has been cleared for Q
+  BOOST_CHECK_THROW(measurements.get("ndn:/A/B")->getOrCreateStrategyInfo<SlotInfoB>(),
+                    StrategyInfoHost::Error);
+  BOOST_CHECK(measurements.get("ndn:/A/C")->getOrCreateStrategyInfo<SlotInfoB>() != nullptr);
+
+  table.erase("ndn:/A/B");
+  // { '/'=>P, '/A'=>Q }
+  BOOST_CHECK(measurements.get("ndn:/A/B")->getStrategyInfo<SlotInfoA>() == nullptr);
+  BOOST_CHECK(measurements.get("ndn:/A/C")->getStrategyInfo<SlotInfoB>() != nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
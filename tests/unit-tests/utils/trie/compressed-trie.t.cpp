@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/trie/trie-with-policy.hpp"
+#include "utils/trie/lru-policy.hpp"
+
+#include "../../tests-common.hpp"
+
+#include <list>
+#include <random>
+#include <set>
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTrieCompressedTrie, CleanupFixture)
+
+template<template<typename, typename, typename> class Trie>
+using NameTrie = ndnSIM::trie_with_policy<Name, ndnSIM::pointer_payload_traits<const Name>,
+                                          ndnSIM::lru_policy_traits, Trie>;
+
+template<class Cache>
+static std::set<Name>
+getNames(Cache& cache)
+{
+  std::set<Name> names;
+  typename Cache::parent_trie::recursive_iterator item(cache.getTrie()), end(0);
+  for (; item != end; item++) {
+    if (item->payload() != nullptr) {
+      names.insert(*item->payload());
+    }
+  }
+  return names;
+}
+
+BOOST_AUTO_TEST_CASE(SplitAndMerge)
+{
+  NameTrie<ndnSIM::compressed_trie> cache;
+  cache.getPolicy().set_max_size(0);
+
+  Name abcd("/a/b/c/d"), ab("/a/b"), abx("/a/b/x");
+  BOOST_CHECK(cache.insert(abcd, &abcd).second);
+  BOOST_CHECK(cache.find_exact(ab) == cache.end());
+  BOOST_CHECK(cache.deepest_prefix_match(ab) != cache.end());
+  BOOST_CHECK(cache.deepest_prefix_match(abx) == cache.end());
+
+  // splits /a/b/c/d
+  BOOST_CHECK(cache.insert(ab, &ab).second);
+  BOOST_CHECK(cache.insert(abx, &abx).second);
+  BOOST_CHECK_EQUAL(*cache.find_exact(abcd)->payload(), abcd);
+  BOOST_CHECK_EQUAL(*cache.longest_prefix_match(Name("/a/b/c"))->payload(), ab);
+
+  // /a/b/c ends inside the label of /a/b/c/d
+  auto isNotD = [] (const name::Component& component) { return component != name::Component("d"); };
+  BOOST_CHECK(cache.deepest_prefix_match_if_next_level(Name("/a/b/c"), isNotD) == cache.end());
+
+  // merges /a/b with /c/d
+  cache.erase(abx);
+  cache.erase(ab);
+  BOOST_CHECK_EQUAL(*cache.find_exact(abcd)->payload(), abcd);
+  BOOST_CHECK_EQUAL(getNames(cache).size(), 1);
+
+  cache.erase(abcd);
+  BOOST_CHECK(getNames(cache).empty());
+}
+
+BOOST_AUTO_TEST_CASE(SameAsTrie)
+{
+  NameTrie<ndnSIM::trie> expected;
+  NameTrie<ndnSIM::compressed_trie> actual;
+  expected.getPolicy().set_max_size(50);
+  actual.getPolicy().set_max_size(50);
+
+  std::mt19937 rng(1);
+  std::list<Name> names;
+  for (int i = 0; i < 10000; ++i) {
+    Name name;
+    for (size_t length = 1 + rng() % 6; name.size() < length;) {
+      name.append(name::Component(std::string(1, 'a' + rng() % 3)));
+    }
+
+    switch (rng() % 4) {
+    case 0:
+    case 1:
+      names.push_back(name);
+      BOOST_CHECK_EQUAL(actual.insert(name, &names.back()).second,
+                        expected.insert(name, &names.back()).second);
+      break;
+    case 2:
+      expected.erase(name);
+      actual.erase(name);
+      break;
+    case 3:
+      BOOST_CHECK_EQUAL(actual.longest_prefix_match(name) == actual.end(),
+                        expected.longest_prefix_match(name) == expected.end());
+      break;
+    }
+  }
+
+  std::set<Name> expectedNames = getNames(expected);
+  std::set<Name> actualNames = getNames(actual);
+  BOOST_CHECK_EQUAL_COLLECTIONS(actualNames.begin(), actualNames.end(),
+                                expectedNames.begin(), expectedNames.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
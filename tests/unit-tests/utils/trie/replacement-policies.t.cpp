@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/cs/ndn-content-store.hpp"
+
+#include "ns3/object-factory.h"
+#include "ns3/uinteger.h"
+
+#include "../../tests-common.hpp"
+
+#include <random>
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTrieReplacementPolicies, CleanupFixture)
+
+static Ptr<ContentStore>
+createContentStore(const std::string& policy, uint32_t maxSize)
+{
+  ObjectFactory factory("ns3::ndn::cs::" + policy);
+  factory.Set("MaxSize", UintegerValue(maxSize));
+  return factory.Create<ContentStore>();
+}
+
+static Name
+makeName(uint32_t i)
+{
+  return Name("/trie").appendNumber(i);
+}
+
+static bool
+lookup(Ptr<ContentStore> cs, uint32_t i)
+{
+  return cs->Lookup(make_shared<Interest>(makeName(i))) != nullptr;
+}
+
+static void
+add(Ptr<ContentStore> cs, uint32_t i)
+{
+  cs->Add(make_shared<Data>(makeName(i)));
+}
+
+static std::vector<Name>
+getEvictionOrder(Ptr<ContentStore> cs)
+{
+  std::vector<Name> names;
+  cs->ForEachInEvictionOrder([&] (shared_ptr<const Data> data, Time) {
+      names.push_back(data->getName());
+    });
+  return names;
+}
+
+BOOST_AUTO_TEST_CASE(BucketLfuEvictsAsLfu)
+{
+  for (const std::string& prefix : {"", "Stats::", "Freshness::", "Probability::"}) {
+    Ptr<ContentStore> lfu = createContentStore(prefix + "Lfu", 20);
+    Ptr<ContentStore> bucketLfu = createContentStore(prefix + "BucketLfu", 20);
+
+    std::mt19937 rng(1);
+    std::geometric_distribution<uint32_t> items(0.05);
+    for (int i = 0; i < 5000; ++i) {
+      uint32_t item = items(rng);
+      bool isLfuHit = lookup(lfu, item);
+      BOOST_REQUIRE_EQUAL(lookup(bucketLfu, item), isLfuHit);
+      if (!isLfuHit) {
+        add(lfu, item);
+        add(bucketLfu, item);
+      }
+    }
+
+    std::vector<Name> expected = getEvictionOrder(lfu);
+    std::vector<Name> actual = getEvictionOrder(bucketLfu);
+    BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Lru2KeepsReusedEntries)
+{
+  Ptr<ContentStore> lru = createContentStore("Lru", 3);
+  Ptr<ContentStore> lru2 = createContentStore("Lru2", 3);
+
+  for (Ptr<ContentStore> cs : {lru, lru2}) {
+    add(cs, 1);
+    BOOST_CHECK(lookup(cs, 1));
+    // a scan of items requested only once
+    add(cs, 2);
+    add(cs, 3);
+    add(cs, 4);
+  }
+
+  BOOST_CHECK(!lookup(lru, 1));
+  BOOST_CHECK(lookup(lru2, 1));
+  BOOST_CHECK(!lookup(lru2, 2));
+  BOOST_CHECK(lookup(lru2, 4));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
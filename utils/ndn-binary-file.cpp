@@ -0,0 +1,73 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-binary-file.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <unistd.h>
+
+namespace ns3 {
+namespace ndn {
+
+uint64_t
+getRemainingSize(std::istream& is, std::streampos end)
+{
+  if (!is) {
+    return 0;
+  }
+  std::streampos position = is.tellg();
+  return (position <= end) ? static_cast<uint64_t>(end - position) : 0;
+}
+
+uint32_t
+readCount(std::istream& is, std::streampos end, size_t itemSize)
+{
+  uint32_t count = readValue<uint32_t>(is);
+  if (!is || count > getRemainingSize(is, end) / itemSize) {
+    is.setstate(std::ios_base::failbit);
+    return 0;
+  }
+  return count;
+}
+
+bool
+writeFileAtomically(const std::string& file, const std::function<void(std::ostream&)>& write)
+{
+  std::string tmpFile = file + "." + boost::lexical_cast<std::string>(getpid());
+
+  std::ofstream os(tmpFile.c_str(), std::ios_base::out | std::ios_base::binary);
+  if (!os.is_open()) {
+    return false;
+  }
+
+  write(os);
+
+  os.close();
+  if (!os || std::rename(tmpFile.c_str(), file.c_str()) != 0) {
+    std::remove(tmpFile.c_str());
+    return false;
+  }
+  return true;
+}
+
+} // namespace ndn
+} // namespace ns3
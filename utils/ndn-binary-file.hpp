@@ -0,0 +1,90 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_BINARY_FILE_HPP
+#define NDNSIM_UTILS_NDN_BINARY_FILE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <functional>
+#include <istream>
+#include <ostream>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief Write @p value to a binary file in host byte order
+ *
+ * Files written this way are meant to be read on the same platform, e.g., by later runs of a
+ * scenario; a magic number at the start of the file detects a different byte order.
+ */
+template<typename T>
+void
+writeValue(std::ostream& os, T value)
+{
+  os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/**
+ * @brief Read a value written with writeValue
+ * @returns the value, or T() if @p is has failed
+ */
+template<typename T>
+T
+readValue(std::istream& is)
+{
+  T value = T();
+  is.read(reinterpret_cast<char*>(&value), sizeof(value));
+  return value;
+}
+
+/**
+ * @brief Number of bytes left to read from @p is, 0 if @p is has failed
+ * @param end position of the end of the file
+ */
+uint64_t
+getRemainingSize(std::istream& is, std::streampos end);
+
+/**
+ * @brief Read a uint32_t count of items, each at least @p itemSize bytes long
+ *
+ * Counts read from a damaged file may be huge.  A count that the rest of the file cannot hold
+ * fails @p is, so that nothing is allocated for it.
+ *
+ * @returns the count, or 0 if @p is has failed
+ */
+uint32_t
+readCount(std::istream& is, std::streampos end, size_t itemSize);
+
+/**
+ * @brief Write @p file in a way that concurrent readers never see a partially written file
+ *
+ * Other runs may read or write the same file.  @p write fills a private copy, which then
+ * replaces @p file in one rename.
+ *
+ * @returns whether @p file has been written
+ */
+bool
+writeFileAtomically(const std::string& file, const std::function<void(std::ostream&)>& write);
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_NDN_BINARY_FILE_HPP
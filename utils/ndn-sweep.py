@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+## -*- Mode: python; py-indent-offset: 4; indent-tabs-mode: nil; coding: utf-8; -*-
+#
+# Copyright (c) 2011-2015  Regents of the University of California.
+#
+# This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+# contributors.
+#
+# ndnSIM is free software: you can redistribute it and/or modify it under the terms
+# of the GNU General Public License as published by the Free Software Foundation,
+# either version 3 of the License, or (at your option) any later version.
+#
+# ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+# without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+# PURPOSE.  See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+# ndn-sweep.py
+
+"""Run an ndnSIM scenario over a parameter grid, several simulations at a time.
+
+ns-3 simulations are single-threaded, so independent runs of a parameter sweep are executed
+as separate processes.  Every run gets its own output directory, which is also its working
+directory, so trace helpers writing to relative file names (e.g. "rate-trace.txt") do not
+collide.  Each run is given its own RngRun value, so runs with identical parameters use
+independent random streams.
+
+After all runs finish, the tab-separated trace files found in the run directories are merged
+into OUTPUT/merged/, with the run number and parameter values prepended to every row, and a
+summary of all runs (exit status, wall-clock time, peak memory) is written to OUTPUT/runs.txt.
+
+Example (from the ns-3 folder, inside "./waf shell" so that the libraries are found):
+
+    python3 src/ndnSIM/utils/ndn-sweep.py -j 64 --output sweep-results \\
+        --param csSize=100,1000,10000 \\
+        --param strategy=/localhost/nfd/strategy/best-route,/localhost/nfd/strategy/ncc \\
+        --runs 10 \\
+        build/src/ndnSIM/examples/ns3-dev-ndn-multimedia-brite-example1-debug \\
+        --briteConfFile=$PWD/src/brite/examples/conf_files/TD_ASBarabasi_RTWaxman.conf
+
+Every combination of --param values is run --runs times; the values are passed to the
+scenario as "--name=value".  Arguments after the scenario binary are passed to every run
+unchanged; since runs do not start in the current directory, file arguments should be
+absolute paths.
+"""
+
+import argparse
+import itertools
+import os
+import subprocess
+import sys
+import threading
+import time
+
+STDOUT_FILE = 'stdout.txt'
+STDERR_FILE = 'stderr.txt'
+SUMMARY_FILE = 'runs.txt'
+MERGED_DIR = 'merged'
+
+
+class Run(object):
+    def __init__(self, index, params, rngRun, directory):
+        self.index = index
+        self.params = params
+        self.rngRun = rngRun
+        self.directory = directory
+        self.status = None
+        self.wallTime = 0.0
+        self.maxRssKb = 0
+
+
+def parseParam(text):
+    name, sep, values = text.partition('=')
+    if not sep or not name:
+        raise argparse.ArgumentTypeError("expecting NAME=VALUE[,VALUE...], got '%s'" % text)
+    return name, values.split(',')
+
+
+def makeRuns(args):
+    names = [name for name, values in args.param]
+    grid = itertools.product(*[values for name, values in args.param])
+    runs = []
+    for combination in grid:
+        for repetition in range(args.runs):
+            index = len(runs)
+            rngRun = args.first_rng_run + index
+            directory = os.path.join(args.output, 'run-%05d' % index)
+            runs.append(Run(index, list(zip(names, combination)), rngRun, directory))
+    return names, runs
+
+
+def execute(run, command):
+    os.makedirs(run.directory, exist_ok=True)
+    with open(os.path.join(run.directory, STDOUT_FILE), 'wb') as out, \
+         open(os.path.join(run.directory, STDERR_FILE), 'wb') as err:
+        begin = time.monotonic()
+        process = subprocess.Popen(command, cwd=run.directory, stdout=out, stderr=err)
+        # wait4 gives resource usage of this child alone, unlike getrusage(RUSAGE_CHILDREN)
+        pid, status, rusage = os.wait4(process.pid, 0)
+        run.wallTime = time.monotonic() - begin
+    if os.WIFSIGNALED(status):
+        run.status = -os.WTERMSIG(status)
+    else:
+        run.status = os.WEXITSTATUS(status)
+    process.returncode = run.status # already reaped
+    run.maxRssKb = rusage.ru_maxrss
+    if sys.platform == 'darwin':
+        run.maxRssKb //= 1024 # reported in bytes
+
+
+def runAll(args, runs):
+    pending = list(reversed(runs))
+    lock = threading.Lock()
+
+    def worker():
+        while True:
+            with lock:
+                if not pending:
+                    return
+                run = pending.pop()
+            command = [args.binary]
+            command += ['--%s=%s' % (name, value) for name, value in run.params]
+            command += ['--RngRun=%d' % run.rngRun]
+            command += args.scenario_args
+            execute(run, command)
+            with lock:
+                print('run %d: %s status=%d wall=%.1fs maxrss=%dKB' %
+                      (run.index, ' '.join('%s=%s' % p for p in run.params),
+                       run.status, run.wallTime, run.maxRssKb))
+                sys.stdout.flush()
+
+    threads = [threading.Thread(target=worker) for i in range(min(args.jobs, len(runs)))]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+
+def writeSummary(args, names, runs):
+    with open(os.path.join(args.output, SUMMARY_FILE), 'w') as summary:
+        summary.write('\t'.join(['Run'] + names + ['RngRun', 'Status', 'WallTime', 'MaxRssKb']))
+        summary.write('\n')
+        for run in runs:
+            fields = [str(run.index)] + [value for name, value in run.params]
+            fields += [str(run.rngRun), str(run.status), '%.3f' % run.wallTime, str(run.maxRssKb)]
+            summary.write('\t'.join(fields) + '\n')
+
+
+def mergeTraces(args, names, runs):
+    """Concatenate trace files with the same name from all runs.
+
+    Trace helpers write a header row followed by tab-separated rows; the header of the first
+    run that produced a file is kept, prefixed by the Run and parameter columns.
+    """
+    mergedDir = os.path.join(args.output, MERGED_DIR)
+    merged = {}
+    try:
+        for run in runs:
+            if not os.path.isdir(run.directory):
+                continue
+            prefix = '\t'.join([str(run.index)] + [value for name, value in run.params]) + '\t'
+            for fileName in sorted(os.listdir(run.directory)):
+                if fileName in (STDOUT_FILE, STDERR_FILE) or not fileName.endswith(args.trace_suffix):
+                    continue
+                with open(os.path.join(run.directory, fileName)) as trace:
+                    header = trace.readline()
+                    if not header:
+                        continue
+                    if fileName not in merged:
+                        os.makedirs(mergedDir, exist_ok=True)
+                        merged[fileName] = open(os.path.join(mergedDir, fileName), 'w')
+                        merged[fileName].write('\t'.join(['Run'] + names) + '\t' + header)
+                    for line in trace:
+                        merged[fileName].write(prefix + line)
+    finally:
+        for output in merged.values():
+            output.close()
+    return sorted(merged.keys())
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Run an ndnSIM scenario over a parameter grid',
+                                     formatter_class=argparse.RawDescriptionHelpFormatter,
+                                     epilog=__doc__)
+    parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count() or 1,
+                        help='number of simulations to run at a time (default: number of CPUs)')
+    parser.add_argument('-o', '--output', default='sweep-results',
+                        help='directory for per-run outputs and merged results')
+    parser.add_argument('-p', '--param', type=parseParam, action='append', default=[],
+                        metavar='NAME=V1,V2,...', help='scenario parameter and values to sweep')
+    parser.add_argument('-r', '--runs', type=int, default=1,
+                        help='number of runs per parameter combination, each with its own RngRun')
+    parser.add_argument('--first-rng-run', type=int, default=1,
+                        help='RngRun value of the first run')
+    parser.add_argument('--trace-suffix', default='.txt',
+                        help='suffix of trace files to merge (default: .txt)')
+    parser.add_argument('binary', help='scenario executable')
+    parser.add_argument('scenario_args', nargs=argparse.REMAINDER,
+                        help='arguments passed to every run')
+    args = parser.parse_args()
+
+    args.binary = os.path.abspath(args.binary)
+    if not os.access(args.binary, os.X_OK):
+        parser.error("'%s' is not an executable" % args.binary)
+    if args.jobs < 1 or args.runs < 1:
+        parser.error('--jobs and --runs must be positive')
+
+    names, runs = makeRuns(args)
+    os.makedirs(args.output, exist_ok=True)
+
+    begin = time.monotonic()
+    runAll(args, runs)
+    writeSummary(args, names, runs)
+    mergedFiles = mergeTraces(args, names, runs)
+
+    nFailed = sum(1 for run in runs if run.status != 0)
+    print('%d runs in %.1fs, %d failed; summary in %s' %
+          (len(runs), time.monotonic() - begin, nFailed, os.path.join(args.output, SUMMARY_FILE)))
+    for fileName in mergedFiles:
+        print('merged %s' % os.path.join(args.output, MERGED_DIR, fileName))
+    return 1 if nFailed > 0 else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -97,6 +97,18 @@ public:
   virtual void
   SetMobilityModel(const std::string& model);
 
+  /**
+   * \brief Assign nodes to MPI system ids automatically, ignoring system ids in the input file
+   *
+   * Nodes are partitioned by TopologyPartitioner during Read(), which balances the number of
+   * links per system and keeps links with short delays within one system.
+   *
+   * \param nPartitions number of MPI systems, usually MpiInterface::GetSize ();
+   *                    0 to use system ids from the input file (default)
+   */
+  virtual void
+  SetAutoPartitioning(uint32_t nPartitions);
+
   /**
    * \brief Apply OSPF metric on Ipv4 (if exists) and Ccnx (if exists) stacks
    */
@@ -147,6 +159,7 @@ private:
   double m_scale;
 
   uint32_t m_requiredPartitions;
+  uint32_t m_autoPartitions;
 };
 }
 
@@ -0,0 +1,403 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "topology-partitioner.hpp"
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/node-list.h"
+#include "ns3/simulator.h"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#ifdef NS3_MPI
+#include "ns3/mpi-interface.h"
+#endif
+
+#include <algorithm>
+#include <numeric>
+#include <ostream>
+
+NS_LOG_COMPONENT_DEFINE("TopologyPartitioner");
+
+namespace ns3 {
+
+namespace {
+
+class DisjointSets {
+public:
+  explicit DisjointSets(const std::vector<double>& loads)
+    : m_parent(loads.size())
+    , m_loads(loads)
+  {
+    std::iota(m_parent.begin(), m_parent.end(), 0);
+  }
+
+  uint32_t
+  Find(uint32_t i)
+  {
+    while (m_parent[i] != i) {
+      m_parent[i] = m_parent[m_parent[i]];
+      i = m_parent[i];
+    }
+    return i;
+  }
+
+  double
+  GetLoad(uint32_t root) const
+  {
+    return m_loads[root];
+  }
+
+  void
+  Union(uint32_t rootA, uint32_t rootB)
+  {
+    m_parent[rootB] = rootA;
+    m_loads[rootA] += m_loads[rootB];
+  }
+
+private:
+  std::vector<uint32_t> m_parent;
+  std::vector<double> m_loads;
+};
+
+} // namespace
+
+TopologyPartitioner::TopologyPartitioner()
+  : m_lookahead(Time::Max())
+{
+}
+
+uint32_t
+TopologyPartitioner::AddVertex(double load)
+{
+  m_loads.push_back(load);
+  m_degrees.push_back(0);
+  return m_loads.size() - 1;
+}
+
+void
+TopologyPartitioner::SetLoad(uint32_t vertex, double load)
+{
+  NS_ASSERT(vertex < m_loads.size());
+  m_loads[vertex] = load;
+}
+
+void
+TopologyPartitioner::AddEdge(uint32_t a, uint32_t b, Time delay)
+{
+  NS_ASSERT(a < m_loads.size() && b < m_loads.size());
+  if (a == b) {
+    return;
+  }
+  m_edges.push_back({a, b, delay});
+  ++m_degrees[a];
+  ++m_degrees[b];
+}
+
+double
+TopologyPartitioner::GetVertexLoad(uint32_t vertex) const
+{
+  if (m_loads[vertex] < 0) {
+    // every packet crossing a link costs events on both ends
+    return 1.0 + m_degrees[vertex];
+  }
+  return m_loads[vertex];
+}
+
+std::vector<uint32_t>
+TopologyPartitioner::Partition(uint32_t nPartitions, double imbalance)
+{
+  NS_ASSERT(nPartitions > 0);
+  uint32_t nVertices = m_loads.size();
+
+  m_partitionOf.assign(nVertices, 0);
+  m_partitionLoads.assign(nPartitions, 0.0);
+
+  double totalLoad = 0.0;
+  double maxLoad = 0.0;
+  for (uint32_t v = 0; v < nVertices; ++v) {
+    totalLoad += GetVertexLoad(v);
+    maxLoad = std::max(maxLoad, GetVertexLoad(v));
+  }
+
+  if (nPartitions == 1) {
+    m_partitionLoads[0] = totalLoad;
+    ComputeLookahead();
+    return m_partitionOf;
+  }
+
+  double budget = std::max(totalLoad / nPartitions * (1.0 + imbalance), maxLoad);
+
+  std::vector<uint32_t> clusterOf;
+  uint32_t nClusters = ClusterByDelay(budget, clusterOf);
+  PlaceClusters(clusterOf, nClusters, budget);
+  RemoveShortCuts(budget);
+  ComputeLookahead();
+
+  NS_LOG_INFO(nVertices << " nodes in " << nClusters << " clusters assigned to " << nPartitions
+                        << " partitions, lookahead " << m_lookahead.As(Time::MS));
+  return m_partitionOf;
+}
+
+uint32_t
+TopologyPartitioner::ClusterByDelay(double budget, std::vector<uint32_t>& clusterOf) const
+{
+  uint32_t nVertices = m_loads.size();
+  std::vector<double> loads(nVertices);
+  for (uint32_t v = 0; v < nVertices; ++v) {
+    loads[v] = GetVertexLoad(v);
+  }
+  DisjointSets sets(loads);
+
+  std::vector<uint32_t> order(m_edges.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [this] (uint32_t i, uint32_t j) {
+      return m_edges[i].delay < m_edges[j].delay;
+    });
+
+  for (uint32_t i : order) {
+    uint32_t rootA = sets.Find(m_edges[i].a);
+    uint32_t rootB = sets.Find(m_edges[i].b);
+    if (rootA != rootB && sets.GetLoad(rootA) + sets.GetLoad(rootB) <= budget) {
+      sets.Union(rootA, rootB);
+    }
+  }
+
+  std::vector<uint32_t> clusterOfRoot(nVertices, nVertices);
+  uint32_t nClusters = 0;
+  clusterOf.resize(nVertices);
+  for (uint32_t v = 0; v < nVertices; ++v) {
+    uint32_t root = sets.Find(v);
+    if (clusterOfRoot[root] == nVertices) {
+      clusterOfRoot[root] = nClusters++;
+    }
+    clusterOf[v] = clusterOfRoot[root];
+  }
+  return nClusters;
+}
+
+void
+TopologyPartitioner::PlaceClusters(const std::vector<uint32_t>& clusterOf, uint32_t nClusters,
+                                   double budget)
+{
+  uint32_t nVertices = m_loads.size();
+  uint32_t nPartitions = m_partitionLoads.size();
+
+  std::vector<double> clusterLoads(nClusters, 0.0);
+  std::vector<std::vector<uint32_t>> members(nClusters);
+  double totalLoad = 0.0;
+  for (uint32_t v = 0; v < nVertices; ++v) {
+    clusterLoads[clusterOf[v]] += GetVertexLoad(v);
+    members[clusterOf[v]].push_back(v);
+    totalLoad += GetVertexLoad(v);
+  }
+  double evenShare = totalLoad / nPartitions;
+
+  std::vector<std::vector<uint32_t>> edgesOf(nVertices);
+  for (uint32_t i = 0; i < m_edges.size(); ++i) {
+    edgesOf[m_edges[i].a].push_back(i);
+    edgesOf[m_edges[i].b].push_back(i);
+  }
+
+  std::vector<uint32_t> order(nClusters);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&clusterLoads] (uint32_t i, uint32_t j) {
+      return clusterLoads[i] > clusterLoads[j];
+    });
+
+  const uint32_t UNPLACED = nPartitions;
+  std::fill(m_partitionOf.begin(), m_partitionOf.end(), UNPLACED);
+
+  for (uint32_t cluster : order) {
+    // coupling to already placed clusters: shorter links weigh more
+    std::vector<double> coupling(nPartitions, 0.0);
+    for (uint32_t v : members[cluster]) {
+      for (uint32_t i : edgesOf[v]) {
+        uint32_t other = m_edges[i].a == v ? m_edges[i].b : m_edges[i].a;
+        if (m_partitionOf[other] != UNPLACED) {
+          coupling[m_partitionOf[other]] += 1.0 / (m_edges[i].delay.GetSeconds() + 1e-9);
+        }
+      }
+    }
+
+    // prefer ranks that stay within an even share, so that the last ranks are not starved
+    uint32_t best = UNPLACED;
+    for (double limit : {evenShare, budget}) {
+      for (uint32_t p = 0; p < nPartitions; ++p) {
+        if (m_partitionLoads[p] + clusterLoads[cluster] > limit) {
+          continue;
+        }
+        if (best == UNPLACED || coupling[p] > coupling[best] ||
+            (coupling[p] == coupling[best] && m_partitionLoads[p] < m_partitionLoads[best])) {
+          best = p;
+        }
+      }
+      if (best != UNPLACED) {
+        break;
+      }
+    }
+    if (best == UNPLACED) {
+      best = std::min_element(m_partitionLoads.begin(), m_partitionLoads.end()) -
+             m_partitionLoads.begin();
+    }
+
+    for (uint32_t v : members[cluster]) {
+      m_partitionOf[v] = best;
+    }
+    m_partitionLoads[best] += clusterLoads[cluster];
+  }
+}
+
+void
+TopologyPartitioner::RemoveShortCuts(double budget)
+{
+  uint32_t nVertices = m_loads.size();
+  std::vector<std::vector<uint32_t>> edgesOf(nVertices);
+  for (uint32_t i = 0; i < m_edges.size(); ++i) {
+    edgesOf[m_edges[i].a].push_back(i);
+    edgesOf[m_edges[i].b].push_back(i);
+  }
+
+  // whether moving vertex v into partition p keeps v's load within budget and does not
+  // introduce a cross-rank link of delay shorter than or equal to minDelay
+  auto canMove = [&] (uint32_t v, uint32_t p, Time minDelay) {
+    if (m_partitionLoads[p] + GetVertexLoad(v) > budget) {
+      return false;
+    }
+    for (uint32_t i : edgesOf[v]) {
+      uint32_t other = m_edges[i].a == v ? m_edges[i].b : m_edges[i].a;
+      if (m_partitionOf[other] != p && m_edges[i].delay <= minDelay) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  auto move = [&] (uint32_t v, uint32_t p) {
+    m_partitionLoads[m_partitionOf[v]] -= GetVertexLoad(v);
+    m_partitionLoads[p] += GetVertexLoad(v);
+    m_partitionOf[v] = p;
+  };
+
+  for (uint32_t iteration = 0; iteration < 2 * nVertices; ++iteration) {
+    const Edge* shortest = nullptr;
+    for (const Edge& edge : m_edges) {
+      if (m_partitionOf[edge.a] != m_partitionOf[edge.b] &&
+          (shortest == nullptr || edge.delay < shortest->delay)) {
+        shortest = &edge;
+      }
+    }
+    if (shortest == nullptr) {
+      return;
+    }
+
+    if (canMove(shortest->a, m_partitionOf[shortest->b], shortest->delay)) {
+      move(shortest->a, m_partitionOf[shortest->b]);
+    }
+    else if (canMove(shortest->b, m_partitionOf[shortest->a], shortest->delay)) {
+      move(shortest->b, m_partitionOf[shortest->a]);
+    }
+    else {
+      return;
+    }
+  }
+}
+
+void
+TopologyPartitioner::ComputeLookahead()
+{
+  m_lookahead = Time::Max();
+  for (const Edge& edge : m_edges) {
+    if (m_partitionOf[edge.a] != m_partitionOf[edge.b]) {
+      m_lookahead = std::min(m_lookahead, edge.delay);
+    }
+  }
+}
+
+Time
+TopologyPartitioner::GetLookahead() const
+{
+  return m_lookahead;
+}
+
+const std::vector<double>&
+TopologyPartitioner::GetPartitionLoads() const
+{
+  return m_partitionLoads;
+}
+
+void
+TopologyPartitioner::Print(std::ostream& os) const
+{
+  std::vector<uint32_t> nNodes(m_partitionLoads.size(), 0);
+  for (uint32_t p : m_partitionOf) {
+    ++nNodes[p];
+  }
+  uint32_t nCut = 0;
+  for (const Edge& edge : m_edges) {
+    nCut += m_partitionOf[edge.a] != m_partitionOf[edge.b];
+  }
+
+  os << "Partition\tNodes\tExpectedLoad\n";
+  for (uint32_t p = 0; p < m_partitionLoads.size(); ++p) {
+    os << p << "\t" << nNodes[p] << "\t" << m_partitionLoads[p] << "\n";
+  }
+  os << "Cross-rank links: " << nCut << " of " << m_edges.size();
+  if (nCut > 0) {
+    os << ", lookahead " << m_lookahead.As(Time::MS);
+  }
+  os << "\n";
+}
+
+void
+TopologyPartitioner::PrintRankLoad(std::ostream& os)
+{
+  // without the mpi module (see NS3_MPI in wscript) every node belongs to system 0
+  uint32_t systemId = 0;
+#ifdef NS3_MPI
+  if (MpiInterface::IsEnabled()) {
+    systemId = MpiInterface::GetSystemId();
+  }
+#endif
+
+  uint32_t nNodes = 0;
+  uint64_t nPackets = 0;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); ++node) {
+    if ((*node)->GetSystemId() != systemId) {
+      continue;
+    }
+    ++nNodes;
+
+    Ptr<ndn::L3Protocol> l3 = (*node)->GetObject<ndn::L3Protocol>();
+    if (l3 == nullptr) {
+      continue;
+    }
+    const nfd::ForwarderCounters& counters = l3->getForwarder()->getCounters();
+    nPackets += counters.getNInInterests() + counters.getNInDatas() +
+                counters.getNOutInterests() + counters.getNOutDatas();
+  }
+
+  os << "Rank\tNodes\tNdnPackets\tSimTime\n"
+     << systemId << "\t" << nNodes << "\t" << nPackets << "\t"
+     << Simulator::Now().As(Time::S) << std::endl;
+}
+
+} // namespace ns3
@@ -0,0 +1,144 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_TOPOLOGY_PARTITIONER_HPP
+#define NDNSIM_TOPOLOGY_PARTITIONER_HPP
+
+#include "ns3/nstime.h"
+
+#include <iosfwd>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \brief Assigns nodes of a point-to-point topology to MPI ranks (system ids)
+ *
+ * Partitioning has two goals: each rank should process a similar share of the simulation
+ * events, and links crossing ranks should have delays as long as possible, because the
+ * smallest cross-rank delay is the lookahead of the distributed simulator and bounds how far
+ * ranks can advance without synchronizing.
+ *
+ * Links are considered in order of increasing delay, and their endpoints are clustered
+ * together as long as the cluster stays within the load budget of one rank, so short links
+ * end up inside ranks.  Clusters are then placed onto ranks, largest first, preferring the
+ * rank they are most tightly coupled with, and finally the shortest cross-rank links are
+ * removed by moving single nodes where the load budget allows.
+ *
+ * Since ns-3 fixes the system id of a node at construction, the partitioner works on
+ * vertex indices and must run before nodes are created.
+ */
+class TopologyPartitioner {
+public:
+  TopologyPartitioner();
+
+  /**
+   * \brief Add a vertex
+   * \param load expected event load; if negative, 1 + degree of the vertex is used
+   * \return index of the new vertex
+   */
+  uint32_t
+  AddVertex(double load = -1.0);
+
+  /**
+   * \brief Set expected event load of a vertex, e.g. higher for nodes running applications
+   */
+  void
+  SetLoad(uint32_t vertex, double load);
+
+  /**
+   * \brief Add a link between vertices \p a and \p b with propagation \p delay
+   */
+  void
+  AddEdge(uint32_t a, uint32_t b, Time delay);
+
+  /**
+   * \brief Compute the partitioning
+   * \param nPartitions number of MPI ranks
+   * \param imbalance tolerated excess load of a rank, relative to an even split
+   * \return system id of every vertex
+   */
+  std::vector<uint32_t>
+  Partition(uint32_t nPartitions, double imbalance = 0.05);
+
+  /**
+   * \brief Get the smallest delay of a cross-rank link in the last partitioning
+   * \return Time::Max () if no link crosses ranks
+   */
+  Time
+  GetLookahead() const;
+
+  /**
+   * \brief Get the load assigned to every rank in the last partitioning
+   */
+  const std::vector<double>&
+  GetPartitionLoads() const;
+
+  /**
+   * \brief Print a summary of the last partitioning
+   */
+  void
+  Print(std::ostream& os) const;
+
+  /**
+   * \brief Print the number of nodes and NDN packets processed by this rank
+   *
+   * Should be called after Simulator::Run on every rank, to compare the actual event load
+   * of the ranks with the load expected by the partitioning.  When MPI is not enabled, all
+   * nodes are reported as rank 0.
+   */
+  static void
+  PrintRankLoad(std::ostream& os);
+
+private:
+  struct Edge
+  {
+    uint32_t a;
+    uint32_t b;
+    Time delay;
+  };
+
+  double
+  GetVertexLoad(uint32_t vertex) const;
+
+  uint32_t
+  ClusterByDelay(double budget, std::vector<uint32_t>& clusterOf) const;
+
+  void
+  PlaceClusters(const std::vector<uint32_t>& clusterOf, uint32_t nClusters, double budget);
+
+  void
+  RemoveShortCuts(double budget);
+
+  void
+  ComputeLookahead();
+
+private:
+  std::vector<double> m_loads;
+  std::vector<uint32_t> m_degrees;
+  std::vector<Edge> m_edges;
+
+  std::vector<uint32_t> m_partitionOf;
+  std::vector<double> m_partitionLoads;
+  Time m_lookahead;
+};
+
+} // namespace ns3
+
+#endif // NDNSIM_TOPOLOGY_PARTITIONER_HPP
@@ -28,6 +28,7 @@
 #include "ns3/simulator.h"
 #include "ns3/node-list.h"
 #include "ns3/log.h"
+#include "helper/ndn-mpi-helper.hpp"
 
 #include <boost/lexical_cast.hpp>
 #include <boost/make_shared.hpp>
@@ -58,7 +59,7 @@ AppDelayTracer::InstallAll(const std::string& file)
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(MpiHelper::GetRankFileName(file).c_str(), std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -72,6 +73,9 @@ AppDelayTracer::InstallAll(const std::string& file)
   }
 
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    if (!MpiHelper::IsLocal(*node))
+      continue;
+
     Ptr<AppDelayTracer> trace = Install(*node, outputStream);
     tracers.push_back(trace);
   }
@@ -95,7 +99,7 @@ AppDelayTracer::Install(const NodeContainer& nodes, const std::string& file)
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(MpiHelper::GetRankFileName(file).c_str(), std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -109,6 +113,9 @@ AppDelayTracer::Install(const NodeContainer& nodes, const std::string& file)
   }
 
   for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    if (!MpiHelper::IsLocal(*node))
+      continue;
+
     Ptr<AppDelayTracer> trace = Install(*node, outputStream);
     tracers.push_back(trace);
   }
@@ -132,7 +139,7 @@ AppDelayTracer::Install(Ptr<Node> node, const std::string& file)
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(MpiHelper::GetRankFileName(file).c_str(), std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -145,8 +152,10 @@ AppDelayTracer::Install(Ptr<Node> node, const std::string& file)
     outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
   }
 
-  Ptr<AppDelayTracer> trace = Install(node, outputStream);
-  tracers.push_back(trace);
+  if (MpiHelper::IsLocal(node)) {
+    Ptr<AppDelayTracer> trace = Install(node, outputStream);
+    tracers.push_back(trace);
+  }
 
   if (tracers.size() > 0) {
     // *m_l3RateTrace << "# "; // not necessary for R's read.table
@@ -30,6 +30,7 @@
 #include "ns3/simulator.h"
 #include "ns3/node-list.h"
 #include "ns3/log.h"
+#include "helper/ndn-mpi-helper.hpp"
 
 #include <boost/lexical_cast.hpp>
 #include <boost/make_shared.hpp>
@@ -60,7 +61,7 @@ DASHPlayerTracer::InstallAll(const std::string& file)
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(MpiHelper::GetRankFileName(file).c_str(), std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -74,6 +75,9 @@ DASHPlayerTracer::InstallAll(const std::string& file)
   }
 
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    if (!MpiHelper::IsLocal(*node))
+      continue;
+
     Ptr<DASHPlayerTracer> trace = Install(*node, outputStream);
     tracers.push_back(trace);
   }
@@ -97,7 +101,7 @@ DASHPlayerTracer::Install(const NodeContainer& nodes, const std::string& file)
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(MpiHelper::GetRankFileName(file).c_str(), std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -111,6 +115,9 @@ DASHPlayerTracer::Install(const NodeContainer& nodes, const std::string& file)
   }
 
   for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    if (!MpiHelper::IsLocal(*node))
+      continue;
+
     Ptr<DASHPlayerTracer> trace = Install(*node, outputStream);
     tracers.push_back(trace);
   }
@@ -134,7 +141,7 @@ DASHPlayerTracer::Install(Ptr<Node> node, const std::string& file)
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(MpiHelper::GetRankFileName(file).c_str(), std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -147,8 +154,10 @@ DASHPlayerTracer::Install(Ptr<Node> node, const std::string& file)
     outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
   }
 
-  Ptr<DASHPlayerTracer> trace = Install(node, outputStream);
-  tracers.push_back(trace);
+  if (MpiHelper::IsLocal(node)) {
+    Ptr<DASHPlayerTracer> trace = Install(node, outputStream);
+    tracers.push_back(trace);
+  }
 
   if (tracers.size() > 0) {
     // *m_l3RateTrace << "# "; // not necessary for R's read.table
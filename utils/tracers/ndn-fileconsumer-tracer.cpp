@@ -29,6 +29,7 @@
 #include "ns3/simulator.h"
 #include "ns3/node-list.h"
 #include "ns3/log.h"
+#include "helper/ndn-mpi-helper.hpp"
 
 #include <boost/lexical_cast.hpp>
 #include <boost/make_shared.hpp>
@@ -59,7 +60,7 @@ FileConsumerTracer::InstallAll(const std::string& file)
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(MpiHelper::GetRankFileName(file).c_str(), std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -73,6 +74,9 @@ FileConsumerTracer::InstallAll(const std::string& file)
   }
 
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    if (!MpiHelper::IsLocal(*node))
+      continue;
+
     Ptr<FileConsumerTracer> trace = Install(*node, outputStream);
     tracers.push_back(trace);
   }
@@ -96,7 +100,7 @@ FileConsumerTracer::Install(const NodeContainer& nodes, const std::string& file)
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(MpiHelper::GetRankFileName(file).c_str(), std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -110,6 +114,9 @@ FileConsumerTracer::Install(const NodeContainer& nodes, const std::string& file)
   }
 
   for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    if (!MpiHelper::IsLocal(*node))
+      continue;
+
     Ptr<FileConsumerTracer> trace = Install(*node, outputStream);
     tracers.push_back(trace);
   }
@@ -133,7 +140,7 @@ FileConsumerTracer::Install(Ptr<Node> node, const std::string& file)
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(MpiHelper::GetRankFileName(file).c_str(), std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -146,8 +153,10 @@ FileConsumerTracer::Install(Ptr<Node> node, const std::string& file)
     outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
   }
 
-  Ptr<FileConsumerTracer> trace = Install(node, outputStream);
-  tracers.push_back(trace);
+  if (MpiHelper::IsLocal(node)) {
+    Ptr<FileConsumerTracer> trace = Install(node, outputStream);
+    tracers.push_back(trace);
+  }
 
   if (tracers.size() > 0) {
     // *m_l3RateTrace << "# "; // not necessary for R's read.table
@@ -27,6 +27,7 @@
 #include "ns3/node-list.h"
 
 #include "daemon/table/pit-entry.hpp"
+#include "helper/ndn-mpi-helper.hpp"
 
 #include <fstream>
 #include <boost/lexical_cast.hpp>
@@ -52,7 +53,7 @@ L3RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seco
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(MpiHelper::GetRankFileName(file).c_str(), std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -66,6 +67,9 @@ L3RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seco
   }
 
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    if (!MpiHelper::IsLocal(*node))
+      continue;
+
     Ptr<L3RateTracer> trace = Install(*node, outputStream, averagingPeriod);
     tracers.push_back(trace);
   }
@@ -90,7 +94,7 @@ L3RateTracer::Install(const NodeContainer& nodes, const std::string& file,
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(MpiHelper::GetRankFileName(file).c_str(), std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -104,6 +108,9 @@ L3RateTracer::Install(const NodeContainer& nodes, const std::string& file,
   }
 
   for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    if (!MpiHelper::IsLocal(*node))
+      continue;
+
     Ptr<L3RateTracer> trace = Install(*node, outputStream, averagingPeriod);
     tracers.push_back(trace);
   }
@@ -128,7 +135,7 @@ L3RateTracer::Install(Ptr<Node> node, const std::string& file,
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(MpiHelper::GetRankFileName(file).c_str(), std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -141,8 +148,10 @@ L3RateTracer::Install(Ptr<Node> node, const std::string& file,
     outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
   }
 
-  Ptr<L3RateTracer> trace = Install(node, outputStream, averagingPeriod);
-  tracers.push_back(trace);
+  if (MpiHelper::IsLocal(node)) {
+    Ptr<L3RateTracer> trace = Install(node, outputStream, averagingPeriod);
+    tracers.push_back(trace);
+  }
 
   if (tracers.size() > 0) {
     // *m_l3RateTrace << "# "; // not necessary for R's read.table
@@ -0,0 +1,260 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef BUCKET_LFU_POLICY_H_
+#define BUCKET_LFU_POLICY_H_
+
+/// @cond include_hidden
+
+#include <boost/intrusive/options.hpp>
+#include <boost/intrusive/list.hpp>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Traits for LFU replacement policy with constant-time operations
+ *
+ * Evicts the same entries as lfu_policy_traits: the least frequently used first and, among
+ * entries used equally often, the one that reached this frequency first.  Instead of sorting
+ * entries by frequency, the policy list is divided into buckets of entries with equal
+ * frequency, in the order of increasing frequency.  A hit moves an entry to the end of the
+ * next bucket, so all operations take O(1) time.
+ */
+struct bucket_lfu_policy_traits {
+  /// @brief Name that can be used to identify the policy (for NS-3 object model and logging)
+  static std::string
+  GetName()
+  {
+    return "BucketLfu";
+  }
+
+  /// @brief Entries with the same frequency, a contiguous range of the policy list
+  struct bucket : public boost::intrusive::list_base_hook<> {
+    uint64_t frequency;
+    size_t size;
+    void* first; ///< first entry of the bucket in the policy list
+  };
+
+  struct policy_hook_type : public boost::intrusive::list_member_hook<> {
+    bucket* frequencyBucket;
+  };
+
+  template<class Container>
+  struct container_hook {
+    typedef boost::intrusive::member_hook<Container, policy_hook_type, &Container::policy_hook_>
+      type;
+  };
+
+  template<class Base, class Container, class Hook>
+  struct policy {
+    typedef typename boost::intrusive::list<Container, Hook> policy_container;
+    typedef boost::intrusive::list<bucket> bucket_list;
+
+    static bucket*&
+    get_bucket(typename Container::iterator item)
+    {
+      return static_cast<policy_hook_type*>(policy_container::value_traits::to_node_ptr(*item))
+        ->frequencyBucket;
+    }
+
+    static const bucket*
+    get_bucket(typename Container::const_iterator item)
+    {
+      return static_cast<const policy_hook_type*>(
+               policy_container::value_traits::to_node_ptr(*item))->frequencyBucket;
+    }
+
+    class type : public policy_container {
+    public:
+      typedef policy policy_base; // to get access to get_bucket methods from outside
+      typedef Container parent_trie;
+
+      type(Base& base)
+        : base_(base)
+        , max_size_(100)
+      {
+      }
+
+      ~type()
+      {
+        buckets_.clear_and_dispose(bucket_deleter());
+        spare_buckets_.clear_and_dispose(bucket_deleter());
+      }
+
+      inline void
+      update(typename parent_trie::iterator item)
+      {
+        promote(item);
+      }
+
+      inline bool
+      insert(typename parent_trie::iterator item)
+      {
+        if (max_size_ != 0 && policy_container::size() >= max_size_) {
+          // this erases the "least frequently used item" from cache
+          base_.erase(&(*policy_container::begin()));
+        }
+
+        typename bucket_list::iterator first = buckets_.begin();
+        if (first == buckets_.end() || first->frequency != 0) {
+          first = buckets_.insert(first, make_bucket(0));
+        }
+        attach(item, first);
+        return true;
+      }
+
+      inline void
+      lookup(typename parent_trie::iterator item)
+      {
+        promote(item);
+      }
+
+      inline void
+      erase(typename parent_trie::iterator item)
+      {
+        detach(item);
+      }
+
+      inline void
+      clear()
+      {
+        policy_container::clear();
+        while (!buckets_.empty()) {
+          bucket& b = buckets_.front();
+          buckets_.pop_front();
+          spare_buckets_.push_back(b);
+        }
+      }
+
+      inline void
+      set_max_size(size_t max_size)
+      {
+        max_size_ = max_size;
+      }
+
+      inline size_t
+      get_max_size() const
+      {
+        return max_size_;
+      }
+
+    private:
+      struct bucket_deleter {
+        void
+        operator()(bucket* b) const
+        {
+          delete b;
+        }
+      };
+
+      bucket&
+      make_bucket(uint64_t frequency)
+      {
+        bucket* b = nullptr;
+        if (!spare_buckets_.empty()) {
+          b = &spare_buckets_.front();
+          spare_buckets_.pop_front();
+        }
+        else {
+          b = new bucket;
+        }
+        b->frequency = frequency;
+        b->size = 0;
+        b->first = nullptr;
+        return *b;
+      }
+
+      /**
+       * @brief Move @p item to the end of the bucket with the next higher frequency
+       */
+      void
+      promote(typename parent_trie::iterator item)
+      {
+        typename bucket_list::iterator current = bucket_list::s_iterator_to(*get_bucket(item));
+        typename bucket_list::iterator next = current;
+        ++next;
+        if (next == buckets_.end() || next->frequency != current->frequency + 1) {
+          next = buckets_.insert(next, make_bucket(current->frequency + 1));
+        }
+
+        detach(item);
+        attach(item, next);
+      }
+
+      /**
+       * @brief Append @p item to the range of bucket @p b in the policy list
+       */
+      void
+      attach(typename parent_trie::iterator item, typename bucket_list::iterator b)
+      {
+        typename bucket_list::iterator next = b;
+        ++next;
+        typename policy_container::iterator position =
+          (next == buckets_.end()) ? policy_container::end()
+                                   : policy_container::iterator_to(
+                                       *static_cast<Container*>(next->first));
+        policy_container::insert(position, *item);
+
+        if (b->size == 0) {
+          b->first = &(*item);
+        }
+        b->size++;
+        get_bucket(item) = &(*b);
+      }
+
+      void
+      detach(typename parent_trie::iterator item)
+      {
+        bucket* b = get_bucket(item);
+        typename policy_container::iterator i = policy_container::iterator_to(*item);
+        if (b->size > 1 && b->first == &(*item)) {
+          typename policy_container::iterator next = i;
+          ++next;
+          b->first = &(*next);
+        }
+        policy_container::erase(i);
+
+        if (--b->size == 0) {
+          buckets_.erase(bucket_list::s_iterator_to(*b));
+          spare_buckets_.push_back(*b);
+        }
+      }
+
+    private:
+      type()
+        : base_(*((Base*)0)){};
+
+    private:
+      Base& base_;
+      size_t max_size_;
+      bucket_list buckets_;       ///< in the order of increasing frequency
+      bucket_list spare_buckets_; ///< released buckets, to be reused
+    };
+  };
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // BUCKET_LFU_POLICY_H_
@@ -0,0 +1,662 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef COMPRESSED_TRIE_H_
+#define COMPRESSED_TRIE_H_
+
+/// @cond include_hidden
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+template<class Trie>
+class compressed_trie_iterator;
+
+/**
+ * @brief Path-compressed trie with the interface of trie
+ *
+ * A node stores the whole run of components leading to it from its parent (the edge label),
+ * so chains of nodes with a single child and no payload are not materialized.  Nodes that
+ * hold a payload are never moved or merged, and iterators to them stay valid until their
+ * payload is erased.
+ *
+ * Children are kept in a flat open-addressing table indexed by the first component of their
+ * label, allocated only when a node has children and doubled when it is 3/4 full.
+ */
+template<typename FullKey, typename PayloadTraits, typename PolicyHook>
+class compressed_trie {
+public:
+  typedef typename FullKey::value_type Key;
+
+  typedef compressed_trie* iterator;
+  typedef const compressed_trie* const_iterator;
+
+  typedef compressed_trie_iterator<compressed_trie> recursive_iterator;
+  typedef compressed_trie_iterator<const compressed_trie> const_recursive_iterator;
+
+  typedef PayloadTraits payload_traits;
+
+  /**
+   * @brief Create the root node
+   *
+   * Bucket parameters are accepted for compatibility with trie and are ignored, as child
+   * tables grow geometrically.
+   */
+  explicit compressed_trie(const Key& key, size_t bucketSize = 1, size_t bucketIncrement = 1)
+    : key_(key)
+    , hash_(boost::hash_value(key_))
+    , nChildren_(0)
+    , capacity_(0)
+    , payload_(PayloadTraits::empty_payload)
+    , parent_(nullptr)
+  {
+  }
+
+  ~compressed_trie()
+  {
+    payload_ = PayloadTraits::empty_payload; // necessary for smart pointers...
+    clear();
+  }
+
+  void
+  clear()
+  {
+    for (size_t i = 0; i < capacity_; ++i) {
+      delete children_[i];
+    }
+    children_.reset();
+    nChildren_ = 0;
+    capacity_ = 0;
+  }
+
+  inline std::pair<iterator, bool>
+  insert(const FullKey& key, typename PayloadTraits::insert_type payload)
+  {
+    compressed_trie* trieNode = this;
+
+    typename FullKey::const_iterator i = key.begin();
+    while (i != key.end()) {
+      compressed_trie* child = trieNode->find_child(*i);
+      if (child == nullptr) {
+        child = new compressed_trie(i, key.end());
+        trieNode->add_child(child);
+        trieNode = child;
+        break;
+      }
+
+      size_t matched = child->match(i, key.end());
+      i += matched;
+      if (matched < child->label_size()) {
+        child = child->split(matched);
+      }
+      trieNode = child;
+    }
+
+    if (trieNode->payload_ == PayloadTraits::empty_payload) {
+      trieNode->payload_ = payload;
+      return std::make_pair(trieNode, true);
+    }
+    else
+      return std::make_pair(trieNode, false);
+  }
+
+  /**
+   * @brief Removes payload (if it exists) and prunes the trie
+   */
+  inline iterator
+  erase()
+  {
+    payload_ = PayloadTraits::empty_payload;
+    return prune();
+  }
+
+  /**
+   * @brief Do exactly as erase, but without erasing the payload
+   *
+   * A node without payload is removed if it has no children, or merged into its only child.
+   * @returns the node that took the place of this node, or the closest remaining ancestor
+   */
+  inline iterator
+  prune()
+  {
+    if (payload_ != PayloadTraits::empty_payload || parent_ == nullptr) {
+      return this;
+    }
+
+    compressed_trie* parent = parent_;
+    if (nChildren_ == 0) {
+      parent->remove_child(this);
+      delete this; // basically, committing a suicide
+      return parent->prune();
+    }
+
+    if (nChildren_ == 1) {
+      compressed_trie* child = nullptr;
+      for (size_t i = 0; child == nullptr; ++i) {
+        child = children_[i];
+      }
+      children_[child->slot()] = nullptr;
+      nChildren_ = 0;
+
+      // prepend the label of this node to the label of its child
+      child->tail_.insert(child->tail_.begin(), child->key_);
+      child->tail_.insert(child->tail_.begin(), tail_.begin(), tail_.end());
+      child->key_ = key_;
+      child->hash_ = hash_;
+      child->parent_ = parent;
+      parent->children_[slot()] = child;
+
+      delete this;
+      return child;
+    }
+
+    return this;
+  }
+
+  /**
+   * @brief Perform the longest prefix match
+   * @param key the key for which to perform the longest prefix match
+   *
+   * @return ->second is true if prefix in ->first is longer than key
+   *
+   * If @p key ends inside the label of a node, that node is returned in ->third
+   */
+  inline std::tuple<iterator, bool, iterator>
+  find(const FullKey& key)
+  {
+    return find_if(key, any_payload());
+  }
+
+  /**
+   * @brief Perform the longest prefix match satisfying preficate
+   * @param key the key for which to perform the longest prefix match
+   *
+   * @return ->second is true if prefix in ->first is longer than key
+   */
+  template<class Predicate>
+  inline std::tuple<iterator, bool, iterator>
+  find_if(const FullKey& key, Predicate pred)
+  {
+    compressed_trie* trieNode = this;
+    iterator foundNode = (payload_ != PayloadTraits::empty_payload && pred(payload_)) ? this : 0;
+    bool reachLast = true;
+
+    typename FullKey::const_iterator i = key.begin();
+    while (i != key.end()) {
+      compressed_trie* child = trieNode->find_child(*i);
+      if (child == nullptr) {
+        reachLast = false;
+        break;
+      }
+
+      size_t matched = child->match(i, key.end());
+      i += matched;
+      if (matched < child->label_size()) {
+        // key either ends inside the label of child or diverges from it
+        if (i == key.end()) {
+          trieNode = child;
+        }
+        else {
+          reachLast = false;
+        }
+        break;
+      }
+
+      trieNode = child;
+      if (trieNode->payload_ != PayloadTraits::empty_payload && pred(trieNode->payload_)) {
+        foundNode = trieNode;
+      }
+    }
+
+    return std::make_tuple(foundNode, reachLast, trieNode);
+  }
+
+  /**
+   * @brief Find the node for exactly @p key
+   * @returns the node (with or without payload) or end()
+   */
+  inline iterator
+  find_exact(const FullKey& key)
+  {
+    compressed_trie* trieNode = this;
+
+    typename FullKey::const_iterator i = key.begin();
+    while (i != key.end()) {
+      trieNode = trieNode->find_child(*i);
+      if (trieNode == nullptr) {
+        return 0;
+      }
+
+      size_t matched = trieNode->match(i, key.end());
+      if (matched < trieNode->label_size()) {
+        return 0;
+      }
+      i += matched;
+    }
+    return trieNode;
+  }
+
+  /**
+   * @brief Find next payload of the sub-trie
+   * @returns end() or a valid iterator pointing to the trie leaf (order is not defined)
+   */
+  inline iterator
+  find()
+  {
+    if (payload_ != PayloadTraits::empty_payload)
+      return this;
+
+    for (size_t i = 0; i < capacity_; ++i) {
+      if (children_[i] != nullptr) {
+        iterator value = children_[i]->find();
+        if (value != 0)
+          return value;
+      }
+    }
+    return 0;
+  }
+
+  /**
+   * @brief Find next payload of the sub-trie satisfying the predicate
+   * @param pred predicate
+   * @returns end() or a valid iterator pointing to the trie leaf (order is not defined)
+   */
+  template<class Predicate>
+  inline iterator
+  find_if(Predicate pred)
+  {
+    if (payload_ != PayloadTraits::empty_payload && pred(payload_))
+      return this;
+
+    for (size_t i = 0; i < capacity_; ++i) {
+      if (children_[i] != nullptr) {
+        iterator value = children_[i]->find_if(pred);
+        if (value != 0)
+          return value;
+      }
+    }
+    return 0;
+  }
+
+  /**
+   * @brief Find next payload of the sub-trie, checking predicate only for the component that
+   *        follows this node
+   */
+  template<class Predicate>
+  inline iterator
+  find_if_next_level(Predicate pred)
+  {
+    for (size_t i = 0; i < capacity_; ++i) {
+      if (children_[i] != nullptr && pred(children_[i]->key())) {
+        return children_[i]->find();
+      }
+    }
+    return 0;
+  }
+
+  /**
+   * @brief Find next payload with prefix @p key, checking predicate only for the component that
+   *        follows @p key
+   */
+  template<class Predicate>
+  inline iterator
+  find_if_next_level(const FullKey& key, Predicate pred)
+  {
+    compressed_trie* trieNode = this;
+
+    typename FullKey::const_iterator i = key.begin();
+    while (i != key.end()) {
+      trieNode = trieNode->find_child(*i);
+      if (trieNode == nullptr) {
+        return 0;
+      }
+
+      size_t matched = trieNode->match(i, key.end());
+      i += matched;
+      if (matched < trieNode->label_size()) {
+        if (i == key.end() && pred(trieNode->label_at(matched))) {
+          return trieNode->find();
+        }
+        return 0;
+      }
+    }
+    return trieNode->find_if_next_level(pred);
+  }
+
+  iterator
+  end()
+  {
+    return 0;
+  }
+
+  const_iterator
+  end() const
+  {
+    return 0;
+  }
+
+  typename PayloadTraits::const_return_type
+  payload() const
+  {
+    return payload_;
+  }
+
+  typename PayloadTraits::return_type
+  payload()
+  {
+    return payload_;
+  }
+
+  void
+  set_payload(typename PayloadTraits::insert_type payload)
+  {
+    payload_ = payload;
+  }
+
+  /**
+   * @brief First component of the label of the node
+   */
+  const Key&
+  key() const
+  {
+    return key_;
+  }
+
+private:
+  compressed_trie(typename FullKey::const_iterator begin, typename FullKey::const_iterator end)
+    : key_(*begin)
+    , tail_(begin + 1, end)
+    , hash_(boost::hash_value(key_))
+    , nChildren_(0)
+    , capacity_(0)
+    , payload_(PayloadTraits::empty_payload)
+    , parent_(nullptr)
+  {
+  }
+
+  size_t
+  label_size() const
+  {
+    return tail_.size() + 1;
+  }
+
+  const Key&
+  label_at(size_t i) const
+  {
+    return i == 0 ? key_ : tail_[i - 1];
+  }
+
+  /**
+   * @brief Number of leading components of the label equal to [begin, end)
+   * @pre *begin == key_
+   */
+  size_t
+  match(typename FullKey::const_iterator begin, typename FullKey::const_iterator end) const
+  {
+    size_t matched = 1;
+    for (++begin; begin != end && matched < label_size(); ++begin, ++matched) {
+      if (!(*begin == tail_[matched - 1])) {
+        break;
+      }
+    }
+    return matched;
+  }
+
+  /**
+   * @brief Insert a node without payload for the first @p length components of the label
+   * @returns the new node, which takes the place of this node in the parent
+   */
+  compressed_trie*
+  split(size_t length)
+  {
+    compressed_trie* upper = new compressed_trie(key_);
+    upper->tail_.assign(tail_.begin(), tail_.begin() + (length - 1));
+    upper->parent_ = parent_;
+    parent_->children_[slot()] = upper; // same first component, same slot
+
+    key_ = tail_[length - 1];
+    hash_ = boost::hash_value(key_);
+    tail_.erase(tail_.begin(), tail_.begin() + length);
+    upper->add_child(this);
+    return upper;
+  }
+
+  compressed_trie*
+  find_child(const Key& key) const
+  {
+    if (nChildren_ == 0) {
+      return nullptr;
+    }
+
+    size_t hash = boost::hash_value(key);
+    for (size_t i = hash & (capacity_ - 1);; i = (i + 1) & (capacity_ - 1)) {
+      compressed_trie* child = children_[i];
+      if (child == nullptr) {
+        return nullptr;
+      }
+      if (child->hash_ == hash && child->key_ == key) {
+        return child;
+      }
+    }
+  }
+
+  /**
+   * @brief Position of this node in the child table of its parent
+   */
+  size_t
+  slot() const
+  {
+    size_t mask = parent_->capacity_ - 1;
+    size_t i = hash_ & mask;
+    while (parent_->children_[i] != this) {
+      i = (i + 1) & mask;
+    }
+    return i;
+  }
+
+  void
+  add_child(compressed_trie* child)
+  {
+    // keep at least one empty slot to terminate lookups
+    if ((nChildren_ + 1) * 4 > capacity_ * 3) {
+      size_t oldCapacity = capacity_;
+      std::unique_ptr<compressed_trie*[]> oldChildren(std::move(children_));
+
+      capacity_ = (capacity_ == 0) ? 2 : capacity_ * 2;
+      children_.reset(new compressed_trie*[capacity_]());
+      for (size_t i = 0; i < oldCapacity; ++i) {
+        if (oldChildren[i] != nullptr) {
+          place(oldChildren[i]);
+        }
+      }
+    }
+
+    child->parent_ = this;
+    place(child);
+    ++nChildren_;
+  }
+
+  void
+  place(compressed_trie* child)
+  {
+    size_t i = child->hash_ & (capacity_ - 1);
+    while (children_[i] != nullptr) {
+      i = (i + 1) & (capacity_ - 1);
+    }
+    children_[i] = child;
+  }
+
+  void
+  remove_child(compressed_trie* child)
+  {
+    if (--nChildren_ == 0) {
+      children_.reset();
+      capacity_ = 0;
+      return;
+    }
+
+    // backward shift deletion, so that lookups do not need tombstones
+    size_t mask = capacity_ - 1;
+    size_t hole = child->slot();
+    children_[hole] = nullptr;
+    for (size_t i = (hole + 1) & mask; children_[i] != nullptr; i = (i + 1) & mask) {
+      size_t home = children_[i]->hash_ & mask;
+      if (((i - home) & mask) >= ((i - hole) & mask)) {
+        children_[hole] = children_[i];
+        children_[i] = nullptr;
+        hole = i;
+      }
+    }
+  }
+
+private:
+  struct any_payload {
+    template<class Payload>
+    bool
+    operator()(const Payload&) const
+    {
+      return true;
+    }
+  };
+
+  template<class Trie>
+  friend class compressed_trie_iterator;
+
+  compressed_trie(const compressed_trie&) = delete;
+  compressed_trie&
+  operator=(const compressed_trie&) = delete;
+
+public:
+  PolicyHook policy_hook_;
+
+private:
+  Key key_;               ///< first component of the label
+  std::vector<Key> tail_; ///< the other components of the label
+  size_t hash_;           ///< hash of key_
+
+  std::unique_ptr<compressed_trie*[]> children_; ///< open-addressing table of children
+  uint32_t nChildren_;
+  uint32_t capacity_; ///< 0 or a power of two
+
+  typename PayloadTraits::storage_type payload_;
+  compressed_trie* parent_; // to make cleaning effective
+};
+
+/**
+ * @brief Pre-order iterator over all nodes of a compressed_trie
+ */
+template<class Trie>
+class compressed_trie_iterator {
+public:
+  compressed_trie_iterator()
+    : trie_(0)
+  {
+  }
+
+  compressed_trie_iterator(Trie* item)
+    : trie_(item)
+  {
+  }
+
+  compressed_trie_iterator(Trie& item)
+    : trie_(&item)
+  {
+  }
+
+  Trie& operator*() const
+  {
+    return *trie_;
+  }
+
+  Trie* operator->() const
+  {
+    return trie_;
+  }
+
+  bool
+  operator==(const compressed_trie_iterator& other) const
+  {
+    return trie_ == other.trie_;
+  }
+
+  bool
+  operator!=(const compressed_trie_iterator& other) const
+  {
+    return trie_ != other.trie_;
+  }
+
+  compressed_trie_iterator&
+  operator++()
+  {
+    if (trie_->nChildren_ > 0) {
+      trie_ = first_child(trie_, 0);
+      return *this;
+    }
+
+    // go up until there is a next sibling
+    while (trie_->parent_ != nullptr) {
+      Trie* next = first_child(trie_->parent_, trie_->slot() + 1);
+      if (next != nullptr) {
+        trie_ = next;
+        return *this;
+      }
+      trie_ = trie_->parent_;
+    }
+    trie_ = 0;
+    return *this;
+  }
+
+  compressed_trie_iterator&
+  operator++(int)
+  {
+    return ++(*this);
+  }
+
+private:
+  static Trie*
+  first_child(Trie* node, size_t from)
+  {
+    for (size_t i = from; i < node->capacity_; ++i) {
+      if (node->children_[i] != nullptr) {
+        return node->children_[i];
+      }
+    }
+    return nullptr;
+  }
+
+private:
+  Trie* trie_;
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // COMPRESSED_TRIE_H_
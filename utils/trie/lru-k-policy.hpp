@@ -0,0 +1,205 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef LRU_K_POLICY_H_
+#define LRU_K_POLICY_H_
+
+/// @cond include_hidden
+
+#include <boost/intrusive/options.hpp>
+#include <boost/intrusive/set.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Traits for LRU-K replacement policy (O'Neil et al., SIGMOD 1993)
+ *
+ * Evicts the entry whose K-th most recent reference is the oldest.  Entries referenced fewer
+ * than K times (including insertion) are evicted first, least recently used first, so that
+ * entries seen once by a scan do not push out entries that are used repeatedly.  References
+ * are ordered by a counter of the policy; history of evicted entries is not retained.
+ *
+ * Entries are kept sorted by the eviction order, so insertion and hits take O(log n) time.
+ */
+template<size_t K>
+struct lru_k_policy_traits {
+  /// @brief Name that can be used to identify the policy (for NS-3 object model and logging)
+  static std::string
+  GetName()
+  {
+    return "Lru" + std::to_string(K);
+  }
+
+  struct policy_hook_type : public boost::intrusive::set_member_hook<> {
+    uint64_t history[K]; ///< times of the last K references, the most recent first
+    size_t nReferences;  ///< number of references, up to K
+  };
+
+  template<class Container>
+  struct container_hook {
+    typedef boost::intrusive::member_hook<Container, policy_hook_type, &Container::policy_hook_>
+      type;
+  };
+
+  template<class Base, class Container, class Hook>
+  struct policy {
+    static policy_hook_type&
+    get_hook(typename Container::iterator item)
+    {
+      return *static_cast<policy_hook_type*>(policy_container::value_traits::to_node_ptr(*item));
+    }
+
+    static const policy_hook_type&
+    get_hook(typename Container::const_iterator item)
+    {
+      return *static_cast<const policy_hook_type*>(
+               policy_container::value_traits::to_node_ptr(*item));
+    }
+
+    /**
+     * @brief Eviction order: entries with less than K references by their last reference,
+     *        then the others by their K-th most recent reference
+     */
+    static std::pair<bool, uint64_t>
+    get_order(typename Container::const_iterator item)
+    {
+      const policy_hook_type& hook = get_hook(item);
+      if (hook.nReferences < K) {
+        return std::make_pair(false, hook.history[0]);
+      }
+      return std::make_pair(true, hook.history[K - 1]);
+    }
+
+    template<class Key>
+    struct MemberHookLess {
+      bool
+      operator()(const Key& a, const Key& b) const
+      {
+        return get_order(&a) < get_order(&b);
+      }
+    };
+
+    typedef boost::intrusive::multiset<Container,
+                                       boost::intrusive::compare<MemberHookLess<Container>>,
+                                       Hook> policy_container;
+
+    class type : public policy_container {
+    public:
+      typedef policy policy_base; // to get access to get_order methods from outside
+      typedef Container parent_trie;
+
+      type(Base& base)
+        : base_(base)
+        , max_size_(100)
+        , clock_(0)
+      {
+      }
+
+      inline void
+      update(typename parent_trie::iterator item)
+      {
+        policy_container::erase(policy_container::s_iterator_to(*item));
+        reference(item);
+        policy_container::insert(*item);
+      }
+
+      inline bool
+      insert(typename parent_trie::iterator item)
+      {
+        if (max_size_ != 0 && policy_container::size() >= max_size_) {
+          base_.erase(&(*policy_container::begin()));
+        }
+
+        get_hook(item).nReferences = 0;
+        reference(item);
+        policy_container::insert(*item);
+        return true;
+      }
+
+      inline void
+      lookup(typename parent_trie::iterator item)
+      {
+        policy_container::erase(policy_container::s_iterator_to(*item));
+        reference(item);
+        policy_container::insert(*item);
+      }
+
+      inline void
+      erase(typename parent_trie::iterator item)
+      {
+        policy_container::erase(policy_container::s_iterator_to(*item));
+      }
+
+      inline void
+      clear()
+      {
+        policy_container::clear();
+      }
+
+      inline void
+      set_max_size(size_t max_size)
+      {
+        max_size_ = max_size;
+      }
+
+      inline size_t
+      get_max_size() const
+      {
+        return max_size_;
+      }
+
+    private:
+      void
+      reference(typename parent_trie::iterator item)
+      {
+        policy_hook_type& hook = get_hook(item);
+        std::copy_backward(hook.history, hook.history + K - 1, hook.history + K);
+        hook.history[0] = ++clock_;
+        hook.nReferences = std::min(hook.nReferences + 1, K);
+      }
+
+    private:
+      type()
+        : base_(*((Base*)0)){};
+
+    private:
+      Base& base_;
+      size_t max_size_;
+      uint64_t clock_;
+    };
+  };
+};
+
+/**
+ * @brief Traits for LRU-2 replacement policy
+ */
+typedef lru_k_policy_traits<2> lru_2_policy_traits;
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+/// @endcond
+
+#endif // LRU_K_POLICY_H_
@@ -23,21 +23,29 @@
 /// @cond include_hidden
 
 #include "trie.hpp"
+#include "compressed-trie.hpp"
 
 namespace ns3 {
 namespace ndn {
 namespace ndnSIM {
 
-template<typename FullKey, typename PayloadTraits, typename PolicyTraits>
+/**
+ * @brief Trie with a replacement policy
+ *
+ * @tparam Trie trie implementation: trie, or compressed_trie that stores a run of components
+ *              in one node
+ */
+template<typename FullKey, typename PayloadTraits, typename PolicyTraits,
+         template<typename, typename, typename> class Trie = trie>
 class trie_with_policy {
 public:
-  typedef trie<FullKey, PayloadTraits, typename PolicyTraits::policy_hook_type> parent_trie;
+  typedef Trie<FullKey, PayloadTraits, typename PolicyTraits::policy_hook_type> parent_trie;
 
   typedef typename parent_trie::iterator iterator;
   typedef typename parent_trie::const_iterator const_iterator;
 
   typedef typename PolicyTraits::
-    template policy<trie_with_policy<FullKey, PayloadTraits, PolicyTraits>, parent_trie,
+    template policy<trie_with_policy<FullKey, PayloadTraits, PolicyTraits, Trie>, parent_trie,
                     typename PolicyTraits::template container_hook<parent_trie>::type>::type
       policy_container;
 
@@ -70,14 +78,12 @@ public:
   inline void
   erase(const FullKey& key)
   {
-    iterator foundItem, lastItem;
-    bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find(key);
+    iterator item = trie_.find_exact(key);
 
-    if (!reachLast || lastItem->payload() == PayloadTraits::empty_payload)
+    if (item == end() || item->payload() == PayloadTraits::empty_payload)
       return; // nothing to invalidate
 
-    erase(lastItem);
+    erase(item);
   }
 
   inline void
@@ -117,14 +123,12 @@ public:
   inline iterator
   find_exact(const FullKey& key)
   {
-    iterator foundItem, lastItem;
-    bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find(key);
+    iterator item = trie_.find_exact(key);
 
-    if (!reachLast || lastItem->payload() == PayloadTraits::empty_payload)
+    if (item == end() || item->payload() == PayloadTraits::empty_payload)
       return end();
 
-    return lastItem;
+    return item;
   }
 
   /**
@@ -232,25 +236,12 @@ public:
   inline iterator
   deepest_prefix_match_if_next_level(const FullKey& key, Predicate pred)
   {
-    iterator foundItem, lastItem;
-    bool reachLast;
-    std::tie(foundItem, reachLast, lastItem) = trie_.find(key);
-
-    // guard in case we don't have anything in the trie
-    if (lastItem == trie_.end())
-      return trie_.end();
-
-    if (reachLast) {
-      foundItem = lastItem->find_if_next_level(pred); // may or may not find something
-      if (foundItem == trie_.end()) {
-        return trie_.end();
-      }
-      policy_.lookup(s_iterator_to(foundItem));
-      return foundItem;
-    }
-    else { // couldn't find a node that has prefix at least as key
+    iterator foundItem = trie_.find_if_next_level(key, pred); // may or may not find something
+    if (foundItem == trie_.end()) {
       return trie_.end();
     }
+    policy_.lookup(s_iterator_to(foundItem));
+    return foundItem;
   }
 
   iterator
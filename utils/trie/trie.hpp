@@ -343,6 +343,20 @@ public:
     return std::make_tuple(foundNode, reachLast, trieNode);
   }
 
+  /**
+   * @brief Find the node for exactly @p key
+   * @returns the node (with or without payload) or end()
+   */
+  inline iterator
+  find_exact(const FullKey& key)
+  {
+    iterator foundItem, lastItem;
+    bool reachLast;
+    std::tie(foundItem, reachLast, lastItem) = find(key);
+
+    return reachLast ? lastItem : 0;
+  }
+
   /**
    * @brief Find next payload of the sub-trie
    * @returns end() or a valid iterator pointing to the trie leaf (order is not defined, enumeration
@@ -417,6 +431,21 @@ public:
     return 0;
   }
 
+  /**
+   * @brief Find next payload with prefix @p key, checking predicate only for the component that
+   *        follows @p key
+   */
+  template<class Predicate>
+  inline iterator
+  find_if_next_level(const FullKey& key, Predicate pred)
+  {
+    iterator lastItem = find_exact(key);
+    if (lastItem == 0)
+      return 0;
+
+    return lastItem->find_if_next_level(pred);
+  }
+
   iterator
   end()
   {